@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,10,35,105,102,100,101,102,32,71,76,83,76,95,68,79,88,89,71,69,78,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,32,42,32,73,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,100,101,102,105,110,101,100,32,98,121,32,116,104,101,32,71,76,83,76,32,112,114,101,97,109,98,108,101,10,32,42,32,103,101,110,101,114,97,116,101,100,32,98,121,32,102,97,115,116,117,105,100,114,97,119,44,32,116,104,101,110,32,105,109,97,103,101,115,32,98,97,99,107,101,100,32,98,121,32,97,110,32,97,116,108,97,115,32,40,105,46,101,46,32,92,114,101,102,10,32,42,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,116,121,112,101,40,41,32,105,115,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,111,110,95,97,116,108,97,115,41,32,100,111,10,32,42,32,110,111,116,32,111,99,99,117,114,32,97,110,100,32,97,114,101,32,110,111,116,32,115,117,112,112,111,114,116,101,100,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,10,32,42,32,84,104,101,32,115,105,122,101,32,111,102,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,40,97,115,32,97,110,32,117,105,110,116,41,44,32,105,46,101,46,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,65,116,108,97,115,58,58,99,111,108,111,114,95,116,105,108,101,95,115,105,122,101,40,41,46,10,32,42,32,86,97,108,117,101,32,105,115,32,97,108,119,97,121,115,32,97,32,112,111,119,101,114,32,111,102,32,50,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,82,69,67,73,80,95,83,73,90,69,10,32,42,32,84,104,101,32,114,101,99,105,112,114,111,99,97,108,32,111,102,32,115,105,122,101,32,111,102,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,40,97,115,32,97,32,102,108,111,97,116,41,46,10,32,42,32,86,97,108,117,101,32,105,115,32,97,108,119,97,121,115,32,97,32,112,111,119,101,114,32,111,102,32,50,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,82,69,67,73,80,95,83,73,90,69,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,10,32,42,32,84,104,101,32,108,111,103,50,32,111,102,32,115,105,122,101,32,111,102,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,40,97,115,32,97,110,32,117,105,110,116,41,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,10,32,42,32,84,104,101,32,115,105,122,101,32,111,102,32,116,104,101,32,105,110,100,101,120,32,116,105,108,101,115,44,32,105,46,101,46,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,65,116,108,97,115,58,58,105,110,100,101,120,95,116,105,108,101,95,115,105,122,101,40,41,46,10,32,42,32,86,97,108,117,101,32,105,115,32,97,108,119,97,121,115,32,97,32,112,111,119,101,114,32,111,102,32,50,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,82,69,67,73,80,95,83,73,90,69,10,32,42,32,84,104,101,32,114,101,99,105,112,114,111,99,97,108,32,111,102,32,115,105,122,101,32,111,102,32,116,104,101,32,105,110,100,101,120,32,116,105,108,101,115,32,40,97,115,32,97,32,102,108,111,97,116,41,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,82,69,67,73,80,95,83,73,90,69,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,10,32,42,32,84,104,101,32,108,111,103,50,32,111,102,32,115,105,122,101,32,111,102,32,116,104,101,32,105,110,100,101,120,32,116,105,108,101,115,32,40,97,115,32,97,110,32,117,105,110,116,41,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,10,10,35,101,110,100,105,102,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,104,97,116,32,100,101,115,99,114,105,98,101,115,32,116,104,101,32,114,101,108,97,116,105,111,110,115,104,105,112,32,98,101,116,119,101,101,110,10,32,42,32,116,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,97,110,100,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,115,32,111,102,32,97,110,32,105,109,97,103,101,46,10,32,42,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,10,32,42,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,10,123,10,32,32,47,42,33,32,78,117,109,98,101,114,32,111,102,32,105,110,100,101,120,32,116,105,108,101,32,108,101,118,101,108,115,32,42,47,10,32,32,117,105,110,116,32,110,117,109,95,108,101,118,101,108,115,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,97,109,111,117,110,116,32,116,111,32,100,101,108,116,97,32,111,110,32,116,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,10,32,32,32,42,32,116,111,32,109,111,118,101,32,111,110,101,32,116,101,120,101,108,32,105,110,32,116,104,101,32,99,111,108,111,114,32,116,105,108,101,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,114,101,99,105,112,114,111,99,105,97,108,32,111,102,32,92,114,101,102,10,32,32,32,42,32,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,125,59,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,104,97,116,32,102,117,108,108,121,32,100,101,115,99,114,105,98,101,115,32,97,32,92,114,101,102,10,32,42,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,111,114,32,97,32,115,117,98,45,105,109,97,103,101,32,111,102,32,111,110,101,46,10,32,42,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,10,32,42,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,10,123,10,32,32,47,42,33,10,32,32,32,42,32,71,76,83,76,32,115,116,121,108,101,32,105,110,104,101,114,105,116,97,110,99,101,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,98,97,115,101,59,10,10,32,32,47,42,33,32,116,104,101,32,115,105,122,101,32,111,102,32,116,104,101,32,105,109,97,103,101,32,105,110,32,116,101,120,101,108,115,32,42,47,10,32,32,118,101,99,50,32,105,109,97,103,101,95,115,105,122,101,59,10,10,32,32,47,42,33,10,32,32,32,42,32,116,104,101,32,98,111,116,116,111,109,45,108,101,102,116,32,99,111,114,110,101,114,32,111,102,32,116,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,10,32,32,32,42,32,111,102,32,116,104,101,32,115,117,98,45,114,101,99,116,97,110,103,108,101,32,111,102,32,116,104,101,32,73,109,97,103,101,32,98,101,105,110,103,32,101,120,97,109,105,110,101,100,10,32,32,32,42,47,10,32,32,118,101,99,50,32,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,98,111,116,116,111,109,95,108,101,102,116,59,10,10,32,32,47,42,33,32,116,104,101,32,108,97,121,101,114,32,111,102,32,116,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,42,47,10,32,32,117,105,110,116,32,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,108,97,121,101,114,59,10,125,59,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,111,32,103,105,118,101,32,105,110,102,111,114,109,97,116,105,111,110,32,97,98,111,117,116,32,119,104,97,116,32,116,105,108,101,32,97,110,100,32,119,104,101,114,101,10,32,42,32,119,105,116,104,105,110,32,97,32,116,105,108,101,32,97,110,32,105,109,97,103,101,32,116,101,120,101,108,32,105,115,32,108,111,99,97,116,101,100,46,10,32,42,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,10,32,42,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,10,123,10,32,32,47,42,33,10,32,32,32,42,32,116,104,101,32,109,111,115,116,32,112,111,115,105,116,105,118,101,32,118,97,108,117,101,32,97,108,108,111,119,101,100,32,116,111,32,103,111,32,105,110,32,116,101,120,101,108,115,10,32,32,32,42,32,98,101,102,111,114,101,32,108,101,97,118,105,110,103,32,116,104,101,32,116,105,108,101,10,32,32,32,42,47,10,32,32,118,101,99,50,32,109,97,120,95,100,101,108,116,97,95,119,105,116,104,105,110,95,116,105,108,101,59,10,10,32,32,47,42,33,32,116,104,101,32,117,110,110,111,114,109,97,108,105,122,101,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,116,104,101,32,99,111,108,111,114,45,97,116,108,97,115,32,42,47,10,32,32,118,101,99,50,32,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,59,10,10,32,32,47,42,33,32,116,104,101,32,108,97,121,101,114,32,119,105,116,104,105,110,32,116,104,101,32,99,111,108,111,114,32,97,116,108,97,115,32,42,47,10,32,32,117,105,110,116,32,108,97,121,101,114,59,10,125,59,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,104,97,116,32,104,111,108,100,115,32,116,104,101,32,50,120,50,32,116,101,120,101,108,32,98,108,111,99,107,46,10,32,42,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,10,32,42,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,116,101,120,116,117,114,101,95,103,97,116,104,101,114,95,111,117,116,112,117,116,95,116,121,112,101,10,123,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,116,101,120,101,108,32,118,97,108,117,101,32,105,110,32,116,104,101,32,40,109,105,110,45,120,44,32,109,105,110,45,121,41,32,99,111,114,110,101,114,32,111,102,32,116,104,101,10,32,32,32,42,32,50,120,50,32,116,101,120,101,108,32,98,108,111,99,107,10,32,32,32,42,47,10,32,32,118,101,99,52,32,99,48,48,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,116,101,120,101,108,32,118,97,108,117,101,32,105,110,32,116,104,101,32,40,109,97,120,45,120,44,32,109,105,110,45,121,41,32,99,111,114,110,101,114,32,111,102,32,116,104,101,10,32,32,32,42,32,50,120,50,32,116,101,120,101,108,32,98,108,111,99,107,10,32,32,32,42,47,10,32,32,118,101,99,52,32,99,49,48,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,116,101,120,101,108,32,118,97,108,117,101,32,105,110,32,116,104,101,32,40,109,105,110,45,120,44,32,109,97,120,45,121,41,32,99,111,114,110,101,114,32,111,102,32,116,104,101,10,32,32,32,42,32,50,120,50,32,116,101,120,101,108,32,98,108,111,99,107,10,32,32,32,42,47,10,32,32,118,101,99,52,32,99,48,49,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,116,101,120,101,108,32,118,97,108,117,101,32,105,110,32,116,104,101,32,40,109,97,120,45,120,44,32,109,97,120,45,121,41,32,99,111,114,110,101,114,32,111,102,32,116,104,101,10,32,32,32,42,32,50,120,50,32,116,101,120,101,108,32,98,108,111,99,107,10,32,32,32,42,47,10,32,32,118,101,99,52,32,99,49,49,59,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,97,116,108,97,115,32,99,111,111,114,100,105,110,97,116,101,32,102,111,114,32,116,104,101,32,40,109,105,110,45,120,44,32,109,105,110,45,121,41,32,99,111,114,110,101,114,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,59,10,125,59,10,10,47,42,33,10,32,42,32,71,105,118,101,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,108,101,118,101,108,115,32,111,102,32,97,110,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,119,105,116,104,10,32,42,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,116,121,112,101,40,41,32,98,101,105,110,103,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,111,110,95,97,116,108,97,115,44,10,32,42,32,99,111,109,112,117,116,101,32,116,104,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,10,32,42,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,108,101,118,101,108,115,32,118,97,108,117,101,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,40,41,10,32,42,32,92,112,97,114,97,109,32,100,32,108,111,99,97,116,105,111,110,32,116,111,32,119,104,105,99,104,32,116,111,32,119,114,105,116,101,32,116,104,101,32,114,101,115,117,108,116,115,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,105,110,102,111,40,105,110,32,117,105,110,116,32,110,117,109,95,108,101,118,101,108,115,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,100,41,10,123,10,32,32,100,46,110,117,109,95,108,101,118,101,108,115,32,61,32,110,117,109,95,108,101,118,101,108,115,59,10,32,32,105,102,32,40,110,117,109,95,108,101,118,101,108,115,32,62,61,32,49,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,69,97,99,104,32,108,101,118,101,108,32,105,110,99,114,101,97,115,101,115,32,116,104,101,32,115,105,122,101,32,98,121,32,97,32,102,97,99,116,111,114,32,111,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,44,10,32,32,32,32,32,32,32,42,32,116,104,117,115,32,116,104,101,32,114,97,116,105,111,32,105,115,32,82,32,119,104,101,114,101,32,82,32,105,115,32,103,105,118,101,110,32,98,121,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,32,82,32,61,32,67,32,42,32,112,111,119,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,44,32,110,117,109,95,108,101,118,101,108,115,32,45,32,49,41,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,119,104,101,114,101,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,32,67,32,61,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,78,111,119,44,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,32,82,32,61,32,67,32,42,32,112,111,119,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,44,32,110,117,109,95,108,101,118,101,108,115,32,45,32,49,41,10,32,32,32,32,32,32,32,42,32,32,32,32,61,32,67,32,42,32,112,111,119,40,50,44,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,32,42,32,40,110,117,109,95,108,101,118,101,108,115,32,45,32,49,41,41,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,85,115,105,110,103,32,98,105,116,115,104,105,102,116,44,32,119,101,32,116,104,101,110,32,104,97,118,101,58,10,32,32,32,32,32,32,32,42,10,32,32,32,32,32,32,32,42,32,32,82,32,61,32,67,32,42,32,40,49,117,32,60,60,32,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,32,42,32,40,110,117,109,95,108,101,118,101,108,115,32,45,32,49,41,41,41,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,117,105,110,116,32,119,119,32,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,41,32,42,32,40,110,117,109,95,108,101,118,101,108,115,32,45,32,49,117,41,59,10,32,32,32,32,32,32,102,108,111,97,116,32,105,110,100,101,120,95,112,111,119,115,32,61,32,102,108,111,97,116,40,49,117,32,60,60,32,119,119,41,59,10,10,32,32,32,32,32,32,100,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,32,42,32,105,110,100,101,120,95,112,111,119,115,59,10,32,32,32,32,32,32,100,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,49,46,48,32,47,32,100,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,100,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,49,46,48,59,10,32,32,32,32,32,32,100,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,49,46,48,59,10,32,32,32,32,125,10,125,10,10,47,42,33,10,32,42,32,71,105,118,101,110,32,97,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,32,118,97,108,117,101,44,32,99,111,109,112,117,116,101,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,10,32,42,32,114,101,108,97,116,101,32,116,111,32,116,104,101,32,97,99,116,117,97,108,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,40,110,111,116,32,97,32,115,117,98,45,105,109,97,103,101,32,97,115,32,116,114,97,99,107,101,100,10,32,42,32,98,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,97,100,100,105,116,105,111,110,97,108,32,102,105,101,108,100,115,41,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,32,105,110,116,101,114,112,111,108,97,116,101,100,32,118,97,108,117,101,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,40,41,46,120,121,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,109,114,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,40,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,47,42,32,84,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,111,102,32,97,110,32,73,109,97,103,101,32,105,115,32,65,76,87,65,89,83,32,115,116,97,114,116,115,32,97,116,32,97,32,109,117,108,116,105,112,108,101,10,32,32,32,42,32,111,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,44,32,115,111,32,116,104,101,32,118,97,108,117,101,32,111,102,10,32,32,32,42,32,109,111,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,44,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,10,32,32,32,42,32,103,105,118,101,115,32,116,104,101,32,114,101,108,97,116,105,118,101,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,116,104,101,32,116,105,108,101,46,32,84,111,32,97,118,111,105,100,32,116,104,101,10,32,32,32,42,32,101,120,112,101,110,115,105,118,101,32,100,105,118,105,100,101,44,32,119,101,32,117,115,101,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,82,69,67,73,80,95,84,73,76,69,95,83,73,90,69,10,32,32,32,42,32,116,111,103,101,116,104,101,114,32,119,105,116,104,32,102,108,111,111,114,46,10,32,32,32,42,47,10,32,32,118,101,99,50,32,114,101,108,97,116,105,118,101,59,10,10,32,32,114,101,108,97,116,105,118,101,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,10,32,32,32,32,45,32,118,101,99,50,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,32,42,32,102,108,111,111,114,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,82,69,67,73,80,95,84,73,76,69,95,83,73,90,69,32,42,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,41,59,10,10,32,32,47,42,32,84,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,105,115,32,116,104,101,110,32,103,105,118,101,110,32,98,121,32,116,104,101,32,114,101,108,97,116,105,118,101,32,118,97,108,117,101,32,116,105,109,101,115,10,32,32,32,42,32,116,104,101,32,115,105,122,101,32,114,97,116,105,111,32,111,102,32,116,104,101,32,99,111,108,111,114,45,116,105,108,101,32,116,111,32,109,97,115,116,101,114,45,116,105,108,101,10,32,32,32,42,47,10,32,32,114,101,116,117,114,110,32,114,101,108,97,116,105,118,101,32,42,32,105,109,97,103,101,95,105,110,102,111,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,125,10,10,47,42,33,10,32,42,32,71,105,118,101,115,32,116,104,101,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,32,102,114,111,109,32,97,110,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,118,97,108,117,101,32,116,111,10,32,42,32,116,104,101,32,116,105,108,101,32,98,111,117,110,100,97,114,121,46,32,78,79,84,69,33,32,116,104,101,32,105,110,112,117,116,32,118,97,108,117,101,32,105,115,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,10,32,42,32,119,105,116,104,105,110,32,97,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,44,32,110,111,116,32,97,32,115,117,98,45,105,109,97,103,101,46,10,32,42,32,92,112,97,114,97,109,32,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,97,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,59,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,110,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,97,32,112,97,114,116,105,97,108,32,105,109,97,103,101,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,115,32,110,111,116,32,117,115,101,102,117,108,46,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,116,105,108,101,95,109,105,110,95,100,105,115,116,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,44,32,105,110,32,105,109,97,103,101,32,116,101,120,101,108,115,44,32,116,111,32,109,105,110,45,115,105,100,101,32,111,102,32,116,105,108,101,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,116,105,108,101,95,109,97,120,95,100,105,115,116,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,44,32,105,110,32,105,109,97,103,101,32,116,101,120,101,108,115,44,32,116,111,32,109,97,120,45,115,105,100,101,32,111,102,32,116,105,108,101,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,105,110,32,102,108,111,97,116,32,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,116,105,108,101,95,109,105,110,95,100,105,115,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,116,105,108,101,95,109,97,120,95,100,105,115,116,41,10,123,10,32,32,102,108,111,97,116,32,116,105,108,101,95,99,111,111,114,100,59,10,10,32,32,116,105,108,101,95,99,111,111,114,100,32,61,32,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,10,32,32,32,32,45,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,32,42,32,102,108,111,111,114,40,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,42,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,82,69,67,73,80,95,84,73,76,69,95,83,73,90,69,41,59,10,10,32,32,116,105,108,101,95,109,105,110,95,100,105,115,116,32,61,32,45,116,105,108,101,95,99,111,111,114,100,59,10,32,32,116,105,108,101,95,109,97,120,95,100,105,115,116,32,61,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,32,45,32,49,46,48,32,45,32,116,105,108,101,95,99,111,111,114,100,59,10,125,10,10,47,42,33,10,32,42,32,71,105,118,101,115,32,116,104,101,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,32,102,114,111,109,32,97,110,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,118,97,108,117,101,32,116,111,10,32,42,32,116,104,101,32,116,105,108,101,32,98,111,117,110,100,97,114,121,46,32,78,79,84,69,33,32,116,104,101,32,105,110,112,117,116,32,118,97,108,117,101,32,105,115,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,10,32,42,32,119,105,116,104,105,110,32,97,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,44,32,110,111,116,32,97,32,115,117,98,45,105,109,97,103,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,10,32,42,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,97,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,59,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,110,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,119,105,116,104,105,110,32,97,32,112,97,114,116,105,97,108,32,105,109,97,103,101,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,115,32,110,111,116,32,117,115,101,102,117,108,46,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,116,105,108,101,95,109,105,110,95,100,105,115,116,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,44,32,105,110,32,105,109,97,103,101,32,116,101,120,101,108,115,44,32,116,111,32,109,105,110,45,115,105,100,101,32,111,102,32,116,105,108,101,10,32,42,32,92,112,97,114,97,109,91,111,117,116,93,32,116,105,108,101,95,109,97,120,95,100,105,115,116,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,44,32,105,110,32,105,109,97,103,101,32,116,101,120,101,108,115,44,32,116,111,32,109,97,120,45,115,105,100,101,32,111,102,32,116,105,108,101,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,105,110,32,118,101,99,50,32,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,116,105,108,101,95,109,105,110,95,100,105,115,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,116,105,108,101,95,109,97,120,95,100,105,115,116,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,46,120,44,32,116,105,108,101,95,109,105,110,95,100,105,115,116,46,120,44,32,116,105,108,101,95,109,97,120,95,100,105,115,116,46,120,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,46,121,44,32,116,105,108,101,95,109,105,110,95,100,105,115,116,46,121,44,32,116,105,108,101,95,109,97,120,95,100,105,115,116,46,121,41,59,10,125,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,115,32,116,104,101,32,115,117,98,45,105,109,97,103,101,45,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,102,114,111,109,32,97,32,109,97,115,116,101,114,45,116,105,108,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,32,105,110,116,101,114,112,111,108,97,116,101,100,32,118,97,108,117,101,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,40,41,46,120,121,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,40,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,118,101,99,50,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,95,99,111,111,114,100,32,45,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,98,111,116,116,111,109,95,108,101,102,116,41,10,32,32,32,32,42,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,115,32,116,104,101,32,116,104,101,32,109,97,115,116,101,114,45,116,105,108,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,102,114,111,109,32,97,32,115,117,98,45,105,109,97,103,101,45,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,99,111,111,114,100,105,110,97,116,101,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,118,101,99,50,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,42,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,10,32,32,32,32,43,32,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,98,111,116,116,111,109,95,108,101,102,116,59,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,47,42,33,10,32,42,32,67,108,97,109,112,115,32,97,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,102,111,114,32,110,101,97,114,101,115,116,32,102,105,108,116,101,114,105,110,103,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,105,110,103,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,114,101,116,117,114,110,32,99,108,97,109,112,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,118,101,99,50,40,48,46,48,41,44,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,115,105,122,101,41,59,10,125,10,10,47,42,33,10,32,42,32,67,108,97,109,112,115,32,97,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,102,111,114,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,32,92,112,97,114,97,109,32,112,111,119,50,95,108,111,100,32,112,111,119,50,32,111,102,32,108,111,100,32,112,97,114,97,109,101,116,101,114,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,108,105,110,101,97,114,95,102,105,108,116,101,114,105,110,103,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,112,111,119,50,95,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,99,108,97,109,112,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,50,40,48,46,53,32,42,32,112,111,119,50,95,108,111,100,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,115,105,122,101,32,45,32,118,101,99,50,40,48,46,53,32,42,32,112,111,119,50,95,108,111,100,41,41,59,10,125,10,10,47,42,33,10,32,42,32,67,108,97,109,112,115,32,97,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,102,111,114,32,99,117,98,105,99,32,102,105,108,116,101,114,105,110,103,46,32,79,110,108,121,10,32,42,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,47,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,99,117,98,105,99,95,102,105,108,116,101,114,105,110,103,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,114,101,116,117,114,110,32,99,108,97,109,112,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,50,40,50,46,48,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,115,105,122,101,32,45,32,118,101,99,50,40,50,46,48,41,41,59,10,125,10,10,47,47,47,64,99,111,110,100,10,10,47,42,32,83,116,114,117,99,116,117,114,101,32,116,111,32,109,97,107,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,40,41,10,32,42,32,108,101,115,115,32,117,103,108,121,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,116,121,112,101,10,123,10,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,59,10,32,32,117,118,101,99,52,32,116,105,108,101,95,105,100,59,10,125,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,105,110,105,116,40,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,116,121,112,101,32,118,41,10,123,10,32,32,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,118,46,105,110,100,101,120,95,108,97,121,101,114,32,61,32,105,110,100,101,120,95,108,97,121,101,114,59,10,32,32,118,46,116,105,108,101,95,105,100,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,32,118,46,105,110,100,101,120,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,59,10,32,32,118,46,105,110,100,101,120,95,108,97,121,101,114,32,61,32,118,46,116,105,108,101,95,105,100,46,122,32,43,32,50,53,54,117,32,42,32,118,46,116,105,108,101,95,105,100,46,119,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,105,116,101,114,97,116,101,40,105,110,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,116,121,112,101,32,118,41,10,123,10,32,32,118,101,99,50,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,59,10,32,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,59,10,10,32,32,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,102,108,111,111,114,40,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,41,59,10,32,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,32,61,32,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,59,10,32,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,61,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,10,32,32,32,32,43,32,118,101,99,50,40,118,46,116,105,108,101,95,105,100,46,120,121,41,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,59,10,10,32,32,118,46,116,105,108,101,95,105,100,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,118,46,105,110,100,101,120,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,59,10,32,32,118,46,105,110,100,101,120,95,108,97,121,101,114,32,61,32,118,46,116,105,108,101,95,105,100,46,122,32,43,32,50,53,54,117,32,42,32,118,46,116,105,108,101,95,105,100,46,119,59,10,32,32,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,102,105,110,105,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,116,121,112,101,32,118,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,114,101,116,117,114,110,95,118,97,108,117,101,41,10,123,10,10,32,32,47,42,32,97,116,32,116,104,105,115,32,112,111,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,32,103,105,118,101,115,32,116,104,101,32,108,97,121,101,114,32,105,110,116,111,32,99,111,108,111,114,65,116,108,97,115,10,32,32,32,42,32,97,110,100,32,116,105,108,101,95,105,100,32,103,105,118,101,115,32,119,104,105,99,104,32,116,105,108,101,32,105,110,32,116,104,101,32,99,111,108,111,114,32,97,116,108,97,115,10,32,32,32,42,47,10,32,32,118,101,99,50,32,116,105,108,101,95,111,102,102,115,101,116,59,10,32,32,117,105,110,116,32,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,59,10,10,32,32,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,32,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,59,10,32,32,116,105,108,101,95,111,102,102,115,101,116,32,61,32,40,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,45,32,102,108,111,111,114,40,118,46,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,41,41,32,42,32,102,108,111,97,116,40,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,41,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,61,32,116,105,108,101,95,111,102,102,115,101,116,32,47,47,111,102,102,115,101,116,32,105,110,116,111,32,116,105,108,101,10,32,32,32,32,43,32,118,101,99,50,40,118,46,116,105,108,101,95,105,100,46,120,121,41,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,59,32,47,47,108,111,99,97,116,105,111,110,32,111,102,32,116,105,108,101,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,109,97,120,95,100,101,108,116,97,95,119,105,116,104,105,110,95,116,105,108,101,32,61,10,32,32,32,32,118,101,99,50,40,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,32,45,32,49,117,41,41,32,45,32,116,105,108,101,95,111,102,102,115,101,116,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,108,97,121,101,114,32,61,32,118,46,105,110,100,101,120,95,108,97,121,101,114,59,10,125,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,115,32,116,104,101,32,105,109,97,103,101,45,97,116,108,97,115,32,99,111,111,114,100,105,110,97,116,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,32,42,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,117,110,110,111,114,109,97,108,105,122,101,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,111,102,32,119,105,116,104,105,110,32,116,104,101,32,109,97,115,116,101,114,45,105,110,100,101,120,32,116,105,108,101,10,32,42,32,92,112,97,114,97,109,32,105,110,100,101,120,95,108,97,121,101,114,32,119,104,97,116,32,108,97,121,101,114,32,102,114,111,109,32,116,104,101,32,105,110,100,101,120,45,97,116,108,97,115,32,116,104,101,32,109,97,115,116,101,114,32,116,105,108,101,32,105,115,32,108,111,99,97,116,101,100,32,97,116,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,108,101,118,101,108,115,32,110,117,109,98,101,114,32,111,102,32,105,110,100,101,120,32,108,101,118,101,108,115,32,110,101,101,100,101,100,32,116,111,32,114,101,97,99,104,32,116,104,101,32,99,111,108,111,114,45,116,105,108,101,10,32,42,32,92,112,97,114,97,109,32,114,101,116,117,114,110,95,118,97,108,117,101,32,108,111,99,97,116,105,111,110,32,116,111,32,119,104,105,99,104,32,116,111,32,119,114,105,116,101,32,118,97,108,117,101,115,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,114,101,116,117,114,110,95,118,97,108,117,101,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,116,121,112,101,32,118,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,105,110,105,116,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,100,101,120,95,108,97,121,101,114,44,32,118,41,59,10,32,32,102,111,114,40,117,105,110,116,32,105,32,61,32,49,117,59,32,105,32,60,32,110,117,109,95,108,101,118,101,108,115,59,32,43,43,105,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,105,116,101,114,97,116,101,40,118,41,59,10,32,32,32,32,125,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,104,101,108,112,101,114,95,102,105,110,105,40,118,44,32,114,101,116,117,114,110,95,118,97,108,117,101,41,59,10,125,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,115,32,116,104,101,32,105,109,97,103,101,45,97,116,108,97,115,32,99,111,111,114,100,105,110,97,116,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,32,42,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,32,92,112,97,114,97,109,32,114,101,116,117,114,110,95,118,97,108,117,101,32,108,111,99,97,116,105,111,110,32,116,111,32,119,104,105,99,104,32,116,111,32,119,114,105,116,101,32,118,97,108,117,101,115,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,114,101,116,117,114,110,95,118,97,108,117,101,41,10,123,10,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,10,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,99,111,111,114,100,105,110,97,116,101,40,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,41,59,10,125,10,10,47,47,47,64,99,111,110,100,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,103,97,116,104,101,114,40,105,110,32,105,110,116,32,108,111,100,95,105,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,116,101,120,116,117,114,101,95,103,97,116,104,101,114,95,111,117,116,112,117,116,95,116,121,112,101,32,111,117,116,112,117,116,95,118,97,108,117,101,41,10,123,10,32,32,47,42,32,83,105,103,104,115,44,32,119,101,32,110,101,101,100,32,116,111,32,100,111,32,116,104,101,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,32,111,117,114,115,101,108,118,101,115,32,98,101,99,97,117,115,101,10,32,32,32,42,32,97,116,108,101,97,115,32,111,110,101,32,111,102,32,116,104,101,32,110,101,105,103,104,98,111,114,105,110,103,32,116,101,120,101,108,115,32,105,115,32,105,110,32,97,32,100,105,102,102,101,114,101,110,116,32,116,105,108,101,46,10,32,32,32,42,47,10,32,32,105,118,101,99,51,32,116,48,48,44,32,116,49,48,44,32,116,48,49,44,32,116,49,49,59,10,32,32,102,108,111,97,116,32,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,44,32,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,59,10,32,32,118,101,99,50,32,100,101,108,116,97,59,10,10,32,32,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,32,61,32,108,111,100,95,102,97,99,116,111,114,32,42,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,32,61,32,48,46,53,32,42,32,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,59,10,10,32,32,47,42,32,119,101,32,119,97,110,116,32,116,104,101,32,116,101,120,101,108,32,116,104,97,116,32,105,115,32,104,97,108,102,32,97,32,112,105,120,101,108,32,116,111,32,116,104,101,32,108,101,102,116,47,100,111,119,110,10,32,32,32,42,32,111,102,32,116,104,101,32,105,110,112,117,116,32,108,111,99,97,116,105,111,110,46,10,32,32,32,42,47,10,32,32,100,101,108,116,97,32,61,32,45,118,101,99,50,40,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,43,32,100,101,108,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,41,59,10,10,32,32,116,48,48,32,61,32,105,118,101,99,51,40,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,108,97,121,101,114,41,59,10,32,32,105,102,32,40,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,109,97,120,95,100,101,108,116,97,95,119,105,116,104,105,110,95,116,105,108,101,46,120,32,62,61,32,108,111,100,95,102,97,99,116,111,114,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,49,48,46,121,122,32,61,32,116,48,48,46,121,122,59,10,32,32,32,32,32,32,116,49,48,46,120,32,61,32,116,48,48,46,120,32,43,32,49,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,48,59,10,32,32,32,32,32,32,118,101,99,50,32,100,101,108,116,97,95,110,120,116,59,10,32,32,32,32,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,59,10,10,32,32,32,32,32,32,100,101,108,116,97,95,110,120,116,32,61,32,118,101,99,50,40,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,44,32,45,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,41,59,10,32,32,32,32,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,43,32,100,101,108,116,97,95,110,120,116,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,44,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,110,117,109,95,108,101,118,101,108,115,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,48,41,59,10,32,32,32,32,32,32,116,49,48,32,61,32,105,118,101,99,51,40,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,48,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,48,46,108,97,121,101,114,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,109,97,120,95,100,101,108,116,97,95,119,105,116,104,105,110,95,116,105,108,101,46,121,32,62,61,32,108,111,100,95,102,97,99,116,111,114,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,48,49,46,120,122,32,61,32,116,48,48,46,120,122,59,10,32,32,32,32,32,32,116,48,49,46,121,32,61,32,116,48,48,46,121,32,43,32,49,59,10,10,32,32,32,32,32,32,116,49,49,46,120,122,32,61,32,116,49,48,46,120,122,59,10,32,32,32,32,32,32,116,49,49,46,121,32,61,32,116,49,48,46,121,32,43,32,49,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,49,59,10,32,32,32,32,32,32,118,101,99,50,32,100,101,108,116,97,95,110,120,116,59,10,32,32,32,32,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,59,10,10,32,32,32,32,32,32,100,101,108,116,97,95,110,120,116,32,61,32,118,101,99,50,40,45,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,44,32,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,41,59,10,32,32,32,32,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,43,32,100,101,108,116,97,95,110,120,116,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,49,41,59,10,32,32,32,32,32,32,116,48,49,32,61,32,105,118,101,99,51,40,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,49,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,49,46,108,97,121,101,114,41,59,10,10,32,32,32,32,32,32,105,102,32,40,111,117,116,112,117,116,95,118,97,108,117,101,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,109,97,120,95,100,101,108,116,97,95,119,105,116,104,105,110,95,116,105,108,101,46,120,32,62,61,32,108,111,100,95,102,97,99,116,111,114,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,49,49,46,120,32,61,32,116,48,49,46,120,32,43,32,49,59,10,32,32,32,32,32,32,32,32,32,32,116,49,49,46,121,122,32,61,32,116,48,49,46,121,122,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,49,59,10,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,100,101,108,116,97,95,110,120,116,59,10,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,59,10,10,32,32,32,32,32,32,32,32,32,32,100,101,108,116,97,95,110,120,116,32,61,32,118,101,99,50,40,104,97,108,102,95,110,101,120,116,95,112,105,120,101,108,95,100,101,108,116,97,41,59,10,32,32,32,32,32,32,32,32,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,43,32,100,101,108,116,97,95,110,120,116,59,10,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,95,110,120,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,49,41,59,10,32,32,32,32,32,32,32,32,32,32,116,49,49,32,61,32,105,118,101,99,51,40,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,49,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,49,49,46,108,97,121,101,114,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,99,48,48,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,116,48,48,44,32,108,111,100,95,105,41,59,10,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,99,48,49,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,116,48,49,44,32,108,111,100,95,105,41,59,10,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,99,49,48,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,116,49,48,44,32,108,111,100,95,105,41,59,10,32,32,111,117,116,112,117,116,95,118,97,108,117,101,46,99,49,49,32,61,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,116,49,49,44,32,108,111,100,95,105,41,59,10,125,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,10,32,42,32,80,101,114,102,111,114,109,32,110,101,97,114,101,115,116,32,102,105,108,116,101,114,105,110,103,32,115,97,109,112,108,105,110,103,32,111,110,32,97,32,115,117,98,45,105,109,97,103,101,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,105,109,97,103,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,100,101,115,99,114,105,98,101,100,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,116,104,101,32,105,109,97,103,101,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,109,105,112,109,97,112,45,108,111,100,32,40,105,46,101,46,32,115,97,109,101,32,118,97,108,117,101,32,97,115,32,111,110,101,32,119,111,117,108,100,32,102,101,101,100,32,116,101,120,116,117,114,101,76,111,100,41,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,59,10,10,32,32,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,105,110,103,40,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,105,109,97,103,101,95,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,41,59,10,10,32,32,114,101,116,117,114,110,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,78,101,97,114,101,115,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,51,40,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,80,101,114,102,111,114,109,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,115,97,109,112,108,105,110,103,32,111,110,32,97,32,115,117,98,45,105,109,97,103,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,10,32,42,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,117,110,110,111,114,109,97,108,105,122,101,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,111,102,32,119,105,116,104,105,110,32,116,104,101,32,109,97,115,116,101,114,45,105,110,100,101,120,32,116,105,108,101,10,32,42,32,92,112,97,114,97,109,32,105,110,100,101,120,95,108,97,121,101,114,32,119,104,97,116,32,108,97,121,101,114,32,102,114,111,109,32,116,104,101,32,105,110,100,101,120,45,97,116,108,97,115,32,116,104,101,32,109,97,115,116,101,114,32,116,105,108,101,32,105,115,32,108,111,99,97,116,101,100,32,97,116,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,105,110,102,111,114,109,97,116,105,111,110,32,111,102,32,105,109,97,103,101,10,32,42,32,92,112,97,114,97,109,32,108,111,100,95,105,32,119,104,105,99,104,32,109,105,112,109,97,112,32,108,101,118,101,108,32,116,111,32,116,97,107,101,32,40,108,101,118,101,108,32,61,32,48,32,105,115,32,116,104,101,32,98,97,115,101,32,105,109,97,103,101,41,10,32,42,32,92,112,97,114,97,109,32,108,111,100,95,102,97,99,116,111,114,32,116,104,101,32,118,97,108,117,101,32,111,102,32,112,111,119,50,40,108,111,100,95,105,41,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,105,110,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,108,111,100,95,105,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,108,111,100,95,102,97,99,116,111,114,41,10,123,10,32,32,118,101,99,52,32,105,109,97,103,101,95,99,111,108,111,114,59,10,32,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,109,105,110,95,116,105,108,101,95,100,105,115,116,44,32,109,97,120,95,116,105,108,101,95,100,105,115,116,59,10,32,32,102,108,111,97,116,32,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,59,10,10,32,32,47,42,32,73,110,32,101,120,97,99,116,32,97,114,116,105,116,104,109,97,116,105,99,32,116,104,101,32,116,101,120,101,108,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,10,32,32,32,42,32,110,101,101,100,115,32,116,111,32,98,101,32,104,97,108,102,32,97,32,116,101,120,101,108,32,97,119,97,121,32,102,114,111,109,32,116,104,101,32,98,111,117,110,100,97,114,121,10,32,32,32,42,32,105,110,32,101,97,99,104,32,100,105,109,101,110,115,105,111,110,32,116,111,32,108,101,116,32,116,104,101,32,115,97,109,112,108,101,114,32,112,101,114,102,111,114,109,32,116,104,101,10,32,32,32,42,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,46,32,66,101,99,97,117,115,101,32,111,102,32,114,111,117,110,100,45,111,102,102,32,101,114,114,111,114,10,32,32,32,42,32,119,101,32,119,105,108,108,32,112,108,97,121,32,105,116,32,115,97,102,101,32,97,110,100,32,114,101,113,117,105,114,101,32,97,110,32,101,110,116,105,114,101,32,116,101,120,101,108,46,10,32,32,32,42,47,10,32,32,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,32,61,32,108,111,100,95,102,97,99,116,111,114,59,10,10,32,32,47,42,32,115,116,111,114,101,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,114,111,111,116,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,42,47,10,32,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,114,111,111,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,47,42,32,99,111,109,112,117,116,101,32,116,104,101,32,116,105,108,101,32,114,97,110,103,101,32,115,111,32,116,104,97,116,32,119,101,32,99,97,110,32,100,101,99,105,100,101,32,119,104,101,116,104,101,114,32,111,114,32,110,111,116,10,32,32,32,42,32,116,111,32,117,115,101,32,116,104,101,32,115,97,109,112,108,101,114,32,102,111,114,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,46,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,109,105,110,95,116,105,108,101,95,100,105,115,116,44,32,109,97,120,95,116,105,108,101,95,100,105,115,116,41,59,10,10,32,32,105,102,32,40,109,97,120,95,116,105,108,101,95,100,105,115,116,46,120,32,62,61,32,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,10,32,32,32,32,32,32,38,38,32,109,97,120,95,116,105,108,101,95,100,105,115,116,46,121,32,62,61,32,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,10,32,32,32,32,32,32,38,38,32,109,105,110,95,116,105,108,101,95,100,105,115,116,46,120,32,60,61,32,45,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,10,32,32,32,32,32,32,38,38,32,109,105,110,95,116,105,108,101,95,100,105,115,116,46,121,32,60,61,32,45,115,108,97,99,107,95,114,101,113,117,105,114,101,109,101,110,116,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,41,59,10,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,51,40,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,40,108,111,100,95,105,41,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,116,101,120,116,117,114,101,95,103,97,116,104,101,114,95,111,117,116,112,117,116,95,116,121,112,101,32,103,97,116,104,101,114,59,10,32,32,32,32,32,32,102,108,111,97,116,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,32,61,32,49,46,48,102,32,47,32,108,111,100,95,102,97,99,116,111,114,59,10,10,32,32,32,32,32,32,47,42,32,83,105,103,104,115,44,32,119,101,32,110,101,101,100,32,116,111,32,100,111,32,116,104,101,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,32,111,117,114,115,101,108,118,101,115,32,98,101,99,97,117,115,101,10,32,32,32,32,32,32,32,42,32,97,116,108,101,97,115,32,111,110,101,32,111,102,32,116,104,101,32,110,101,105,103,104,98,111,114,105,110,103,32,116,101,120,101,108,115,32,105,115,32,105,110,32,97,32,100,105,102,102,101,114,101,110,116,32,116,105,108,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,103,97,116,104,101,114,40,108,111,100,95,105,44,32,108,111,100,95,102,97,99,116,111,114,44,32,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,103,97,116,104,101,114,41,59,10,10,32,32,32,32,32,32,118,101,99,52,32,99,48,44,32,99,49,59,10,10,32,32,32,32,32,32,99,48,32,61,32,109,105,120,40,103,97,116,104,101,114,46,99,48,48,44,32,103,97,116,104,101,114,46,99,48,49,44,32,102,114,97,99,116,40,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,32,42,32,103,97,116,104,101,114,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,46,121,41,41,59,10,32,32,32,32,32,32,99,49,32,61,32,109,105,120,40,103,97,116,104,101,114,46,99,49,48,44,32,103,97,116,104,101,114,46,99,49,49,44,32,102,114,97,99,116,40,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,32,42,32,103,97,116,104,101,114,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,46,121,41,41,59,10,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,109,105,120,40,99,48,44,32,99,49,44,32,102,114,97,99,116,40,105,110,118,101,114,115,101,95,108,111,100,95,102,97,99,116,111,114,32,42,32,103,97,116,104,101,114,46,97,116,108,97,115,95,108,111,99,97,116,105,111,110,95,116,48,48,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,46,120,41,41,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,105,109,97,103,101,95,99,111,108,111,114,59,10,125,10,10,47,42,33,10,32,42,32,80,101,114,102,111,114,109,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,115,97,109,112,108,105,110,103,32,111,110,32,97,32,115,117,98,45,105,109,97,103,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,10,32,42,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,115,112,101,99,105,102,105,101,100,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,100,101,115,99,114,105,98,101,115,32,116,104,101,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,97,110,100,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,119,105,116,104,105,110,32,105,116,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,108,111,100,95,105,32,119,104,105,99,104,32,109,105,112,109,97,112,32,108,101,118,101,108,32,116,111,32,116,97,107,101,32,40,108,101,118,101,108,32,61,32,48,32,105,115,32,116,104,101,32,98,97,115,101,32,105,109,97,103,101,41,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,105,110,116,32,108,111,100,95,105,41,10,123,10,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,102,108,111,97,116,32,108,111,100,95,102,97,99,116,111,114,59,10,10,32,32,108,111,100,95,102,97,99,116,111,114,32,61,32,102,108,111,97,116,40,49,32,60,60,32,108,111,100,95,105,41,59,10,10,32,32,47,42,32,99,108,97,109,112,32,116,104,101,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,111,32,119,105,116,104,105,110,32,116,104,101,32,115,117,98,45,105,109,97,103,101,46,32,42,47,10,32,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,108,105,110,101,97,114,95,102,105,108,116,101,114,105,110,103,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,44,32,108,111,100,95,102,97,99,116,111,114,41,59,10,10,32,32,47,42,32,103,101,116,32,116,104,101,32,109,97,115,116,101,114,32,105,110,100,101,120,32,116,105,108,101,32,99,111,111,114,100,105,110,97,116,101,32,42,47,10,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,99,111,111,114,100,105,110,97,116,101,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,108,111,100,95,105,44,32,108,111,100,95,102,97,99,116,111,114,41,59,10,125,10,10,47,42,33,10,32,42,32,80,101,114,102,111,114,109,32,99,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,115,97,109,112,108,105,110,103,32,111,110,32,97,32,115,117,98,45,105,109,97,103,101,46,32,79,110,108,121,32,97,118,97,105,108,97,98,108,101,32,105,102,10,32,42,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,32,105,115,32,110,111,116,32,100,101,102,105,110,101,100,46,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,115,112,101,99,105,102,105,101,100,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,121,32,105,109,97,103,101,95,105,110,102,111,10,32,42,32,92,112,97,114,97,109,32,105,109,97,103,101,95,105,110,102,111,32,100,101,115,99,114,105,98,101,115,32,116,104,101,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,97,110,100,32,116,104,101,32,115,117,98,45,105,109,97,103,101,32,119,105,116,104,105,110,32,105,116,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,105,110,32,118,101,99,50,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,41,10,123,10,32,32,118,101,99,52,32,105,109,97,103,101,95,99,111,108,111,114,59,10,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,118,101,99,50,32,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,59,10,32,32,118,101,99,50,32,109,105,110,95,116,105,108,101,95,100,105,115,116,44,32,109,97,120,95,116,105,108,101,95,100,105,115,116,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,59,10,32,32,118,101,99,52,32,120,95,119,101,105,103,104,116,115,44,32,121,95,119,101,105,103,104,116,115,44,32,119,101,105,103,104,116,95,115,117,109,115,44,32,114,101,99,105,112,95,119,101,105,103,104,116,95,115,117,109,115,59,10,32,32,118,101,99,52,32,116,48,48,44,32,116,49,48,44,32,116,48,49,44,32,116,49,49,59,10,32,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,59,10,10,32,32,105,110,100,101,120,95,108,97,121,101,114,32,61,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,108,97,121,101,114,59,10,10,32,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,95,99,108,97,109,112,95,102,111,114,95,99,117,98,105,99,95,102,105,108,116,101,114,105,110,103,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,61,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,99,111,111,114,100,105,110,97,116,101,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,47,42,32,115,108,105,100,101,32,116,104,101,32,105,110,112,117,116,32,99,111,111,114,100,105,110,97,116,101,32,98,121,32,48,46,53,32,105,109,97,103,101,32,116,101,120,101,108,115,32,116,111,32,116,104,101,32,108,101,102,116,47,98,111,116,116,111,109,32,42,47,10,32,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,118,101,99,50,40,48,46,53,32,42,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,41,59,10,10,32,32,47,42,32,110,111,119,32,115,116,111,114,101,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,114,111,111,116,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,42,47,10,32,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,10,32,32,47,42,32,99,111,109,112,117,116,101,32,116,104,101,32,116,105,108,101,32,114,97,110,103,101,32,115,111,32,116,104,97,116,32,119,101,32,99,97,110,32,100,101,99,105,100,101,32,119,104,101,116,104,101,114,32,111,114,32,110,111,116,10,32,32,32,42,32,116,111,32,117,115,101,32,116,104,101,32,115,97,109,112,108,101,114,32,100,105,114,101,99,116,108,121,32,102,111,114,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,46,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,109,112,117,116,101,95,116,105,108,101,95,114,97,110,103,101,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,44,32,109,105,110,95,116,105,108,101,95,100,105,115,116,44,32,109,97,120,95,116,105,108,101,95,100,105,115,116,41,59,10,10,32,32,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,61,32,102,114,97,99,116,40,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,41,59,10,32,32,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,45,61,32,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,59,10,10,32,32,120,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,46,120,41,59,10,32,32,121,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,46,121,41,59,10,32,32,119,101,105,103,104,116,95,115,117,109,115,32,61,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,120,32,43,32,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,122,32,43,32,120,95,119,101,105,103,104,116,115,46,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,121,95,119,101,105,103,104,116,115,46,120,32,43,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,122,32,43,32,121,95,119,101,105,103,104,116,115,46,119,41,59,10,32,32,114,101,99,105,112,95,119,101,105,103,104,116,95,115,117,109,115,32,61,32,118,101,99,52,40,49,46,48,41,32,47,32,119,101,105,103,104,116,95,115,117,109,115,59,10,10,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,121,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,120,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,121,41,59,10,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,119,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,122,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,119,41,59,10,10,32,32,105,102,32,40,109,105,110,95,116,105,108,101,95,100,105,115,116,46,120,32,60,61,32,45,49,46,53,10,32,32,32,32,32,32,38,38,32,109,105,110,95,116,105,108,101,95,100,105,115,116,46,121,32,60,61,32,45,49,46,53,10,32,32,32,32,32,32,38,38,32,109,97,120,95,116,105,108,101,95,100,105,115,116,46,120,32,62,61,32,50,46,53,10,32,32,32,32,32,32,38,38,32,109,97,120,95,116,105,108,101,95,100,105,115,116,46,121,32,62,61,32,50,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,95,116,121,112,101,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,109,97,103,101,95,97,116,108,97,115,95,99,111,111,114,100,40,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,110,117,109,95,108,101,118,101,108,115,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,41,59,10,10,32,32,32,32,32,32,47,42,32,67,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,98,121,32,114,101,97,108,105,122,105,110,103,32,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,32,97,115,32,114,101,112,101,97,116,101,100,10,32,32,32,32,32,32,32,42,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,44,32,115,101,101,32,71,80,85,32,71,101,109,115,32,50,44,32,67,104,97,112,116,101,114,32,50,48,46,10,32,32,32,32,32,32,32,42,32,67,111,100,101,32,105,110,115,112,105,114,101,100,32,98,121,32,83,116,97,99,107,79,118,101,114,102,108,111,119,32,40,104,116,116,112,58,47,47,115,116,97,99,107,111,118,101,114,102,108,111,119,46,99,111,109,47,113,117,101,115,116,105,111,110,115,47,49,51,53,48,49,48,56,49,47,101,102,102,105,99,105,101,110,116,45,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,99,111,100,101,45,105,110,45,103,108,115,108,41,10,32,32,32,32,32,32,32,42,32,97,110,100,32,102,114,111,109,32,83,104,105,110,121,32,80,105,120,101,108,115,32,40,104,116,116,112,58,47,47,118,101,99,51,46,99,97,47,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,105,110,45,102,101,119,101,114,45,116,97,112,115,47,41,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,32,32,32,32,118,101,99,52,32,99,111,114,110,101,114,95,99,111,111,114,100,115,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,59,10,10,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,32,61,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,59,10,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,59,10,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,61,32,116,101,120,101,108,95,99,111,111,114,100,46,120,120,121,121,59,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,120,122,32,45,61,32,118,101,99,50,40,48,46,53,41,59,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,121,119,32,43,61,32,118,101,99,50,40,49,46,53,41,59,10,10,32,32,32,32,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,61,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,43,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,119,44,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,119,41,32,42,32,114,101,99,105,112,95,119,101,105,103,104,116,95,115,117,109,115,59,10,32,32,32,32,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,42,61,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,95,115,105,122,101,95,114,101,99,105,112,114,111,99,97,108,46,120,121,120,121,59,10,10,32,32,32,32,32,32,116,48,48,32,61,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,122,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,32,48,46,48,41,59,10,32,32,32,32,32,32,116,49,48,32,61,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,122,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,32,48,46,48,41,59,10,32,32,32,32,32,32,116,48,49,32,61,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,119,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,32,48,46,48,41,59,10,32,32,32,32,32,32,116,49,49,32,61,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,44,32,118,101,99,51,40,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,119,44,32,97,116,108,97,115,95,108,111,99,97,116,105,111,110,46,108,97,121,101,114,41,44,32,48,46,48,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,109,97,115,116,101,114,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,32,32,32,32,118,101,99,52,32,99,111,114,110,101,114,95,99,111,111,114,100,115,44,32,111,102,102,115,101,116,95,99,111,111,114,100,115,44,32,109,97,115,116,101,114,95,99,111,111,114,100,115,59,10,10,32,32,32,32,32,32,109,97,115,116,101,114,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,109,97,115,116,101,114,95,116,105,108,101,95,116,101,120,101,108,95,99,111,111,114,100,59,10,32,32,32,32,32,32,109,97,115,116,101,114,95,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,102,114,97,99,116,95,105,109,97,103,101,95,99,111,111,114,100,105,110,97,116,101,32,42,32,118,101,99,50,40,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,41,59,10,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,61,32,109,97,115,116,101,114,95,116,101,120,101,108,95,99,111,111,114,100,46,120,120,121,121,59,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,120,122,32,45,61,32,118,101,99,50,40,48,46,53,32,42,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,41,59,10,32,32,32,32,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,121,119,32,43,61,32,118,101,99,50,40,49,46,53,32,42,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,41,59,10,10,32,32,32,32,32,32,111,102,102,115,101,116,95,99,111,111,114,100,115,32,61,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,119,44,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,119,41,32,42,32,114,101,99,105,112,95,119,101,105,103,104,116,95,115,117,109,115,59,10,32,32,32,32,32,32,111,102,102,115,101,116,95,99,111,111,114,100,115,32,42,61,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,10,32,32,32,32,32,32,109,97,115,116,101,114,95,99,111,111,114,100,115,32,61,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,43,32,111,102,102,115,101,116,95,99,111,111,114,100,115,59,10,32,32,32,32,32,32,116,48,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,109,97,115,116,101,114,95,99,111,111,114,100,115,46,120,122,44,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,44,32,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,116,49,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,109,97,115,116,101,114,95,99,111,111,114,100,115,46,121,122,44,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,44,32,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,116,48,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,109,97,115,116,101,114,95,99,111,111,114,100,115,46,120,119,44,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,44,32,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,116,49,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,109,97,115,116,101,114,95,99,111,111,114,100,115,46,121,119,44,32,105,110,100,101,120,95,108,97,121,101,114,44,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,44,32,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,109,105,120,40,109,105,120,40,116,48,48,44,32,116,49,48,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,120,40,116,48,49,44,32,116,49,49,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,41,59,10,10,32,32,114,101,116,117,114,110,32,105,109,97,103,101,95,99,111,108,111,114,59,10,125,10,10,35,101,110,100,105,102,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_atlas_image_fetch.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,47,47,64,99,111,110,100,10,10,47,42,32,109,117,115,116,32,104,97,118,101,32,116,104,101,32,109,97,99,114,111,47,102,117,110,99,116,105,111,110,10,32,42,10,32,42,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,10,32,42,10,32,42,32,116,104,97,116,32,114,101,116,117,114,110,115,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,32,97,116,32,105,110,100,101,120,32,88,32,111,102,10,32,42,32,97,32,108,97,114,103,101,32,97,114,114,97,121,32,111,102,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,115,32,115,116,111,114,105,110,103,32,116,104,101,32,100,97,116,97,10,32,42,10,32,42,32,97,110,100,32,111,112,116,105,111,110,97,108,108,121,32,100,101,102,105,110,101,32,116,104,101,32,109,97,99,114,111,47,102,117,110,99,116,105,111,110,10,32,42,10,32,42,32,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,10,32,42,10,32,42,32,116,104,101,32,114,101,97,100,115,32,97,32,115,105,110,103,108,101,32,51,50,45,98,105,116,32,117,105,110,116,32,118,97,108,117,101,32,116,104,97,116,32,105,115,32,98,105,116,45,99,97,115,116,101,100,10,32,42,32,116,111,32,97,32,40,102,112,49,54,44,32,102,112,49,54,41,32,112,97,105,114,32,114,101,97,108,105,122,101,100,32,97,115,32,97,32,118,101,99,50,46,32,70,111,114,32,101,120,97,109,112,108,101,10,32,42,32,105,116,32,99,97,110,32,98,101,32,100,101,102,105,110,101,100,32,97,115,10,32,42,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,41,10,32,42,47,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,98,97,110,100,10,123,10,32,32,117,105,110,116,32,110,117,109,95,99,117,114,118,101,115,59,10,32,32,117,105,110,116,32,99,117,114,118,101,95,111,102,102,115,101,116,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,10,123,10,32,32,118,101,99,50,32,112,48,44,32,112,49,44,32,112,50,59,10,125,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,98,97,110,100,40,105,110,32,117,105,110,116,32,108,111,99,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,98,97,110,100,32,98,97,110,100,41,10,123,10,32,32,117,105,110,116,32,114,97,119,59,10,10,32,32,114,97,119,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,108,111,99,41,59,10,32,32,98,97,110,100,46,110,117,109,95,99,117,114,118,101,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,110,117,109,99,117,114,118,101,115,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,110,117,109,99,117,114,118,101,115,95,110,117,109,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,41,59,10,32,32,98,97,110,100,46,99,117,114,118,101,95,111,102,102,115,101,116,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,111,102,102,115,101,116,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,111,102,102,115,101,116,95,110,117,109,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,97,119,41,59,10,125,10,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,112,111,105,110,116,40,105,110,32,117,105,110,116,32,108,111,99,41,10,123,10,32,32,35,105,102,32,33,100,101,102,105,110,101,100,40,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,114,97,119,59,10,32,32,32,32,32,32,114,97,119,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,108,111,99,41,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,114,97,119,41,59,10,32,32,32,32,125,10,32,32,35,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,108,111,99,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,99,117,114,118,101,40,105,110,32,117,105,110,116,32,108,111,99,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,32,99,117,114,118,101,41,10,123,10,32,32,47,42,32,97,32,114,101,97,115,111,110,97,98,108,101,32,115,104,97,100,101,114,32,99,111,109,112,105,108,101,114,32,115,104,111,117,108,100,32,114,101,45,111,114,100,101,114,32,115,111,32,116,104,97,116,32,116,104,101,32,114,101,97,100,115,32,111,102,10,32,32,32,42,32,116,104,101,32,99,117,114,118,101,32,100,97,116,97,32,99,111,109,101,32,102,105,114,115,116,32,102,111,108,108,111,119,101,100,32,98,121,32,116,104,101,32,97,115,115,105,103,110,109,101,110,116,32,111,102,32,118,97,108,117,101,115,46,10,32,32,32,42,47,10,32,32,99,117,114,118,101,46,112,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,112,111,105,110,116,40,108,111,99,41,59,10,32,32,99,117,114,118,101,46,112,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,112,111,105,110,116,40,108,111,99,32,43,32,49,117,41,59,10,32,32,99,117,114,118,101,46,112,50,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,112,111,105,110,116,40,108,111,99,32,43,32,50,117,41,59,10,125,10,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,105,110,116,101,114,115,101,99,116,95,121,95,101,113,117,97,108,115,95,48,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,32,99,117,114,118,101,41,10,123,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,116,105,110,121,32,61,32,48,46,48,48,48,49,59,10,32,32,102,108,111,97,116,32,114,65,44,32,68,44,32,116,49,44,32,116,50,44,32,120,49,44,32,120,50,59,10,32,32,118,101,99,50,32,65,44,32,66,44,32,67,59,10,10,32,32,47,42,32,84,104,101,32,99,117,114,118,101,32,105,115,32,103,105,118,101,110,32,98,121,10,32,32,32,42,32,32,102,40,116,41,32,61,32,40,49,45,116,41,94,50,32,112,48,32,43,32,50,116,40,116,45,49,41,32,112,49,32,43,32,116,94,50,32,112,50,10,32,32,32,42,32,32,32,32,32,32,32,61,32,65,32,116,94,50,32,45,32,50,66,32,116,32,43,32,67,10,32,32,32,42,10,32,32,32,42,32,119,104,105,99,104,32,103,105,118,101,115,10,32,32,32,42,10,32,32,32,42,32,32,65,32,61,32,112,48,32,45,32,50,112,49,32,43,32,112,50,10,32,32,32,42,32,32,66,32,61,32,112,48,32,45,32,112,49,10,32,32,32,42,32,32,67,32,61,32,112,48,10,32,32,32,42,47,10,32,32,65,32,61,32,99,117,114,118,101,46,112,48,32,45,32,50,46,48,32,42,32,99,117,114,118,101,46,112,49,32,43,32,99,117,114,118,101,46,112,50,59,10,32,32,66,32,61,32,99,117,114,118,101,46,112,48,32,45,32,99,117,114,118,101,46,112,49,59,10,32,32,67,32,61,32,99,117,114,118,101,46,112,48,59,10,10,32,32,114,65,32,61,32,49,46,48,32,47,32,65,46,121,59,10,32,32,68,32,61,32,115,113,114,116,40,109,97,120,40,66,46,121,32,42,32,66,46,121,32,45,32,65,46,121,32,42,32,67,46,121,44,32,48,46,48,41,41,59,10,32,32,116,49,32,61,32,40,66,46,121,32,45,32,68,41,32,42,32,114,65,59,10,32,32,116,50,32,61,32,40,66,46,121,32,43,32,68,41,32,42,32,114,65,59,10,10,32,32,105,102,32,40,97,98,115,40,65,46,121,41,32,60,32,116,105,110,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,49,32,61,32,116,50,32,61,32,48,46,53,32,42,32,67,46,121,32,47,32,66,46,121,59,10,32,32,32,32,125,10,10,32,32,120,49,32,61,32,40,65,46,120,32,42,32,116,49,32,45,32,66,46,120,32,42,32,50,46,48,41,32,42,32,116,49,32,43,32,67,46,120,59,10,32,32,120,50,32,61,32,40,65,46,120,32,42,32,116,50,32,45,32,66,46,120,32,42,32,50,46,48,41,32,42,32,116,50,32,43,32,67,46,120,59,10,32,32,114,101,116,117,114,110,32,118,101,99,50,40,120,49,44,32,120,50,41,59,10,125,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,121,95,101,113,117,97,108,115,95,48,95,99,111,100,101,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,32,99,117,114,118,101,41,10,123,10,32,32,117,105,110,116,32,99,111,100,101,59,10,32,32,47,42,32,84,79,68,79,58,32,116,104,101,114,101,32,97,114,101,32,102,97,115,116,101,114,32,119,97,121,115,32,116,111,32,103,101,116,32,116,104,101,32,99,111,100,101,32,98,121,10,32,32,32,42,32,101,120,112,108,111,105,116,105,110,103,32,116,104,101,32,101,120,112,101,99,116,101,100,32,98,105,116,45,112,97,116,116,101,114,110,115,32,102,111,114,32,102,108,111,97,116,115,10,32,32,32,42,47,10,32,32,99,111,100,101,32,61,32,40,40,99,117,114,118,101,46,112,48,46,121,32,62,32,48,46,48,41,32,63,32,50,117,32,58,32,48,117,41,10,32,32,32,32,124,32,40,40,99,117,114,118,101,46,112,49,46,121,32,62,32,48,46,48,41,32,63,32,52,117,32,58,32,48,117,41,10,32,32,32,32,124,32,40,40,99,117,114,118,101,46,112,50,46,121,32,62,32,48,46,48,41,32,63,32,56,117,32,58,32,48,117,41,59,10,32,32,99,111,100,101,32,61,32,40,48,120,50,69,55,52,117,32,62,62,32,99,111,100,101,41,32,38,32,48,120,51,117,59,10,32,32,114,101,116,117,114,110,32,99,111,100,101,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,95,102,114,111,109,95,98,97,110,100,40,105,110,32,117,105,110,116,32,99,117,114,118,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,95,99,117,114,118,101,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,101,109,44,32,105,110,32,102,108,111,97,116,32,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,99,111,118,101,114,97,103,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,41,10,123,10,32,32,99,111,118,101,114,97,103,101,32,61,32,48,46,48,59,10,32,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,32,61,32,48,46,53,59,10,32,32,102,111,114,32,40,117,105,110,116,32,99,32,61,32,48,117,44,32,99,117,114,118,101,95,115,114,99,32,61,32,99,117,114,118,101,95,111,102,102,115,101,116,59,32,99,32,60,32,110,117,109,95,99,117,114,118,101,115,59,32,99,117,114,118,101,95,115,114,99,32,43,61,32,51,117,44,32,43,43,99,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,117,114,118,101,32,99,117,114,118,101,59,10,32,32,32,32,32,32,117,105,110,116,32,99,111,100,101,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,99,117,114,118,101,40,99,117,114,118,101,95,115,114,99,44,32,99,117,114,118,101,41,59,10,10,32,32,32,32,32,32,47,42,32,116,114,97,110,115,108,97,116,101,32,116,104,101,32,99,117,114,118,101,32,115,111,32,116,104,97,116,32,103,108,121,112,104,95,99,111,111,114,100,32,105,115,32,116,104,101,32,111,114,105,103,105,110,32,42,47,10,32,32,32,32,32,32,99,117,114,118,101,46,112,48,32,45,61,32,103,108,121,112,104,95,99,111,111,114,100,59,10,32,32,32,32,32,32,99,117,114,118,101,46,112,49,32,45,61,32,103,108,121,112,104,95,99,111,111,114,100,59,10,32,32,32,32,32,32,99,117,114,118,101,46,112,50,32,45,61,32,103,108,121,112,104,95,99,111,111,114,100,59,10,10,32,32,32,32,32,32,105,102,32,40,115,32,62,32,48,46,48,32,38,38,32,109,97,120,40,99,117,114,118,101,46,112,48,46,120,44,32,109,97,120,40,99,117,114,118,101,46,112,49,46,120,44,32,99,117,114,118,101,46,112,50,46,120,41,41,32,42,32,101,109,32,60,32,45,48,46,53,41,32,98,114,101,97,107,59,10,32,32,32,32,32,32,105,102,32,40,115,32,60,32,48,46,48,32,38,38,32,109,105,110,40,99,117,114,118,101,46,112,48,46,120,44,32,109,105,110,40,99,117,114,118,101,46,112,49,46,120,44,32,99,117,114,118,101,46,112,50,46,120,41,41,32,42,32,101,109,32,62,32,48,46,53,41,32,98,114,101,97,107,59,10,10,32,32,32,32,32,32,99,111,100,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,121,95,101,113,117,97,108,115,95,48,95,99,111,100,101,40,99,117,114,118,101,41,59,10,32,32,32,32,32,32,105,102,32,40,99,111,100,101,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,120,49,120,50,59,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,120,49,44,32,120,50,59,10,10,32,32,32,32,32,32,32,32,32,32,120,49,120,50,32,61,32,101,109,32,42,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,105,110,116,101,114,115,101,99,116,95,121,95,101,113,117,97,108,115,95,48,40,99,117,114,118,101,41,59,10,32,32,32,32,32,32,32,32,32,32,120,49,32,61,32,120,49,120,50,46,120,59,10,32,32,32,32,32,32,32,32,32,32,120,50,32,61,32,120,49,120,50,46,121,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,99,111,100,101,32,38,32,49,117,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,32,43,61,32,99,108,97,109,112,40,48,46,53,32,43,32,120,49,32,42,32,115,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,32,61,32,109,105,110,40,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,44,32,97,98,115,40,120,49,41,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,99,111,100,101,32,62,32,49,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,32,45,61,32,99,108,97,109,112,40,48,46,53,32,43,32,120,50,32,42,32,115,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,32,61,32,109,105,110,40,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,44,32,97,98,115,40,120,50,41,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,99,111,118,101,114,97,103,101,32,61,32,97,98,115,40,99,111,118,101,114,97,103,101,41,59,10,125,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,32,116,104,101,32,99,111,118,101,114,97,103,101,32,111,102,32,97,32,102,114,97,103,109,101,110,116,32,119,105,116,104,105,110,32,97,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,66,97,110,100,101,100,82,97,121,115,32,103,108,121,112,104,46,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,32,103,108,121,112,104,32,100,97,116,97,32,40,115,101,101,32,92,114,101,102,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,66,97,110,100,101,100,82,97,121,115,58,58,103,108,121,112,104,95,111,102,102,115,101,116,41,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,99,111,111,114,100,32,116,104,101,32,99,111,111,114,100,105,110,97,116,101,32,111,102,32,116,104,101,32,102,114,97,103,109,101,110,116,32,105,110,32,103,108,121,112,104,32,99,111,111,114,100,105,110,97,116,101,115,10,32,42,32,92,112,97,114,97,109,32,103,108,121,112,104,95,99,111,111,114,100,95,102,119,105,100,116,104,32,116,104,101,32,118,97,108,117,101,32,111,102,32,102,119,105,100,116,104,40,103,108,121,112,104,95,99,111,111,114,100,41,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,118,101,114,116,105,99,97,108,32,98,97,110,100,115,32,111,102,32,116,104,101,32,103,108,121,112,104,44,32,115,101,101,32,92,114,101,102,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,66,97,110,100,101,100,82,97,121,115,58,58,103,108,121,112,104,95,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,104,111,114,105,122,111,110,116,97,108,32,98,97,110,100,115,32,111,102,32,116,104,101,32,103,108,121,112,104,44,32,115,101,101,32,92,114,101,102,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,58,58,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,66,97,110,100,101,100,82,97,121,115,58,58,103,108,121,112,104,95,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,10,32,42,32,92,112,97,114,97,109,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,32,105,102,32,116,114,117,101,44,32,117,115,101,32,116,104,101,32,111,100,100,45,101,118,101,110,32,102,105,108,108,32,114,117,108,101,44,32,111,116,104,101,114,119,105,115,101,32,117,115,101,32,116,104,101,32,110,111,110,45,122,101,114,111,32,102,105,108,108,32,114,117,108,101,46,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,40,105,110,32,117,105,110,116,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,99,111,111,114,100,95,102,119,105,100,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,41,10,123,10,32,32,117,105,110,116,32,104,111,114,105,122,95,98,97,110,100,95,111,102,102,115,101,116,44,32,118,101,114,116,95,98,97,110,100,95,111,102,102,115,101,116,59,10,32,32,117,105,110,116,32,99,44,32,99,117,114,118,101,95,115,114,99,44,32,110,117,109,95,99,117,114,118,101,115,44,32,99,117,114,118,101,95,111,102,102,115,101,116,59,10,32,32,118,101,99,50,32,101,109,44,32,98,97,110,100,95,102,97,99,116,111,114,59,10,32,32,118,101,99,50,32,99,111,118,101,114,97,103,101,44,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,59,10,32,32,102,108,111,97,116,32,99,118,103,44,32,119,116,59,10,32,32,102,108,111,97,116,32,115,120,44,32,115,121,59,10,32,32,117,105,110,116,32,104,111,114,105,122,95,98,97,110,100,44,32,118,101,114,116,95,98,97,110,100,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,98,97,110,100,32,104,111,114,105,122,95,98,97,110,100,95,100,97,116,97,44,32,118,101,114,116,95,98,97,110,100,95,100,97,116,97,59,10,10,32,32,101,109,32,61,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,32,47,32,103,108,121,112,104,95,99,111,111,114,100,95,102,119,105,100,116,104,59,10,10,32,32,47,42,32,71,108,121,112,104,32,99,111,111,114,100,32,118,97,114,105,101,115,32,45,101,120,97,99,116,108,121,45,32,97,115,32,91,45,71,44,32,71,93,120,91,45,71,44,32,71,93,10,32,32,32,42,32,119,104,101,114,101,32,71,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,46,10,32,32,32,42,32,83,111,32,116,111,32,102,105,103,117,114,101,32,111,117,116,32,119,104,105,99,104,32,98,97,110,100,44,32,119,101,32,110,101,101,100,32,116,111,32,114,101,110,111,114,109,97,108,105,122,101,100,10,32,32,32,42,32,91,45,71,44,32,71,93,120,91,45,71,44,32,71,93,32,116,111,32,91,48,44,32,86,93,120,91,48,44,32,72,93,46,10,32,32,32,42,47,10,32,32,98,97,110,100,95,102,97,99,116,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,104,97,108,102,95,114,101,99,105,112,32,42,32,118,101,99,50,40,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,44,32,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,41,59,10,32,32,118,101,114,116,95,98,97,110,100,32,61,32,109,105,110,40,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,32,45,32,49,117,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,40,98,97,110,100,95,102,97,99,116,111,114,46,120,32,42,32,40,103,108,121,112,104,95,99,111,111,114,100,46,120,32,43,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,41,41,41,59,10,32,32,104,111,114,105,122,95,98,97,110,100,32,61,32,109,105,110,40,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,32,45,32,49,117,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,40,98,97,110,100,95,102,97,99,116,111,114,46,121,32,42,32,40,103,108,121,112,104,95,99,111,111,114,100,46,121,32,43,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,41,41,41,59,10,10,32,32,47,42,32,99,104,111,111,115,101,32,119,104,105,99,104,32,98,97,110,100,115,32,42,47,10,32,32,104,111,114,105,122,95,98,97,110,100,95,111,102,102,115,101,116,32,61,32,104,111,114,105,122,95,98,97,110,100,59,10,32,32,105,102,32,40,103,108,121,112,104,95,99,111,111,114,100,46,120,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,104,111,114,105,122,95,98,97,110,100,95,111,102,102,115,101,116,32,43,61,32,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,59,10,32,32,32,32,32,32,115,120,32,61,32,45,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,115,120,32,61,32,49,46,48,59,10,32,32,32,32,125,10,10,32,32,118,101,114,116,95,98,97,110,100,95,111,102,102,115,101,116,32,61,32,118,101,114,116,95,98,97,110,100,32,43,32,50,117,32,42,32,110,117,109,95,104,111,114,105,122,111,110,116,97,108,95,98,97,110,100,115,59,10,32,32,105,102,32,40,103,108,121,112,104,95,99,111,111,114,100,46,121,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,114,116,95,98,97,110,100,95,111,102,102,115,101,116,32,43,61,32,110,117,109,95,118,101,114,116,105,99,97,108,95,98,97,110,100,115,59,10,32,32,32,32,32,32,115,121,32,61,32,45,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,115,121,32,61,32,43,49,46,48,59,10,32,32,32,32,125,10,10,32,32,47,42,32,108,111,97,100,32,116,104,101,32,104,111,114,105,122,111,110,116,97,108,32,97,110,100,32,118,101,114,116,105,99,97,108,32,98,97,110,100,32,104,101,97,100,101,114,115,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,98,97,110,100,40,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,43,32,104,111,114,105,122,95,98,97,110,100,95,111,102,102,115,101,116,44,32,104,111,114,105,122,95,98,97,110,100,95,100,97,116,97,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,108,111,97,100,95,98,97,110,100,40,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,43,32,118,101,114,116,95,98,97,110,100,95,111,102,102,115,101,116,44,32,118,101,114,116,95,98,97,110,100,95,100,97,116,97,41,59,10,10,32,32,47,42,32,84,79,68,79,58,32,105,115,32,105,116,32,98,101,116,116,101,114,32,116,111,32,104,97,118,101,32,97,32,99,111,109,109,111,110,32,108,111,111,112,32,119,105,116,104,32,115,108,105,103,104,116,108,121,32,109,111,114,101,32,105,99,107,121,32,108,111,103,105,99,32,105,110,115,105,100,101,10,32,32,32,42,32,116,111,32,104,97,110,100,108,101,32,98,111,116,104,32,99,97,115,101,115,32,115,105,109,117,116,97,110,101,111,117,115,108,121,32,111,114,32,116,111,32,104,97,118,101,32,97,32,116,111,112,32,108,101,118,101,108,32,105,102,40,41,32,97,110,100,32,101,97,99,104,32,99,97,115,101,10,32,32,32,42,32,104,97,115,32,116,104,101,105,114,32,111,119,110,32,108,111,111,112,63,10,32,32,32,42,32,32,80,114,111,115,32,102,111,114,32,99,111,109,109,111,110,32,108,111,111,112,58,32,105,102,32,102,114,97,103,109,101,110,116,115,32,97,114,101,32,97,99,114,111,115,115,32,116,104,101,32,108,105,110,101,32,119,105,116,104,32,97,32,115,105,110,103,108,101,32,102,114,97,103,45,115,104,97,100,101,114,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,112,97,116,99,104,44,32,116,104,105,115,32,115,105,103,110,105,102,105,99,97,110,116,108,121,32,114,101,100,117,99,101,115,32,116,104,101,32,99,111,100,101,32,100,105,118,101,114,103,101,110,99,101,10,32,32,32,42,10,32,32,32,42,32,32,67,111,110,115,32,102,111,114,32,99,111,109,109,111,110,32,108,111,111,112,58,32,87,101,32,97,100,100,32,40,117,112,32,116,111,41,32,116,119,111,32,109,117,108,116,105,112,108,105,101,115,32,112,101,114,32,99,117,114,118,101,32,40,116,104,101,32,115,120,32,109,117,108,116,105,112,108,121,41,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,110,100,32,97,110,32,97,100,100,105,116,105,111,110,97,108,32,50,45,109,105,110,115,32,111,114,32,50,45,109,97,120,101,115,32,112,101,114,32,99,117,114,118,101,32,102,111,114,32,116,104,101,32,101,97,114,108,121,10,32,32,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,116,101,115,116,46,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,95,102,114,111,109,95,98,97,110,100,40,104,111,114,105,122,95,98,97,110,100,95,100,97,116,97,46,99,117,114,118,101,95,111,102,102,115,101,116,32,43,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,104,111,114,105,122,95,98,97,110,100,95,100,97,116,97,46,110,117,109,95,99,117,114,118,101,115,44,32,103,108,121,112,104,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,109,46,120,44,32,115,120,44,32,99,111,118,101,114,97,103,101,46,120,44,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,46,120,41,59,10,10,32,32,47,42,32,116,104,101,32,99,117,114,118,101,115,32,102,111,114,32,116,104,101,32,118,101,114,116,105,99,97,108,32,98,97,110,100,115,32,97,114,101,32,115,97,118,101,100,32,119,105,116,104,32,116,104,101,32,120,45,99,111,111,114,100,105,110,97,116,101,10,32,32,32,42,32,97,110,100,32,121,45,99,111,111,114,100,105,110,97,116,101,32,115,119,97,112,112,101,100,59,32,116,104,105,115,32,119,97,121,32,119,101,32,99,97,110,32,97,118,111,105,100,32,119,114,105,116,105,110,103,32,109,111,114,101,10,32,32,32,42,32,114,111,117,116,105,110,101,115,32,40,116,111,32,104,97,110,100,108,101,32,116,104,101,32,120,121,45,115,119,97,112,112,105,110,103,41,32,97,110,100,32,106,117,115,116,32,115,119,97,112,32,116,104,101,32,120,121,45,99,111,111,114,100,115,10,32,32,32,42,32,111,102,32,103,108,121,112,104,95,99,111,111,114,100,115,46,10,32,32,32,42,47,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,97,110,100,101,100,95,114,97,121,115,95,99,111,109,112,117,116,101,95,99,111,118,101,114,97,103,101,95,102,114,111,109,95,98,97,110,100,40,118,101,114,116,95,98,97,110,100,95,100,97,116,97,46,99,117,114,118,101,95,111,102,102,115,101,116,32,43,32,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,114,116,95,98,97,110,100,95,100,97,116,97,46,110,117,109,95,99,117,114,118,101,115,44,32,103,108,121,112,104,95,99,111,111,114,100,46,121,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,109,46,121,44,32,115,121,44,32,99,111,118,101,114,97,103,101,46,121,44,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,46,121,41,59,10,10,32,32,47,42,32,87,101,32,115,117,112,112,111,114,116,32,116,104,101,32,111,100,100,45,101,118,101,110,32,102,105,108,108,32,114,117,108,101,32,98,121,32,114,101,109,111,118,105,110,103,10,32,32,32,42,32,116,104,101,32,34,50,110,34,32,112,97,114,116,32,111,102,32,99,111,118,101,114,97,103,101,46,10,32,32,32,42,47,10,32,32,105,102,32,40,117,115,101,95,111,100,100,95,101,118,101,110,95,114,117,108,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,99,111,118,101,114,97,103,101,32,61,32,50,46,48,32,42,32,102,114,97,99,116,40,48,46,53,32,42,32,99,111,118,101,114,97,103,101,41,59,10,32,32,32,32,125,10,10,32,32,47,42,32,87,101,32,97,115,115,105,103,110,32,97,32,119,101,105,103,104,116,32,116,111,32,101,97,99,104,32,111,102,32,116,104,101,32,99,111,118,101,114,97,103,101,32,118,97,108,117,101,115,32,102,114,111,109,32,104,111,119,32,99,108,111,115,101,32,116,104,101,10,32,32,32,42,32,99,108,111,115,101,115,32,99,117,114,118,101,32,105,115,32,116,111,32,116,104,101,32,115,97,109,112,108,101,32,112,111,105,110,116,46,32,65,32,99,117,114,118,101,32,111,110,108,121,32,115,116,97,114,116,115,32,116,111,32,112,114,111,118,105,100,101,10,32,32,32,42,32,97,110,116,105,45,97,108,105,97,115,105,110,103,32,105,102,32,105,116,32,105,115,32,119,105,116,104,105,110,32,104,97,108,102,32,97,32,112,105,120,101,108,32,111,102,32,116,104,101,32,115,97,109,112,108,101,32,112,111,105,110,116,32,40,97,116,10,32,32,32,42,32,103,108,121,112,104,45,99,111,111,114,100,41,32,97,110,100,32,116,104,101,32,99,97,108,99,117,108,97,116,105,111,110,32,105,115,32,100,111,110,101,32,115,111,32,116,104,97,116,32,101,97,99,104,32,99,111,109,112,111,110,101,110,116,32,111,102,10,32,32,32,42,32,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,32,105,115,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,48,46,53,93,46,10,32,32,32,42,47,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,116,105,110,121,32,61,32,48,46,48,48,49,59,10,32,32,102,108,111,97,116,32,119,101,105,103,104,116,95,115,117,109,59,10,32,32,118,101,99,50,32,119,101,105,103,104,116,59,10,10,32,32,119,101,105,103,104,116,32,61,32,118,101,99,50,40,49,46,48,41,32,45,32,50,46,48,32,42,32,99,108,97,109,112,40,97,98,115,40,110,101,97,114,101,115,116,95,99,117,114,118,101,95,100,105,115,116,97,110,99,101,41,44,32,48,46,48,44,32,48,46,53,41,59,10,32,32,119,101,105,103,104,116,95,115,117,109,32,61,32,119,101,105,103,104,116,46,120,32,43,32,119,101,105,103,104,116,46,121,59,10,10,32,32,47,42,32,85,115,101,32,116,104,101,32,119,105,101,103,104,116,101,100,32,115,117,109,32,111,102,32,116,104,101,32,99,111,118,101,114,97,103,101,32,118,97,108,117,101,115,32,102,111,114,32,116,104,101,32,102,105,110,97,108,10,32,32,32,42,32,99,111,118,101,114,97,103,101,46,32,73,102,32,116,104,101,32,115,117,109,32,111,102,32,116,104,101,32,119,101,105,103,104,116,115,32,105,115,32,115,109,97,108,108,44,32,116,104,97,116,32,105,110,100,105,99,97,116,101,115,10,32,32,32,42,32,116,104,97,116,32,116,104,101,32,110,101,97,114,101,115,116,32,99,117,114,118,101,32,40,105,110,32,98,111,116,104,32,100,105,109,101,110,115,105,111,110,115,41,32,105,115,32,109,111,114,101,32,116,104,97,110,10,32,32,32,42,32,104,97,108,102,32,97,32,112,105,120,101,108,32,97,119,97,121,46,32,73,110,32,116,104,97,116,32,99,97,115,101,44,32,105,116,32,109,101,97,110,115,32,116,104,97,116,32,119,101,32,114,101,103,97,114,100,10,32,32,32,42,32,116,104,101,32,112,105,120,101,108,32,97,115,32,102,117,108,108,32,99,111,118,101,114,101,100,32,111,114,32,102,117,108,108,32,117,110,99,111,118,101,114,101,100,44,32,116,104,117,115,32,116,104,101,10,32,32,32,42,32,99,111,118,101,114,97,103,101,32,118,97,108,117,101,32,115,104,111,117,108,100,32,98,101,32,48,32,111,114,32,49,32,105,110,32,101,97,99,104,32,100,105,109,101,110,115,105,111,110,46,32,84,111,32,98,101,10,32,32,32,42,32,115,97,102,101,44,32,119,101,32,116,97,107,101,32,116,104,101,32,97,118,101,114,97,103,101,32,116,104,111,117,103,104,46,10,32,32,32,42,47,10,32,32,99,118,103,32,61,32,40,119,101,105,103,104,116,95,115,117,109,32,62,32,116,105,110,121,41,32,63,10,32,32,32,32,100,111,116,40,99,111,118,101,114,97,103,101,44,32,119,101,105,103,104,116,41,32,47,32,119,101,105,103,104,116,95,115,117,109,32,58,10,32,32,32,32,48,46,53,32,42,32,40,99,111,118,101,114,97,103,101,46,120,32,43,32,99,111,118,101,114,97,103,101,46,121,41,59,10,10,32,32,114,101,116,117,114,110,32,99,118,103,59,10,125,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_banded_rays.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
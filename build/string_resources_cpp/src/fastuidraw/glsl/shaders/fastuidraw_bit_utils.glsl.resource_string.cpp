@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,105,116,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,105,116,95,117,116,105,108,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,42,33,10,32,42,32,85,116,105,108,105,116,121,32,102,117,110,99,116,105,111,110,32,116,111,32,101,120,116,114,97,99,116,32,98,105,116,115,32,102,114,111,109,32,97,110,32,117,105,110,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,98,105,116,48,32,115,116,97,114,116,105,110,103,32,98,105,116,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,117,110,112,97,99,107,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,98,105,116,115,32,110,117,109,98,101,114,32,98,105,116,115,32,116,111,32,117,110,112,97,99,107,10,32,42,32,92,112,97,114,97,109,32,115,114,99,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,117,110,112,97,99,107,10,32,42,47,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,101,120,116,114,97,99,116,95,98,105,116,115,40,117,105,110,116,32,98,105,116,48,44,32,117,105,110,116,32,110,117,109,95,98,105,116,115,44,32,117,105,110,116,32,115,114,99,41,10,123,10,32,32,114,101,116,117,114,110,32,40,115,114,99,32,60,60,32,40,51,50,117,32,45,32,98,105,116,48,32,45,32,110,117,109,95,98,105,116,115,41,41,32,62,62,32,40,51,50,117,32,45,32,110,117,109,95,98,105,116,115,41,59,10,125,10,10,47,42,33,10,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,98,105,116,48,44,32,110,117,109,95,98,105,116,115,44,32,115,114,99,41,10,32,42,32,77,97,99,114,111,32,116,104,97,116,32,119,114,97,112,115,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,101,120,116,114,97,99,116,95,98,105,116,115,40,41,32,115,111,32,116,104,97,116,10,32,42,32,101,97,99,104,32,97,114,103,117,109,101,110,116,32,105,115,32,99,97,115,116,101,100,32,105,110,116,111,32,97,32,117,105,110,116,46,10,32,42,32,92,112,97,114,97,109,32,98,105,116,48,32,115,116,97,114,116,105,110,103,32,98,105,116,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,117,110,112,97,99,107,10,32,42,32,92,112,97,114,97,109,32,110,117,109,95,98,105,116,115,32,110,117,109,98,101,114,32,98,105,116,115,32,116,111,32,117,110,112,97,99,107,10,32,42,32,92,112,97,114,97,109,32,115,114,99,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,117,110,112,97,99,107,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,98,105,116,48,44,32,110,117,109,95,98,105,116,115,44,32,115,114,99,41,32,92,10,32,32,102,97,115,116,117,105,100,114,97,119,95,101,120,116,114,97,99,116,95,98,105,116,115,40,117,105,110,116,40,98,105,116,48,41,44,32,117,105,110,116,40,110,117,109,95,98,105,116,115,41,44,32,117,105,110,116,40,115,114,99,41,41,10,10,47,42,33,10,32,42,32,70,117,110,99,116,105,111,110,32,116,104,97,116,32,100,111,101,115,32,110,111,116,104,105,110,103,32,40,105,46,101,46,32,117,116,116,101,114,108,121,32,101,109,112,116,121,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,10,32,42,32,99,111,110,116,101,110,116,115,41,46,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,118,111,105,100,41,10,123,125,10,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_bit_utils.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
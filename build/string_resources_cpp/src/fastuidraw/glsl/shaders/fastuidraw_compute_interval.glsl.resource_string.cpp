@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,32,77,117,115,116,32,98,101,32,100,101,102,105,110,101,100,58,10,32,42,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,85,84,69,95,73,78,84,69,82,86,65,76,95,78,65,77,69,32,116,111,32,98,101,32,110,97,109,101,32,111,102,32,116,104,101,32,102,117,110,99,116,105,111,110,10,32,42,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,85,84,69,95,73,78,84,69,82,86,65,76,95,70,69,84,67,72,95,68,65,84,65,40,88,41,32,116,111,32,108,111,97,100,115,32,97,32,117,118,101,99,52,32,118,97,108,117,101,32,97,116,32,88,10,32,42,47,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,105,110,32,117,105,110,116,32,105,110,116,101,114,118,97,108,115,95,108,111,99,97,116,105,111,110,44,32,105,110,32,102,108,111,97,116,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,32,105,110,32,102,108,111,97,116,32,105,110,95,100,105,115,116,97,110,99,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,105,110,116,101,114,118,97,108,95,73,68,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,111,117,116,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,101,110,100,41,10,123,10,32,32,105,110,116,32,108,111,99,59,10,32,32,102,108,111,97,116,32,100,44,32,108,97,115,116,100,44,32,102,102,44,32,102,100,59,10,10,32,32,102,100,32,61,32,102,108,111,111,114,40,105,110,95,100,105,115,116,97,110,99,101,32,47,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,41,59,10,32,32,102,102,32,61,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,42,32,102,100,59,10,32,32,100,32,61,32,105,110,95,100,105,115,116,97,110,99,101,32,45,32,102,102,59,10,32,32,108,97,115,116,100,32,61,32,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,59,10,32,32,108,111,99,32,61,32,48,59,10,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,48,46,48,59,10,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,48,46,48,59,10,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,45,49,59,10,10,32,32,47,42,32,84,79,68,79,58,10,32,32,32,42,32,32,67,104,97,110,103,101,32,104,111,119,32,119,101,32,112,97,99,107,32,105,110,116,101,114,118,97,108,32,115,101,113,117,101,110,99,101,115,32,115,111,32,116,104,97,116,10,32,32,32,42,32,32,119,101,32,99,97,110,32,99,104,97,110,103,101,32,116,104,101,32,115,101,97,114,99,104,32,102,114,111,109,32,79,40,78,41,32,116,111,32,79,40,108,111,103,32,78,41,10,32,32,32,42,47,10,32,32,100,111,10,32,32,32,32,123,10,32,32,32,32,32,32,117,118,101,99,52,32,86,59,10,32,32,32,32,32,32,118,101,99,52,32,102,86,59,10,10,32,32,32,32,32,32,86,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,108,111,99,32,43,32,105,110,116,40,105,110,116,101,114,118,97,108,115,95,108,111,99,97,116,105,111,110,41,41,46,120,121,122,119,59,10,32,32,32,32,32,32,102,86,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,86,41,59,10,10,32,32,32,32,32,32,105,102,32,40,100,32,60,32,102,86,46,120,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,102,102,32,43,32,108,97,115,116,100,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,102,102,32,43,32,102,86,46,120,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,105,110,116,40,52,41,32,42,32,108,111,99,32,43,32,105,110,116,40,48,41,32,43,32,105,110,116,40,102,100,41,32,42,32,105,110,116,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,108,97,115,116,100,32,61,32,50,46,48,32,42,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,43,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,121,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,102,102,32,43,32,102,86,46,120,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,102,102,32,43,32,102,86,46,121,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,105,110,116,40,52,41,32,42,32,108,111,99,32,43,32,105,110,116,40,49,41,32,43,32,105,110,116,40,102,100,41,32,42,32,105,110,116,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,108,97,115,116,100,32,61,32,50,46,48,32,42,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,43,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,122,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,102,102,32,43,32,102,86,46,121,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,102,102,32,43,32,102,86,46,122,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,105,110,116,40,52,41,32,42,32,108,111,99,32,43,32,105,110,116,40,50,41,32,43,32,105,110,116,40,102,100,41,32,42,32,105,110,116,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,108,97,115,116,100,32,61,32,50,46,48,32,42,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,43,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,100,32,60,32,102,86,46,119,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,61,32,102,102,32,43,32,102,86,46,122,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,101,110,100,32,61,32,102,102,32,43,32,102,86,46,119,59,10,32,32,32,32,32,32,32,32,32,32,105,110,116,101,114,118,97,108,95,73,68,32,61,32,105,110,116,40,52,41,32,42,32,108,111,99,32,43,32,105,110,116,40,51,41,32,43,32,105,110,116,40,102,100,41,32,42,32,105,110,116,40,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,41,59,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,108,97,115,116,100,32,61,32,50,46,48,32,42,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,32,43,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,108,97,115,116,100,32,61,32,102,86,46,119,59,10,32,32,32,32,32,32,43,43,108,111,99,59,10,32,32,32,32,125,10,32,32,119,104,105,108,101,40,108,97,115,116,100,32,60,32,116,111,116,97,108,95,100,105,115,116,97,110,99,101,41,59,10,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_compute_interval.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
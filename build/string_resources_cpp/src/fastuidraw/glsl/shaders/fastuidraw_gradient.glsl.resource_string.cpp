@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,103,114,97,100,105,101,110,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,103,114,97,100,105,101,110,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,111,32,100,101,115,99,114,105,98,101,32,97,32,108,105,110,101,97,114,32,103,114,97,100,105,101,110,116,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,10,123,10,32,32,47,42,33,32,84,104,101,32,115,116,97,114,116,32,112,111,105,110,116,32,111,102,32,116,104,101,32,108,105,110,101,97,114,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,118,101,99,50,32,112,48,59,10,10,32,32,47,42,33,32,84,104,101,32,101,110,100,32,112,111,105,110,116,32,111,102,32,116,104,101,32,108,105,110,101,97,114,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,118,101,99,50,32,112,49,59,10,125,59,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,111,32,100,101,115,99,114,105,98,101,32,97,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,10,123,10,32,32,47,42,33,32,84,104,101,32,99,101,110,116,101,114,32,112,111,105,110,116,32,111,102,32,116,104,101,32,115,116,97,114,116,32,99,105,114,99,108,101,32,111,102,32,116,104,101,32,114,97,100,105,97,108,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,118,101,99,50,32,112,48,59,10,10,32,32,47,42,33,32,116,104,101,32,114,97,100,105,117,115,32,111,102,32,116,104,101,32,115,116,97,114,116,32,99,105,114,99,108,101,32,111,102,32,116,104,101,32,114,97,100,105,97,108,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,102,108,111,97,116,32,114,48,59,10,10,32,32,47,42,33,32,84,104,101,32,99,101,110,116,101,114,32,112,111,105,110,116,32,111,102,32,116,104,101,32,101,110,100,32,99,105,114,99,108,101,32,111,102,32,116,104,101,32,114,97,100,105,97,108,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,118,101,99,50,32,112,49,59,10,10,32,32,47,42,33,32,116,104,101,32,114,97,100,105,117,115,32,111,102,32,116,104,101,32,101,110,100,32,99,105,114,99,108,101,32,111,102,32,116,104,101,32,114,97,100,105,97,108,32,103,97,114,100,105,101,110,116,32,42,47,10,32,32,102,108,111,97,116,32,114,49,59,10,125,59,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,83,116,114,117,99,116,117,114,101,32,116,111,32,100,101,115,99,114,105,98,101,32,97,32,115,119,101,101,112,32,103,114,97,100,105,101,110,116,46,10,32,42,47,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,10,123,10,32,32,47,42,33,32,99,101,110,116,101,114,32,111,102,32,99,105,114,99,108,101,32,100,101,102,105,110,105,110,103,32,116,104,101,32,115,119,101,101,112,32,42,47,10,32,32,118,101,99,50,32,112,59,10,10,32,32,47,42,33,10,32,32,32,42,32,116,104,101,32,115,116,97,114,116,32,97,110,103,108,101,32,111,102,32,116,104,101,32,115,119,101,101,112,44,32,105,46,101,46,32,97,116,32,119,104,97,116,32,97,110,103,108,101,10,32,32,32,42,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,32,119,111,117,108,100,32,98,101,32,122,101,114,111,46,32,84,104,101,32,118,97,108,117,101,32,109,117,115,116,10,32,32,32,42,32,98,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,45,80,73,44,32,80,73,93,46,32,84,104,101,32,105,110,116,101,114,112,111,108,97,116,101,32,105,110,99,114,101,97,115,101,115,10,32,32,32,42,32,98,121,32,48,46,53,47,80,73,32,102,111,114,32,101,97,99,104,32,114,97,100,105,97,110,44,32,105,46,101,46,32,105,116,32,105,110,99,114,101,97,115,101,115,32,98,121,32,49,10,32,32,32,42,32,102,111,114,32,99,111,109,112,108,101,116,105,110,103,32,97,32,115,105,110,103,108,101,32,114,101,118,111,108,117,116,105,111,110,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,115,119,101,101,112,95,97,110,103,108,101,59,10,10,32,32,47,42,33,10,32,32,32,42,32,116,104,101,32,114,101,112,101,97,116,32,102,97,99,116,111,114,32,111,102,32,116,104,101,32,115,119,101,101,112,32,105,115,32,98,121,32,119,104,97,116,32,102,97,99,116,111,114,10,32,32,32,42,32,116,111,32,109,117,108,116,105,112,108,121,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,46,32,65,32,110,101,103,97,116,105,118,101,32,118,97,108,117,101,10,32,32,32,42,32,105,110,100,105,99,97,116,101,115,32,116,111,32,115,119,101,101,112,32,99,108,111,99,107,119,105,115,101,32,40,97,115,115,117,109,105,110,103,32,121,32,105,110,99,114,101,97,115,101,115,10,32,32,32,42,32,117,112,119,97,114,100,115,41,32,119,104,101,114,101,32,97,115,32,97,32,112,111,115,105,116,105,118,101,32,118,97,108,117,101,32,105,110,100,105,99,97,116,101,115,32,116,111,10,32,32,32,42,32,115,119,101,101,112,32,99,111,117,110,116,101,114,45,99,108,111,99,107,119,105,115,101,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,115,105,103,110,101,100,95,102,97,99,116,111,114,59,10,125,59,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,32,111,102,32,97,32,112,111,105,110,116,32,97,108,111,110,103,32,97,32,108,105,110,101,97,114,32,103,114,97,100,105,101,110,116,46,10,32,42,32,92,112,97,114,97,109,32,112,32,112,111,115,105,116,105,111,110,10,32,42,32,92,112,97,114,97,109,32,103,32,108,105,110,101,97,114,32,103,114,97,100,105,101,110,116,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,103,114,97,100,105,101,110,116,32,103,41,10,123,10,32,32,118,101,99,50,32,118,44,32,100,59,10,10,32,32,118,32,61,32,103,46,112,49,32,45,32,103,46,112,48,59,10,32,32,100,32,61,32,112,32,45,32,103,46,112,48,59,10,32,32,114,101,116,117,114,110,32,100,111,116,40,118,44,32,100,41,32,47,32,100,111,116,40,118,44,32,118,41,59,10,125,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,32,111,102,32,97,32,112,111,105,110,116,32,97,108,111,110,103,32,97,32,115,119,101,101,112,32,103,114,97,100,105,101,110,116,46,10,32,42,32,92,112,97,114,97,109,32,112,32,112,111,115,105,116,105,111,110,10,32,42,32,92,112,97,114,97,109,32,103,32,115,119,101,101,112,32,103,114,97,100,105,101,110,116,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,115,119,101,101,112,95,103,114,97,100,105,101,110,116,32,103,41,10,123,10,32,32,118,101,99,50,32,100,59,10,32,32,102,108,111,97,116,32,116,44,32,97,110,103,108,101,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,116,119,111,95,112,105,32,61,32,54,46,50,56,51,49,56,53,51,48,55,49,56,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,114,101,99,105,112,95,116,119,111,95,112,105,32,61,32,49,46,48,32,47,32,54,46,50,56,51,49,56,53,51,48,55,49,56,59,10,10,32,32,100,32,61,32,112,32,45,32,103,46,112,59,10,32,32,97,110,103,108,101,32,61,32,97,116,97,110,40,100,46,121,44,32,100,46,120,41,59,10,10,32,32,47,42,32,71,117,97,114,97,110,116,101,101,32,116,104,97,116,32,97,110,103,108,101,32,105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,116,104,101,32,118,97,108,117,101,32,111,102,10,32,32,32,42,32,103,46,115,119,101,101,112,95,97,110,103,108,101,32,115,111,32,116,104,97,116,32,116,104,101,32,115,119,101,101,112,32,103,111,101,115,32,102,114,111,109,32,48,32,116,111,32,50,32,42,32,80,73,10,32,32,32,42,47,10,32,32,105,102,32,40,97,110,103,108,101,32,60,32,103,46,115,119,101,101,112,95,97,110,103,108,101,41,10,32,32,32,32,123,10,32,32,32,32,32,32,97,110,103,108,101,32,43,61,32,116,119,111,95,112,105,59,10,32,32,32,32,125,10,10,32,32,47,42,32,110,111,114,109,97,108,105,122,101,32,116,111,32,91,48,44,32,49,93,32,102,114,111,109,32,91,48,44,32,50,32,80,73,93,32,42,47,10,32,32,116,32,61,32,40,97,110,103,108,101,32,45,32,103,46,115,119,101,101,112,95,97,110,103,108,101,41,32,42,32,114,101,99,105,112,95,116,119,111,95,112,105,59,10,10,32,32,47,42,32,114,101,118,101,114,115,101,32,105,102,32,115,105,103,110,101,100,32,102,97,99,116,111,114,32,105,115,32,110,101,103,97,116,105,118,101,32,42,47,10,32,32,105,102,32,40,103,46,115,105,103,110,101,100,95,102,97,99,116,111,114,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,32,61,32,49,46,48,32,45,32,116,59,10,32,32,32,32,125,10,10,32,32,47,42,32,97,112,112,108,121,32,109,97,103,110,105,116,117,100,101,32,111,102,32,115,105,103,110,101,100,32,102,97,99,116,111,114,32,42,47,10,32,32,116,32,42,61,32,97,98,115,40,103,46,115,105,103,110,101,100,95,102,97,99,116,111,114,41,59,10,10,32,32,114,101,116,117,114,110,32,116,59,10,125,10,10,47,42,33,10,32,42,32,67,111,109,112,117,116,101,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,32,111,102,32,97,32,112,111,105,110,116,32,97,108,111,110,103,32,97,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,46,10,32,42,32,92,112,97,114,97,109,32,112,32,112,111,115,105,116,105,111,110,10,32,42,32,92,112,97,114,97,109,32,103,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,10,32,42,32,92,112,97,114,97,109,91,111,117,116,112,117,116,93,32,103,111,111,100,32,49,46,48,32,105,102,32,116,104,101,32,112,111,105,110,116,32,105,115,32,119,105,116,104,105,110,32,116,104,101,32,101,120,116,101,110,100,101,100,32,99,111,110,101,32,100,101,102,105,110,101,100,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,121,32,116,104,101,32,99,105,114,99,108,101,115,32,111,102,32,116,104,101,32,112,97,115,115,101,100,32,114,97,100,105,97,108,32,103,114,97,100,105,101,110,116,44,32,48,46,48,32,111,116,104,101,114,119,105,115,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,112,111,108,97,116,101,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,114,97,100,105,97,108,95,103,114,97,100,105,101,110,116,32,103,44,32,111,117,116,32,102,108,111,97,116,32,103,111,111,100,41,10,123,10,32,32,118,101,99,50,32,113,44,32,100,101,108,116,97,95,112,59,10,32,32,102,108,111,97,116,32,116,44,32,100,101,108,116,97,95,114,44,32,97,44,32,98,44,32,99,44,32,100,101,115,99,44,32,116,48,44,32,116,49,44,32,114,101,99,105,112,95,116,119,111,95,97,59,10,10,32,32,113,32,61,32,112,32,45,32,103,46,112,48,59,10,32,32,100,101,108,116,97,95,112,32,61,32,103,46,112,49,32,45,32,103,46,112,48,59,10,32,32,100,101,108,116,97,95,114,32,61,32,103,46,114,49,32,45,32,103,46,114,48,59,10,10,32,32,99,32,61,32,100,111,116,40,113,44,32,113,41,32,45,32,103,46,114,48,32,42,32,103,46,114,48,59,10,32,32,98,32,61,32,50,46,48,32,42,32,40,100,111,116,40,113,44,32,100,101,108,116,97,95,112,41,32,45,32,103,46,114,48,32,42,32,100,101,108,116,97,95,114,41,59,10,32,32,97,32,61,32,100,111,116,40,100,101,108,116,97,95,112,44,32,100,101,108,116,97,95,112,41,32,45,32,100,101,108,116,97,95,114,32,42,32,100,101,108,116,97,95,114,59,10,10,32,32,100,101,115,99,32,61,32,98,32,42,32,98,32,45,32,52,46,48,32,42,32,97,32,42,32,99,59,10,32,32,105,102,32,40,100,101,115,99,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,103,111,111,100,32,61,32,48,46,48,59,10,32,32,32,32,32,32,116,32,61,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,103,111,111,100,32,61,32,49,46,48,59,10,10,32,32,32,32,32,32,100,101,115,99,32,61,32,115,113,114,116,40,97,98,115,40,100,101,115,99,41,41,59,10,32,32,32,32,32,32,114,101,99,105,112,95,116,119,111,95,97,32,61,32,48,46,53,32,47,32,97,59,10,32,32,32,32,32,32,116,48,32,61,32,40,45,98,32,43,32,100,101,115,99,41,32,42,32,114,101,99,105,112,95,116,119,111,95,97,59,10,32,32,32,32,32,32,116,49,32,61,32,40,45,98,32,45,32,100,101,115,99,41,32,42,32,114,101,99,105,112,95,116,119,111,95,97,59,10,10,32,32,32,32,32,32,47,42,32,105,102,32,98,111,116,104,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,105,110,32,114,97,110,103,101,44,32,116,104,101,110,32,116,97,107,101,32,116,104,101,32,109,97,120,10,32,32,32,32,32,32,32,42,32,105,102,32,98,111,116,104,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,110,111,116,32,105,110,32,114,97,110,103,101,44,32,116,104,101,110,32,116,97,107,101,32,109,97,120,10,32,32,32,32,32,32,32,42,32,105,102,32,111,110,108,121,32,111,110,101,32,111,102,32,116,48,32,97,110,100,32,116,49,32,97,114,101,32,105,110,32,114,97,110,103,101,32,116,97,107,101,32,116,104,97,116,32,111,110,101,46,10,32,32,32,32,32,32,32,42,47,10,10,32,32,32,32,32,32,47,42,32,71,46,120,32,105,115,32,49,32,101,120,97,99,116,108,121,32,119,104,101,110,32,116,48,32,105,115,32,105,110,32,114,97,110,103,101,10,32,32,32,32,32,32,32,42,32,71,46,121,32,105,115,32,49,32,101,120,97,99,116,108,121,32,119,104,101,110,32,116,49,32,105,115,32,105,110,32,114,97,110,103,101,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,118,101,99,50,32,71,59,10,32,32,32,32,32,32,71,32,61,32,115,116,101,112,40,48,46,48,44,32,118,101,99,50,40,116,48,44,32,116,49,41,41,32,42,32,115,116,101,112,40,118,101,99,50,40,116,48,44,32,116,49,41,44,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,41,59,10,10,32,32,32,32,32,32,105,102,32,40,71,46,120,32,61,61,32,71,46,121,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,109,97,120,40,116,48,44,32,116,49,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,116,32,61,32,100,111,116,40,71,44,32,118,101,99,50,40,116,48,44,32,116,49,41,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,116,59,10,125,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_gradient.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
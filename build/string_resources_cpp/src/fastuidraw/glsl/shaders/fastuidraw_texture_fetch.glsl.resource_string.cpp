@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,116,101,120,116,117,114,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,116,101,120,116,117,114,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,57,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,47,47,64,99,111,110,100,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,108,111,97,116,32,120,41,10,123,10,32,32,32,32,102,108,111,97,116,32,120,95,115,113,117,97,114,101,100,32,61,32,120,32,42,32,120,59,10,32,32,32,32,102,108,111,97,116,32,120,95,99,117,98,101,100,32,61,32,120,95,115,113,117,97,114,101,100,32,42,32,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,32,61,32,49,46,48,32,45,32,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,61,32,111,110,101,95,109,105,110,117,115,95,120,32,42,32,111,110,101,95,109,105,110,117,115,95,120,59,10,32,32,32,32,102,108,111,97,116,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,32,61,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,32,42,32,111,110,101,95,109,105,110,117,115,95,120,59,10,32,32,32,32,118,101,99,52,32,119,59,10,10,32,32,32,32,119,46,120,32,61,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,59,10,32,32,32,32,119,46,121,32,61,32,51,46,48,32,42,32,120,95,99,117,98,101,100,32,45,32,54,46,48,32,42,32,120,95,115,113,117,97,114,101,100,32,43,32,52,46,48,59,10,32,32,32,32,119,46,122,32,61,32,51,46,48,32,42,32,111,110,101,95,109,105,110,117,115,95,120,95,99,117,98,101,100,32,45,32,54,46,48,32,42,32,111,110,101,95,109,105,110,117,115,95,120,95,115,113,117,97,114,101,100,32,43,32,52,46,48,59,10,32,32,32,32,119,46,119,32,61,32,120,95,99,117,98,101,100,59,10,32,32,32,32,114,101,116,117,114,110,32,119,32,47,32,54,46,48,59,10,125,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,80,101,102,111,114,109,32,110,101,97,114,101,115,116,32,102,105,108,116,101,114,105,110,103,32,111,110,32,97,32,115,97,109,112,108,101,114,50,68,10,32,42,32,92,112,97,114,97,109,32,115,117,114,102,97,99,101,32,116,104,101,32,115,117,114,102,97,99,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,104,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,40,110,111,116,32,116,101,120,116,117,114,101,32,99,111,111,114,100,105,110,97,116,101,41,44,32,105,46,101,46,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,32,99,111,111,114,100,105,110,97,116,101,32,105,110,32,112,105,120,101,108,115,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,116,104,101,32,108,101,118,101,108,32,111,102,32,100,101,116,97,105,108,32,40,97,108,97,32,116,101,120,116,117,114,101,76,111,100,40,41,32,111,102,32,103,108,115,108,41,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,105,110,32,115,97,109,112,108,101,114,50,68,32,115,117,114,102,97,99,101,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,118,101,99,50,32,97,100,106,117,115,116,101,100,59,10,32,32,105,110,116,32,76,59,10,10,32,32,76,32,61,32,105,110,116,40,99,101,105,108,40,108,111,100,41,41,59,10,32,32,97,100,106,117,115,116,101,100,32,61,32,116,101,120,101,108,95,99,111,111,114,100,32,47,32,102,108,111,97,116,40,49,32,60,60,32,76,41,59,10,32,32,114,101,116,117,114,110,32,116,101,120,101,108,70,101,116,99,104,40,115,117,114,102,97,99,101,44,32,105,118,101,99,50,40,97,100,106,117,115,116,101,100,41,44,32,76,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,80,101,102,111,114,109,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,111,110,32,97,32,115,97,109,112,108,101,114,50,68,10,32,42,32,92,112,97,114,97,109,32,115,117,114,102,97,99,101,32,116,104,101,32,115,117,114,102,97,99,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,104,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,40,110,111,116,32,116,101,120,116,117,114,101,32,99,111,111,114,100,105,110,97,116,101,41,44,32,105,46,101,46,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,32,99,111,111,114,100,105,110,97,116,101,32,105,110,32,112,105,120,101,108,115,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,116,104,101,32,108,101,118,101,108,32,111,102,32,100,101,116,97,105,108,32,40,97,108,97,32,116,101,120,116,117,114,101,76,111,100,40,41,32,111,102,32,103,108,115,108,41,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,105,110,32,115,97,109,112,108,101,114,50,68,32,115,117,114,102,97,99,101,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,118,101,99,50,32,114,101,99,105,112,95,115,122,32,61,32,49,46,48,32,47,32,118,101,99,50,40,116,101,120,116,117,114,101,83,105,122,101,40,115,117,114,102,97,99,101,44,32,48,41,41,59,10,32,32,114,101,116,117,114,110,32,116,101,120,116,117,114,101,76,111,100,40,115,117,114,102,97,99,101,44,32,116,101,120,101,108,95,99,111,111,114,100,32,42,32,114,101,99,105,112,95,115,122,44,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,80,101,102,111,114,109,32,99,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,111,110,32,97,32,115,97,109,112,108,101,114,50,68,10,32,42,32,92,112,97,114,97,109,32,115,117,114,102,97,99,101,32,116,104,101,32,115,117,114,102,97,99,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,104,101,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,32,40,110,111,116,32,116,101,120,116,117,114,101,32,99,111,111,114,100,105,110,97,116,101,41,44,32,105,46,101,46,10,32,42,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,32,99,111,111,114,100,105,110,97,116,101,32,105,110,32,112,105,120,101,108,115,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,105,110,32,115,97,109,112,108,101,114,50,68,32,115,117,114,102,97,99,101,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,41,10,123,10,32,32,118,101,99,50,32,114,101,99,105,112,95,115,122,32,61,32,49,46,48,32,47,32,118,101,99,50,40,116,101,120,116,117,114,101,83,105,122,101,40,115,117,114,102,97,99,101,44,32,48,41,41,59,10,32,32,118,101,99,50,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,59,10,32,32,118,101,99,52,32,120,95,119,101,105,103,104,116,115,44,32,121,95,119,101,105,103,104,116,115,59,10,32,32,118,101,99,52,32,99,111,114,110,101,114,95,99,111,111,114,100,115,44,32,119,101,105,103,104,116,95,115,117,109,115,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,59,10,32,32,118,101,99,52,32,116,48,48,44,32,116,49,48,44,32,116,48,49,44,32,116,49,49,59,10,10,32,32,47,42,32,67,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,98,121,32,114,101,97,108,105,122,105,110,103,32,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,32,97,115,32,114,101,112,101,97,116,101,100,10,32,32,32,42,32,98,105,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,44,32,115,101,101,32,71,80,85,32,71,101,109,115,32,50,44,32,67,104,97,112,116,101,114,32,50,48,46,10,32,32,32,42,32,67,111,100,101,32,105,110,115,112,105,114,101,100,32,98,121,32,83,116,97,99,107,79,118,101,114,102,108,111,119,32,40,104,116,116,112,58,47,47,115,116,97,99,107,111,118,101,114,102,108,111,119,46,99,111,109,47,113,117,101,115,116,105,111,110,115,47,49,51,53,48,49,48,56,49,47,101,102,102,105,99,105,101,110,116,45,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,99,111,100,101,45,105,110,45,103,108,115,108,41,10,32,32,32,42,32,97,110,100,32,102,114,111,109,32,83,104,105,110,121,32,80,105,120,101,108,115,32,40,104,116,116,112,58,47,47,118,101,99,51,46,99,97,47,98,105,99,117,98,105,99,45,102,105,108,116,101,114,105,110,103,45,105,110,45,102,101,119,101,114,45,116,97,112,115,47,41,10,32,32,32,42,47,10,32,32,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,59,10,32,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,32,61,32,102,114,97,99,116,40,116,101,120,101,108,95,99,111,111,114,100,41,59,10,32,32,116,101,120,101,108,95,99,111,111,114,100,32,45,61,32,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,59,10,10,32,32,120,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,46,120,41,59,10,32,32,121,95,119,101,105,103,104,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,119,101,105,103,104,116,115,40,102,114,97,99,116,95,116,101,120,101,108,95,99,111,111,114,100,46,121,41,59,10,10,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,61,32,116,101,120,101,108,95,99,111,111,114,100,46,120,120,121,121,59,10,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,120,122,32,45,61,32,118,101,99,50,40,48,46,53,41,59,10,32,32,99,111,114,110,101,114,95,99,111,111,114,100,115,46,121,119,32,43,61,32,118,101,99,50,40,49,46,53,41,59,10,32,32,119,101,105,103,104,116,95,115,117,109,115,32,61,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,120,32,43,32,120,95,119,101,105,103,104,116,115,46,121,44,32,120,95,119,101,105,103,104,116,115,46,122,32,43,32,120,95,119,101,105,103,104,116,115,46,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,121,95,119,101,105,103,104,116,115,46,120,32,43,32,121,95,119,101,105,103,104,116,115,46,121,44,32,121,95,119,101,105,103,104,116,115,46,122,32,43,32,121,95,119,101,105,103,104,116,115,46,119,41,59,10,10,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,61,32,99,111,114,110,101,114,95,99,111,111,114,100,115,32,43,32,118,101,99,52,40,120,95,119,101,105,103,104,116,115,46,121,119,44,32,121,95,119,101,105,103,104,116,115,46,121,119,41,32,47,32,119,101,105,103,104,116,95,115,117,109,115,59,10,32,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,32,42,61,32,114,101,99,105,112,95,115,122,46,120,120,121,121,59,10,10,32,32,116,48,48,32,61,32,116,101,120,116,117,114,101,76,111,100,40,115,117,114,102,97,99,101,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,122,44,32,48,46,48,41,59,10,32,32,116,49,48,32,61,32,116,101,120,116,117,114,101,76,111,100,40,115,117,114,102,97,99,101,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,122,44,32,48,46,48,41,59,10,32,32,116,48,49,32,61,32,116,101,120,116,117,114,101,76,111,100,40,115,117,114,102,97,99,101,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,120,119,44,32,48,46,48,41,59,10,32,32,116,49,49,32,61,32,116,101,120,116,117,114,101,76,111,100,40,115,117,114,102,97,99,101,44,32,116,101,120,116,117,114,101,95,99,111,111,114,100,115,46,121,119,44,32,48,46,48,41,59,10,10,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,121,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,120,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,121,41,59,10,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,32,61,32,119,101,105,103,104,116,95,115,117,109,115,46,119,32,47,32,40,119,101,105,103,104,116,95,115,117,109,115,46,122,32,43,32,119,101,105,103,104,116,95,115,117,109,115,46,119,41,59,10,10,32,32,114,101,116,117,114,110,32,109,105,120,40,109,105,120,40,116,48,48,44,32,116,49,48,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,120,40,116,48,49,44,32,116,49,49,44,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,120,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,108,105,110,101,97,114,95,119,101,105,103,104,116,46,121,41,59,10,125,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_texture_fetch.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
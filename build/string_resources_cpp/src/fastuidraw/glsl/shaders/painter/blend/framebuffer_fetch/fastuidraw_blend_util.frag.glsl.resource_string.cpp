@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,117,116,105,108,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,117,116,105,108,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,42,33,32,92,98,114,105,101,102,32,67,111,109,112,117,116,101,32,116,104,101,32,109,105,110,105,109,117,109,32,99,111,108,111,114,32,99,104,97,110,110,101,108,32,118,97,108,117,101,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,110,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,109,105,110,40,67,46,114,44,32,109,105,110,40,67,46,103,44,32,67,46,98,41,41,59,10,125,10,10,47,42,33,32,92,98,114,105,101,102,32,67,111,109,112,117,116,101,32,116,104,101,32,109,97,120,105,109,117,109,32,99,111,108,111,114,32,99,104,97,110,110,101,108,32,118,97,108,117,101,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,120,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,109,97,120,40,67,46,114,44,32,109,97,120,40,67,46,103,44,32,67,46,98,41,41,59,10,125,10,10,47,42,33,32,92,98,114,105,101,102,32,99,111,109,112,117,116,101,32,116,104,101,32,108,117,109,105,110,111,115,105,116,121,32,111,102,32,97,110,32,82,71,66,32,118,97,108,117,101,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,108,117,109,105,110,111,115,105,116,121,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,100,111,116,40,67,44,32,118,101,99,51,40,48,46,51,44,32,48,46,53,57,44,32,48,46,49,49,41,41,59,10,125,10,10,47,42,33,32,92,98,114,105,101,102,32,99,111,109,112,117,116,101,32,116,104,101,32,115,97,116,117,114,97,116,105,111,110,32,111,102,32,97,110,32,82,71,66,32,118,97,108,117,101,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,115,97,116,117,114,97,116,105,111,110,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,120,40,67,41,32,45,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,110,40,67,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,99,108,105,112,32,97,110,32,82,71,66,32,118,97,108,117,101,32,115,111,32,116,104,97,116,32,105,116,115,32,108,117,109,105,110,111,115,105,116,121,32,105,115,32,119,105,116,104,105,110,32,116,104,101,32,114,97,110,103,101,10,32,42,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,110,40,41,32,97,110,100,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,120,40,41,46,10,32,42,47,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,99,111,108,111,114,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,102,108,111,97,116,32,108,117,109,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,108,117,109,105,110,111,115,105,116,121,40,67,41,59,10,32,32,102,108,111,97,116,32,109,105,110,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,110,40,67,41,59,10,32,32,102,108,111,97,116,32,109,97,120,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,97,120,40,67,41,59,10,32,32,118,101,99,51,32,108,117,109,67,118,32,61,32,118,101,99,51,40,108,117,109,67,41,59,10,10,32,32,105,102,32,40,109,105,110,67,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,97,99,116,111,114,59,10,32,32,32,32,32,32,102,97,99,116,111,114,32,61,32,108,117,109,67,32,47,32,40,108,117,109,67,32,45,32,109,105,110,67,41,59,10,32,32,32,32,32,32,67,32,61,32,108,117,109,67,118,32,43,32,40,67,32,45,32,108,117,109,67,118,41,32,42,32,102,97,99,116,111,114,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,109,97,120,67,32,62,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,97,99,116,111,114,59,10,32,32,32,32,32,32,102,97,99,116,111,114,32,61,32,40,49,46,48,32,45,32,108,117,109,67,41,32,47,32,40,109,97,120,67,32,45,32,108,117,109,67,41,59,10,32,32,32,32,32,32,67,32,61,32,108,117,109,67,118,32,43,32,40,67,32,45,32,108,117,109,67,118,41,32,42,32,102,97,99,116,111,114,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,67,59,10,125,10,10,47,42,33,10,32,42,32,82,101,116,117,114,110,32,97,110,32,82,71,66,32,99,111,108,111,114,32,118,97,108,117,101,32,103,101,110,101,114,97,116,101,32,102,114,111,109,32,116,97,107,105,110,103,10,32,42,32,116,104,101,32,99,104,114,111,109,97,32,111,102,32,111,110,101,32,99,111,108,111,114,32,118,97,108,117,101,32,97,110,100,32,116,104,101,32,108,117,109,105,110,111,115,105,116,121,10,32,42,32,111,102,32,97,110,111,116,104,101,114,10,32,42,32,92,112,97,114,97,109,32,67,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,116,97,107,101,32,116,104,101,32,99,104,114,111,109,97,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,76,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,116,97,107,101,32,116,104,101,32,108,117,109,105,110,111,115,105,116,121,32,118,97,108,117,101,10,32,42,47,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,115,101,116,95,108,117,109,105,110,111,115,105,116,121,40,105,110,32,118,101,99,51,32,67,44,32,105,110,32,118,101,99,51,32,76,41,10,123,10,32,32,102,108,111,97,116,32,67,108,117,109,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,108,117,109,105,110,111,115,105,116,121,40,67,41,59,10,32,32,102,108,111,97,116,32,76,108,117,109,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,108,117,109,105,110,111,115,105,116,121,40,76,41,59,10,32,32,102,108,111,97,116,32,100,101,108,116,97,32,61,32,76,108,117,109,32,45,32,67,108,117,109,59,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,99,111,108,111,114,40,67,32,43,32,118,101,99,51,40,100,101,108,116,97,41,41,59,10,125,10,10,47,42,33,10,32,42,32,82,101,116,117,114,110,32,97,110,32,82,71,66,32,99,111,108,111,114,32,118,97,108,117,101,32,103,101,110,101,114,97,116,101,32,102,114,111,109,32,116,97,107,105,110,103,10,32,42,32,116,104,101,32,99,104,114,111,109,97,32,111,102,32,111,110,101,32,99,111,108,111,114,32,118,97,108,117,101,32,97,110,100,32,116,104,101,32,108,117,109,105,110,111,115,105,116,121,10,32,42,32,97,110,100,32,115,97,116,117,114,97,116,105,111,110,32,111,102,32,111,116,104,101,114,32,99,111,108,111,114,32,118,97,108,117,101,115,10,32,42,32,92,112,97,114,97,109,32,67,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,116,97,107,101,32,116,104,101,32,99,104,114,111,109,97,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,83,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,116,97,107,101,32,116,104,101,32,115,97,116,117,114,97,116,105,111,110,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,76,32,99,111,108,111,114,32,118,97,108,117,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,116,97,107,101,32,116,104,101,32,108,117,109,105,110,111,115,105,116,121,32,118,97,108,117,101,10,32,42,47,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,115,101,116,95,115,97,116,117,114,97,116,105,111,110,95,97,110,100,95,108,117,109,105,110,111,115,105,116,121,40,105,110,32,118,101,99,51,32,67,44,32,105,110,32,118,101,99,51,32,83,44,32,105,110,32,118,101,99,51,32,76,41,10,123,10,32,32,102,108,111,97,116,32,67,109,105,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,110,40,67,41,59,10,32,32,102,108,111,97,116,32,67,115,97,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,115,97,116,117,114,97,116,105,111,110,40,67,41,59,10,32,32,102,108,111,97,116,32,83,115,97,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,115,97,116,117,114,97,116,105,111,110,40,83,41,59,10,32,32,118,101,99,51,32,99,111,108,111,114,59,10,10,32,32,105,102,32,40,67,115,97,116,32,62,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,67,32,61,32,40,67,32,45,32,67,109,105,110,41,32,42,32,83,115,97,116,32,47,32,67,115,97,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,67,32,61,32,118,101,99,51,40,48,46,48,41,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,115,101,116,95,108,117,109,105,110,111,115,105,116,121,40,67,44,32,76,41,59,10,125,10,10,47,42,33,32,92,98,114,105,101,102,32,85,110,100,111,32,112,114,101,45,109,117,108,116,105,112,108,121,32,98,121,32,97,108,112,104,97,32,111,110,32,116,104,101,32,82,71,66,32,99,104,97,110,110,101,108,115,32,111,102,32,97,32,99,111,108,111,114,32,118,97,108,117,101,32,42,47,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,117,110,100,111,95,97,108,112,104,97,40,105,110,32,118,101,99,52,32,83,41,10,123,10,32,32,105,102,32,40,83,46,97,32,33,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,83,46,97,32,61,32,49,46,48,32,47,32,83,46,97,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,83,46,114,103,98,32,42,32,83,46,97,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,112,101,114,102,111,114,109,32,111,118,101,114,108,97,121,32,98,108,101,110,100,105,110,103,32,111,110,32,97,32,115,105,110,103,108,101,32,99,111,108,111,114,32,99,104,97,110,110,101,108,10,32,42,32,92,112,97,114,97,109,32,83,32,83,111,117,114,99,101,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,68,32,68,101,115,116,105,110,97,116,105,111,110,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,111,118,101,114,108,97,121,40,105,110,32,102,108,111,97,116,32,83,44,32,105,110,32,102,108,111,97,116,32,68,41,10,123,10,32,32,114,101,116,117,114,110,32,40,68,32,60,61,32,48,46,53,41,32,63,10,32,32,32,32,40,50,46,48,32,42,32,83,32,42,32,68,41,32,58,10,32,32,32,32,40,49,46,48,32,45,32,50,46,48,32,42,32,40,49,46,48,32,45,32,83,41,32,42,32,40,49,46,48,32,45,32,68,41,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,112,101,114,102,111,114,109,32,115,111,102,116,108,105,103,104,116,32,98,108,101,110,100,105,110,103,32,111,110,32,97,32,115,105,110,103,108,101,32,99,111,108,111,114,32,99,104,97,110,110,101,108,10,32,42,32,92,112,97,114,97,109,32,83,32,83,111,117,114,99,101,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,68,32,68,101,115,116,105,110,97,116,105,111,110,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,115,111,102,116,108,105,103,104,116,40,105,110,32,102,108,111,97,116,32,83,44,32,105,110,32,102,108,111,97,116,32,68,41,10,123,10,32,32,105,102,32,40,83,32,60,61,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,68,32,45,32,40,49,46,48,32,45,32,50,46,48,32,42,32,83,41,32,42,32,68,32,42,32,40,49,46,48,32,45,32,68,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,68,32,60,61,32,48,46,50,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,68,32,43,32,40,50,46,48,32,42,32,83,32,45,32,49,46,48,41,32,42,32,68,32,42,32,40,40,49,54,46,48,32,42,32,68,32,45,32,49,50,46,48,41,32,42,32,68,32,43,32,51,46,48,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,68,32,43,32,40,50,46,48,32,42,32,83,32,45,32,49,46,48,41,32,42,32,40,115,113,114,116,40,68,41,32,45,32,68,41,59,10,32,32,32,32,125,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,112,101,114,102,111,114,109,32,104,97,114,100,108,105,103,104,116,32,98,108,101,110,100,105,110,103,32,111,110,32,97,32,115,105,110,103,108,101,32,99,111,108,111,114,32,99,104,97,110,110,101,108,10,32,42,32,92,112,97,114,97,109,32,83,32,83,111,117,114,99,101,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,68,32,68,101,115,116,105,110,97,116,105,111,110,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,104,97,114,100,108,105,103,104,116,40,105,110,32,102,108,111,97,116,32,83,44,32,105,110,32,102,108,111,97,116,32,68,41,10,123,10,32,32,105,102,32,40,83,32,60,61,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,50,46,48,32,42,32,83,32,42,32,68,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,32,45,32,50,46,48,32,42,32,40,49,46,48,32,45,32,83,41,32,42,32,40,49,46,48,32,45,32,68,41,59,10,32,32,32,32,125,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,112,101,114,102,111,114,109,32,99,111,108,111,114,32,100,111,100,103,101,32,98,108,101,110,100,105,110,103,32,111,110,32,97,32,115,105,110,103,108,101,32,99,111,108,111,114,32,99,104,97,110,110,101,108,10,32,42,32,92,112,97,114,97,109,32,83,32,83,111,117,114,99,101,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,68,32,68,101,115,116,105,110,97,116,105,111,110,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,100,111,100,103,101,40,105,110,32,102,108,111,97,116,32,83,44,32,105,110,32,102,108,111,97,116,32,68,41,10,123,10,32,32,105,102,32,40,68,32,60,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,83,32,62,61,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,109,105,110,40,49,46,48,44,32,68,32,47,32,40,49,46,48,32,45,32,83,41,41,59,10,32,32,32,32,125,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,10,32,42,32,112,101,114,102,111,114,109,32,99,111,108,111,114,32,98,117,114,110,32,98,108,101,110,100,105,110,103,32,111,110,32,97,32,115,105,110,103,108,101,32,99,111,108,111,114,32,99,104,97,110,110,101,108,10,32,42,32,92,112,97,114,97,109,32,83,32,83,111,117,114,99,101,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,32,92,112,97,114,97,109,32,68,32,68,101,115,116,105,110,97,116,105,111,110,32,105,110,112,117,116,32,118,97,108,117,101,10,32,42,47,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,95,98,117,114,110,40,105,110,32,102,108,111,97,116,32,83,44,32,105,110,32,102,108,111,97,116,32,68,41,10,123,10,32,32,105,102,32,40,68,32,62,61,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,83,32,60,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,32,45,32,109,105,110,40,49,46,48,44,32,40,49,46,48,32,45,32,68,41,32,47,32,83,41,59,10,32,32,32,32,125,10,125,10,10,47,47,47,64,99,111,110,100,10,10,47,42,32,78,97,117,103,104,116,121,32,109,97,99,114,111,32,116,104,97,116,32,97,115,115,117,109,101,115,32,105,110,95,115,114,99,44,32,105,110,95,102,98,32,97,114,101,32,100,101,102,105,110,101,100,46,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,80,79,82,84,69,82,95,68,85,70,70,95,77,65,67,82,79,40,115,114,99,95,102,97,99,116,111,114,44,32,100,115,116,95,102,97,99,116,111,114,41,32,92,10,32,32,40,40,115,114,99,95,102,97,99,116,111,114,41,32,42,32,105,110,95,115,114,99,32,43,32,40,100,115,116,95,102,97,99,116,111,114,41,32,42,32,105,110,95,102,98,41,10,10,47,42,32,77,97,99,114,111,32,116,104,97,116,32,114,117,110,115,32,116,104,101,32,101,120,112,114,101,115,115,105,111,110,32,111,110,32,111,110,101,32,99,104,97,110,110,101,108,32,111,102,32,111,117,116,95,115,114,99,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,79,78,69,95,67,72,65,78,78,69,76,95,77,65,67,82,79,40,99,104,97,110,110,101,108,44,32,101,120,112,114,101,115,115,105,111,110,41,32,92,10,32,32,83,32,61,32,83,114,103,98,46,99,104,97,110,110,101,108,59,32,68,32,61,32,68,114,103,98,46,99,104,97,110,110,101,108,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,99,104,97,110,110,101,108,32,61,32,40,101,120,112,114,101,115,115,105,111,110,41,10,10,47,42,32,78,97,117,103,104,116,121,32,109,97,99,114,111,32,116,104,97,116,32,97,115,115,117,109,101,115,32,105,110,95,115,114,99,44,32,105,110,95,102,98,32,97,114,101,32,100,101,102,105,110,101,100,32,65,78,68,10,32,42,32,101,120,112,114,101,115,115,105,111,110,32,105,115,32,97,32,115,99,97,108,97,114,32,101,120,112,114,101,115,115,105,111,110,32,105,110,32,83,32,97,110,100,32,68,32,40,116,101,109,112,111,114,97,114,105,101,115,41,10,32,42,32,119,105,116,104,32,83,32,114,101,112,114,101,115,101,110,116,105,110,103,32,34,115,111,117,114,99,101,34,32,40,105,46,101,32,105,110,95,115,114,99,32,119,105,116,104,32,97,108,112,104,97,32,117,110,100,111,110,101,41,10,32,42,32,97,110,100,32,68,32,114,101,112,114,101,115,101,110,116,105,110,103,32,34,100,101,115,116,105,110,97,116,105,111,110,34,32,40,105,46,101,46,32,105,110,95,102,98,32,119,105,116,104,32,97,108,112,104,97,32,117,110,100,111,110,101,41,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,77,65,67,82,79,40,101,120,112,114,101,115,115,105,111,110,41,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,118,101,99,51,32,83,114,103,98,44,32,68,114,103,98,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,102,108,111,97,116,32,83,44,32,68,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,83,114,103,98,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,100,111,95,97,108,112,104,97,40,105,110,95,115,114,99,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,68,114,103,98,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,100,111,95,97,108,112,104,97,40,105,110,95,102,98,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,97,32,61,32,105,110,95,115,114,99,46,97,32,43,32,105,110,95,102,98,46,97,32,42,32,40,49,46,48,32,45,32,105,110,95,115,114,99,46,97,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,70,65,83,84,85,73,68,82,65,87,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,79,78,69,95,67,72,65,78,78,69,76,95,77,65,67,82,79,40,114,44,32,101,120,112,114,101,115,115,105,111,110,41,59,32,32,32,32,32,32,92,10,32,32,70,65,83,84,85,73,68,82,65,87,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,79,78,69,95,67,72,65,78,78,69,76,95,77,65,67,82,79,40,103,44,32,101,120,112,114,101,115,115,105,111,110,41,59,32,32,32,32,32,32,92,10,32,32,70,65,83,84,85,73,68,82,65,87,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,79,78,69,95,67,72,65,78,78,69,76,95,77,65,67,82,79,40,98,44,32,101,120,112,114,101,115,115,105,111,110,41,59,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,114,103,98,32,42,61,32,105,110,95,115,114,99,46,97,32,42,32,105,110,95,102,98,46,97,59,10,32,32,111,117,116,95,115,114,99,46,114,103,98,32,43,61,32,83,114,103,98,32,42,32,40,49,46,48,32,45,32,105,110,95,102,98,46,97,41,32,43,32,68,114,103,98,32,42,32,40,49,46,48,32,45,32,105,110,95,115,114,99,46,97,41,10,10,47,42,32,78,97,117,103,104,116,121,32,109,97,99,114,111,32,116,104,97,116,32,97,115,115,117,109,101,115,32,105,110,95,115,114,99,44,32,105,110,95,102,98,32,97,114,101,32,100,101,102,105,110,101,100,32,65,78,68,10,32,42,32,101,120,112,114,101,115,115,105,111,110,32,105,115,32,97,32,118,101,99,51,32,101,120,112,114,101,115,115,105,111,110,32,105,110,32,83,32,97,110,100,32,68,32,40,116,101,109,112,111,114,97,114,105,101,115,41,10,32,42,32,119,105,116,104,32,83,32,114,101,112,114,101,115,101,110,116,105,110,103,32,34,115,111,117,114,99,101,34,32,40,105,46,101,32,105,110,95,115,114,99,32,119,105,116,104,32,97,108,112,104,97,32,117,110,100,111,110,101,41,10,32,42,32,97,110,100,32,68,32,114,101,112,114,101,115,101,110,116,105,110,103,32,34,100,101,115,116,105,110,97,116,105,111,110,34,32,40,105,46,101,46,32,105,110,95,102,98,32,119,105,116,104,32,97,108,112,104,97,32,117,110,100,111,110,101,41,46,10,32,42,47,10,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,78,79,78,95,83,69,80,69,82,65,66,76,69,95,70,66,70,95,66,76,69,78,68,95,77,65,67,82,79,40,101,120,112,114,101,115,115,105,111,110,41,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,118,101,99,51,32,83,44,32,68,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,83,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,100,111,95,97,108,112,104,97,40,105,110,95,115,114,99,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,68,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,100,111,95,97,108,112,104,97,40,105,110,95,102,98,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,97,32,61,32,105,110,95,115,114,99,46,97,32,43,32,105,110,95,102,98,46,97,32,42,32,40,49,46,48,32,45,32,105,110,95,115,114,99,46,97,41,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,114,103,98,32,61,32,101,120,112,114,101,115,115,105,111,110,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,114,103,98,32,42,61,32,105,110,95,115,114,99,46,97,32,42,32,105,110,95,102,98,46,97,59,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,92,10,32,32,111,117,116,95,115,114,99,46,114,103,98,32,43,61,32,83,32,42,32,40,49,46,48,32,45,32,105,110,95,102,98,46,97,41,32,43,32,68,32,42,32,40,49,46,48,32,45,32,105,110,95,115,114,99,46,97,41,59,10,10,47,47,47,64,101,110,100,99,111,110,100,10,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_blend_util.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
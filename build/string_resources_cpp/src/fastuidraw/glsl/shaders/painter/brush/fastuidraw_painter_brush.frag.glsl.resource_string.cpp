@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,97,112,112,108,121,95,115,112,114,101,97,100,41,40,105,110,32,102,108,111,97,116,32,116,44,32,105,110,32,102,108,111,97,116,32,114,97,110,103,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,112,114,101,97,100,95,116,121,112,101,41,10,123,10,32,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,109,105,114,114,111,114,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,114,114,111,114,95,115,112,114,101,97,100,40,116,44,32,114,97,110,103,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,114,101,112,101,97,116,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,114,101,112,101,97,116,95,115,112,114,101,97,100,40,116,44,32,114,97,110,103,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,115,112,114,101,97,100,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,109,105,114,114,111,114,95,114,101,112,101,97,116,41,10,32,32,32,32,123,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,109,105,114,114,111,114,95,114,101,112,101,97,116,95,115,112,114,101,97,100,40,116,44,32,114,97,110,103,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,99,108,97,109,112,95,115,112,114,101,97,100,40,116,44,32,114,97,110,103,101,41,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,116,59,10,125,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,98,114,117,115,104,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,41,10,123,10,32,32,118,101,99,50,32,112,44,32,100,112,100,120,44,32,100,112,100,121,59,10,32,32,118,101,99,52,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,118,101,99,52,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,122,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,108,111,114,95,119,41,59,10,10,32,32,112,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,41,59,10,32,32,100,112,100,120,32,61,32,100,70,100,120,40,112,41,59,10,32,32,100,112,100,121,32,61,32,100,70,100,121,40,112,41,59,10,10,32,32,47,42,32,84,79,68,79,58,10,32,32,32,42,32,32,104,97,118,101,32,98,105,116,115,32,105,110,32,120,32,97,110,100,32,121,32,116,111,32,115,112,101,99,105,102,121,32,116,104,101,32,114,101,112,101,97,116,32,109,111,100,101,115,10,32,32,32,42,32,32,32,32,45,32,99,108,97,109,112,10,32,32,32,42,32,32,32,32,45,32,109,105,114,114,111,114,10,32,32,32,42,32,32,32,32,45,32,114,101,112,101,97,116,10,32,32,32,42,32,32,32,32,45,32,109,105,114,114,111,114,45,114,101,112,101,97,116,10,32,32,32,42,47,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,120,95,115,112,114,101,97,100,44,32,121,95,115,112,114,101,97,100,59,10,10,32,32,32,32,32,32,120,95,115,112,114,101,97,100,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,95,115,112,114,101,97,100,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,41,59,10,10,32,32,32,32,32,32,121,95,115,112,114,101,97,100,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,95,115,112,114,101,97,100,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,115,112,114,101,97,100,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,41,59,10,10,32,32,32,32,32,32,112,32,45,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,41,59,10,32,32,32,32,32,32,112,46,120,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,97,112,112,108,121,95,115,112,114,101,97,100,41,40,112,46,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,119,44,32,120,95,115,112,114,101,97,100,41,59,10,32,32,32,32,32,32,112,46,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,97,112,112,108,121,95,115,112,114,101,97,100,41,40,112,46,121,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,104,44,32,121,95,115,112,114,101,97,100,41,59,10,32,32,32,32,32,32,112,32,43,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,121,41,59,10,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,114,101,112,101,97,116,95,119,105,110,100,111,119,95,115,105,122,101,41,40,41,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,32,61,32,112,46,120,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,32,61,32,112,46,121,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,109,97,116,114,105,120,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,109,97,116,114,105,120,95,115,105,122,101,41,40,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,116,114,97,110,115,108,97,116,105,111,110,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,116,114,97,110,115,102,111,114,109,97,116,105,111,110,95,116,114,97,110,115,108,97,116,105,111,110,95,115,105,122,101,41,40,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,32,38,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,109,97,115,107,41,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,105,109,97,103,101,95,115,117,98,95,115,104,97,100,101,114,59,10,10,32,32,32,32,32,32,105,109,97,103,101,95,115,117,98,95,115,104,97,100,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,41,59,10,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,42,61,32,105,109,97,103,101,95,98,114,117,115,104,40,105,109,97,103,101,95,115,117,98,95,115,104,97,100,101,114,44,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,103,114,97,100,105,101,110,116,95,115,117,98,95,115,104,97,100,101,114,59,10,10,32,32,32,32,32,32,103,114,97,100,105,101,110,116,95,115,117,98,95,115,104,97,100,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,103,114,97,100,105,101,110,116,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,102,101,97,116,117,114,101,115,41,59,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,42,61,32,103,114,97,100,105,101,110,116,95,98,114,117,115,104,40,103,114,97,100,105,101,110,116,95,115,117,98,95,115,104,97,100,101,114,44,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_brush.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,105,109,97,103,101,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,105,109,97,103,101,95,98,114,117,115,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,35,105,102,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,68,73,83,65,66,76,69,68,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,97,116,108,97,115,41,40,105,110,32,118,101,99,50,32,113,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,118,101,99,50,32,105,109,97,103,101,95,120,121,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,95,101,120,116,101,110,100,101,100,95,105,110,102,111,95,116,121,112,101,32,105,109,97,103,101,95,105,110,102,111,59,10,32,32,118,101,99,52,32,105,109,97,103,101,95,99,111,108,111,114,59,10,10,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,110,117,109,95,108,101,118,101,108,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,110,117,109,98,101,114,95,105,110,100,101,120,95,108,111,111,107,117,112,115,59,10,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,105,109,97,103,101,95,105,110,102,111,46,98,97,115,101,46,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,114,101,99,105,112,95,105,109,97,103,101,95,116,101,120,101,108,95,115,105,122,101,95,111,110,95,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,59,10,32,32,105,109,97,103,101,95,105,110,102,111,46,105,109,97,103,101,95,115,105,122,101,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,41,59,10,32,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,98,111,116,116,111,109,95,108,101,102,116,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,41,59,10,32,32,105,109,97,103,101,95,105,110,102,111,46,109,97,115,116,101,114,95,105,110,100,101,120,95,116,105,108,101,95,108,97,121,101,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,108,97,121,101,114,59,10,10,32,32,47,42,32,99,108,97,109,112,32,108,111,100,32,97,119,97,121,32,102,114,111,109,32,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,32,42,47,10,32,32,108,111,100,32,61,32,109,105,110,40,108,111,100,44,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,77,65,71,69,95,65,84,76,65,83,95,67,79,76,79,82,95,84,73,76,69,95,76,79,71,50,95,83,73,90,69,41,32,45,32,48,46,53,41,59,10,10,32,32,105,102,32,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,101,97,114,101,115,116,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,111,100,32,61,32,99,101,105,108,40,108,111,100,41,59,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,113,44,32,105,109,97,103,101,95,105,110,102,111,44,32,108,111,100,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,108,105,110,101,97,114,41,32,124,124,32,108,111,100,32,62,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,111,100,32,61,32,114,111,117,110,100,40,108,111,100,41,59,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,113,44,32,105,109,97,103,101,95,105,110,102,111,44,32,105,110,116,40,108,111,100,41,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,97,116,108,97,115,95,105,109,97,103,101,40,113,44,32,105,109,97,103,101,95,105,110,102,111,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,105,109,97,103,101,95,99,111,108,111,114,59,10,125,10,10,35,101,108,115,101,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,97,116,108,97,115,41,40,105,110,32,118,101,99,50,32,113,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,49,46,48,41,59,10,125,10,10,35,101,110,100,105,102,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,116,101,120,116,117,114,101,41,40,105,110,32,115,97,109,112,108,101,114,50,68,32,115,117,114,102,97,99,101,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,118,101,99,52,32,105,109,97,103,101,95,99,111,108,111,114,59,10,10,32,32,116,101,120,101,108,95,99,111,111,114,100,32,43,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,121,41,59,10,32,32,105,102,32,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,101,97,114,101,115,116,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,115,117,114,102,97,99,101,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,105,109,97,103,101,95,102,105,108,116,101,114,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,108,105,110,101,97,114,41,32,124,124,32,108,111,100,32,62,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,115,117,114,102,97,99,101,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,109,97,103,101,95,99,111,108,111,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,115,117,114,102,97,99,101,44,32,116,101,120,101,108,95,99,111,111,114,100,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,105,109,97,103,101,95,99,111,108,111,114,59,10,125,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,41,40,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,116,101,120,116,117,114,101,41,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,48,41,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,108,111,100,41,59,10,125,10,10,35,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,83,85,80,80,79,82,84,95,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,41,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,98,105,110,100,108,101,115,115,41,40,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,35,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,85,86,69,67,50,41,10,32,32,32,32,117,118,101,99,50,32,104,97,110,100,108,101,59,10,32,32,32,32,104,97,110,100,108,101,46,120,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,108,111,119,95,104,97,110,100,108,101,59,10,32,32,32,32,104,97,110,100,108,101,46,121,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,104,105,103,104,95,104,97,110,100,108,101,59,10,32,32,35,101,108,115,101,10,32,32,32,32,117,105,110,116,54,52,95,116,32,104,97,110,100,108,101,59,10,32,32,32,32,104,97,110,100,108,101,32,61,32,117,105,110,116,54,52,95,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,104,105,103,104,95,104,97,110,100,108,101,41,32,60,60,32,117,105,110,116,54,52,95,116,40,51,50,117,41,59,10,32,32,32,32,104,97,110,100,108,101,32,124,61,32,117,105,110,116,54,52,95,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,98,105,110,100,108,101,115,115,95,108,111,119,95,104,97,110,100,108,101,41,59,10,32,32,35,101,110,100,105,102,10,10,32,32,115,97,109,112,108,101,114,50,68,32,105,109,32,61,32,115,97,109,112,108,101,114,50,68,40,104,97,110,100,108,101,41,59,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,116,101,120,116,117,114,101,41,40,105,109,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,108,111,100,41,59,10,125,10,10,35,101,108,115,101,10,10,118,101,99,52,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,98,105,110,100,108,101,115,115,41,40,105,110,32,118,101,99,50,32,112,44,32,105,110,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,49,46,48,41,59,10,125,10,10,35,101,110,100,105,102,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,98,114,117,115,104,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,41,10,123,10,32,32,118,101,99,50,32,112,44,32,100,112,100,120,44,32,100,112,100,121,59,10,32,32,118,101,99,52,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,112,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,41,59,10,32,32,100,112,100,120,32,61,32,100,70,100,120,40,112,41,59,10,32,32,100,112,100,121,32,61,32,100,70,100,121,40,112,41,59,10,10,32,32,105,102,32,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,32,62,32,48,46,48,10,32,32,32,32,32,32,38,38,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,32,62,32,48,46,48,10,32,32,32,32,32,32,38,38,32,40,115,117,98,95,115,104,97,100,101,114,32,38,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,117,105,110,116,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,105,109,97,103,101,95,116,121,112,101,44,32,109,105,112,109,97,112,95,109,97,120,95,108,101,118,101,108,59,10,32,32,32,32,32,32,118,101,99,50,32,113,59,10,32,32,32,32,32,32,102,108,111,97,116,32,108,111,100,59,10,10,32,32,32,32,32,32,47,42,32,67,108,97,109,112,32,116,104,101,32,105,109,97,103,101,32,99,111,111,114,100,105,110,97,116,101,32,116,111,32,116,104,101,32,100,105,109,101,110,115,105,111,110,115,32,111,102,32,116,104,101,32,105,109,97,103,101,59,10,32,32,32,32,32,32,32,42,32,83,104,111,117,108,100,32,119,101,32,97,108,108,111,119,32,102,111,114,32,114,101,112,101,97,116,32,109,111,100,101,115,32,97,115,32,119,101,108,108,63,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,113,46,120,32,61,32,99,108,97,109,112,40,112,46,120,44,32,48,46,48,44,32,102,108,111,97,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,120,41,32,45,32,49,46,48,41,59,10,32,32,32,32,32,32,113,46,121,32,61,32,99,108,97,109,112,40,112,46,121,44,32,48,46,48,44,32,102,108,111,97,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,115,105,122,101,95,121,41,32,45,32,49,46,48,41,59,10,32,32,32,32,32,32,105,109,97,103,101,95,116,121,112,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,105,109,97,103,101,95,102,105,108,116,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,105,108,116,101,114,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,109,105,112,109,97,112,95,109,97,120,95,108,101,118,101,108,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,109,105,112,109,97,112,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,109,105,112,109,97,112,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,105,102,32,40,109,105,112,109,97,112,95,109,97,120,95,108,101,118,101,108,32,62,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,104,111,59,10,32,32,32,32,32,32,32,32,32,32,114,104,111,32,61,32,40,100,111,116,40,100,112,100,120,44,32,100,112,100,120,41,32,43,32,100,111,116,40,100,112,100,121,44,32,100,112,100,121,41,41,32,42,32,48,46,53,59,10,32,32,32,32,32,32,32,32,32,32,108,111,100,32,61,32,48,46,53,32,42,32,108,111,103,50,40,109,97,120,40,49,46,48,44,32,114,104,111,41,41,59,10,32,32,32,32,32,32,32,32,32,32,108,111,100,32,61,32,109,105,110,40,102,108,111,97,116,40,109,105,112,109,97,112,95,109,97,120,95,108,101,118,101,108,41,44,32,108,111,100,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,108,111,100,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,105,102,32,40,105,109,97,103,101,95,116,121,112,101,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,111,110,95,97,116,108,97,115,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,97,116,108,97,115,41,40,113,44,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,108,111,100,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,105,109,97,103,101,95,116,121,112,101,32,61,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,116,121,112,101,95,98,105,110,100,108,101,115,115,95,116,101,120,116,117,114,101,50,100,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,98,105,110,100,108,101,115,115,41,40,113,44,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,108,111,100,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,98,114,117,115,104,95,105,109,97,103,101,95,111,102,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,41,40,113,44,32,105,109,97,103,101,95,102,105,108,116,101,114,44,32,108,111,100,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,66,69,87,65,82,69,58,32,119,101,32,97,114,101,32,106,117,115,116,32,116,101,115,116,105,110,103,32,105,102,32,116,104,101,32,102,111,114,109,97,116,32,98,105,116,115,32,97,114,101,32,110,111,110,45,122,101,114,111,59,10,32,32,32,32,32,32,32,42,32,87,101,32,103,101,116,32,97,119,97,121,32,119,105,116,104,32,116,104,105,115,32,102,111,114,32,110,111,119,32,98,101,99,97,117,115,101,32,116,104,101,114,101,32,97,114,101,32,111,110,108,121,32,116,119,111,10,32,32,32,32,32,32,32,42,32,105,109,97,103,101,45,102,111,114,109,97,116,115,58,32,114,103,98,97,32,97,110,100,32,112,114,101,109,117,108,116,105,112,108,105,101,100,95,114,103,98,97,32,119,105,116,104,32,97,32,110,111,110,45,122,101,114,111,10,32,32,32,32,32,32,32,42,32,118,97,108,117,101,32,105,110,100,105,99,97,116,101,105,110,103,32,116,104,97,116,32,116,104,101,32,114,103,98,32,99,111,109,112,111,110,101,110,116,115,32,97,114,101,32,112,114,101,45,109,117,108,116,105,112,108,105,101,100,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,32,40,40,115,117,98,95,115,104,97,100,101,114,32,38,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,105,109,97,103,101,95,102,111,114,109,97,116,95,109,97,115,107,41,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,46,114,103,98,32,42,61,32,114,101,116,117,114,110,95,118,97,108,117,101,46,97,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,32,43,61,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,105,109,97,103,101,95,114,97,119,95,100,97,116,97,95,115,105,122,101,41,40,41,59,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_image_brush.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,57,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,110,101,97,114,101,115,116,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,48,39,116,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,76,79,68,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,48,93,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,48,39,116,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,76,79,68,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,48,93,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,99,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,48,39,116,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,48,93,44,32,116,101,120,101,108,95,99,111,111,114,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,110,101,97,114,101,115,116,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,110,97,109,101,100,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,119,104,105,99,104,32,119,104,105,99,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,32,119,105,116,104,32,48,32,60,61,32,119,104,105,99,104,32,60,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,76,79,68,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,105,110,116,32,119,104,105,99,104,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,110,101,97,114,101,115,116,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,119,104,105,99,104,93,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,108,105,110,101,97,114,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,110,97,109,101,100,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,119,104,105,99,104,32,119,104,105,99,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,32,119,105,116,104,32,48,32,60,61,32,119,104,105,99,104,32,60,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,32,92,112,97,114,97,109,32,108,111,100,32,76,79,68,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,105,110,116,32,119,104,105,99,104,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,44,32,105,110,32,102,108,111,97,116,32,108,111,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,108,105,110,101,97,114,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,119,104,105,99,104,93,44,32,116,101,120,101,108,95,99,111,111,114,100,44,32,108,111,100,41,59,10,125,10,10,47,42,33,10,32,42,32,92,98,114,105,101,102,32,83,97,109,112,108,101,32,119,105,116,104,32,99,117,98,105,99,32,102,105,108,116,101,114,105,110,103,32,102,114,111,109,32,116,104,101,32,110,97,109,101,100,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,10,32,42,32,92,112,97,114,97,109,32,119,104,105,99,104,32,119,104,105,99,104,32,101,120,116,101,114,110,97,108,32,116,101,120,116,117,114,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,115,97,109,112,108,101,32,119,105,116,104,32,48,32,60,61,32,119,104,105,99,104,32,60,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,10,32,42,32,92,112,97,114,97,109,32,116,101,120,101,108,95,99,111,111,114,100,32,116,101,120,101,108,32,99,111,111,114,100,105,110,97,116,101,115,32,40,105,46,101,46,32,112,105,120,101,108,32,118,97,108,117,101,115,41,32,111,102,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,40,105,110,32,105,110,116,32,119,104,105,99,104,44,32,105,110,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,99,117,98,105,99,95,102,105,108,116,101,114,95,116,101,120,116,117,114,101,40,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,119,104,105,99,104,93,44,32,116,101,120,101,108,95,99,111,111,114,100,41,59,10,125,10,47,42,33,32,64,125,32,42,47,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_context_texture.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
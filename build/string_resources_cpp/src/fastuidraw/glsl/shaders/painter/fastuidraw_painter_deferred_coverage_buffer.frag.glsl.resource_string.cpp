@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,69,70,69,82,82,69,68,95,67,79,86,69,82,65,71,69,95,84,69,88,84,85,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,59,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,95,118,97,108,117,101,95,97,116,40,105,118,101,99,50,32,112,41,10,123,10,32,32,47,42,32,87,101,32,110,101,101,100,32,116,111,32,99,108,97,109,112,32,116,104,101,32,116,104,101,32,118,97,108,117,101,32,112,32,105,110,116,111,32,116,104,101,32,114,97,110,103,101,32,116,104,97,116,32,116,104,101,10,32,32,32,42,32,100,114,97,119,110,32,105,116,101,109,32,105,115,32,97,108,108,111,119,101,100,32,116,111,32,117,115,101,32,102,114,111,109,32,116,104,101,32,99,111,118,101,114,97,103,101,32,98,117,102,102,101,114,46,10,32,32,32,42,32,73,102,32,112,32,105,115,32,111,117,116,115,105,100,101,32,111,102,32,116,104,101,32,114,97,110,103,101,44,32,116,104,101,110,32,119,101,32,114,101,116,117,114,110,32,48,46,10,32,32,32,42,47,10,32,32,112,46,120,32,43,61,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,111,102,102,115,101,116,95,120,59,10,32,32,112,46,121,32,43,61,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,111,102,102,115,101,116,95,121,59,10,32,32,105,102,32,40,112,46,120,32,60,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,109,105,110,95,120,10,32,32,32,32,32,32,124,124,32,112,46,121,32,60,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,109,105,110,95,121,10,32,32,32,32,32,32,124,124,32,112,46,120,32,62,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,109,97,120,95,120,10,32,32,32,32,32,32,124,124,32,112,46,121,32,62,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,98,117,102,102,101,114,95,109,97,120,95,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,44,32,112,44,32,48,41,46,114,59,10,32,32,32,32,125,10,125,10,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,32,92,10,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,95,98,117,102,102,101,114,95,118,97,108,117,101,95,97,116,40,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,41,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_deferred_coverage_buffer.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
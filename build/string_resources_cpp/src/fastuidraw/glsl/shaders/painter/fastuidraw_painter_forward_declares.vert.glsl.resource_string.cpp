@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,111,114,119,97,114,100,95,100,101,99,108,97,114,101,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,111,114,119,97,114,100,95,100,101,99,108,97,114,101,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,104,101,97,100,101,114,40,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,99,108,105,112,112,105,110,103,40,105,110,32,117,105,110,116,32,99,108,105,112,112,105,110,103,95,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,112,105,110,103,95,100,97,116,97,32,112,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,105,116,101,109,95,109,97,116,114,105,120,40,105,110,32,117,105,110,116,32,105,116,101,109,95,109,97,116,114,105,120,95,108,111,99,97,116,105,111,110,44,32,111,117,116,32,109,97,116,51,32,109,44,32,111,117,116,32,118,101,99,50,32,116,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,98,114,117,115,104,95,97,100,106,117,115,116,40,105,110,32,117,105,110,116,32,112,97,105,110,116,101,114,95,97,100,106,117,115,116,95,108,111,99,97,116,105,111,110,44,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,97,100,106,117,115,116,95,100,97,116,97,32,112,41,59,10,10,35,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,82,69,78,68,69,82,95,84,79,95,67,79,76,79,82,95,66,85,70,70,69,82,41,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,118,101,114,116,95,115,104,97,100,101,114,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,44,32,111,117,116,32,105,110,116,32,97,100,100,95,122,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,98,114,117,115,104,95,112,44,32,111,117,116,32,118,101,99,51,32,111,117,116,95,99,108,105,112,95,112,41,59,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,114,117,115,104,95,118,101,114,116,95,115,104,97,100,101,114,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,44,32,105,110,32,118,101,99,50,32,98,114,117,115,104,95,112,41,59,10,10,10,35,101,108,115,101,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,118,101,114,116,95,115,104,97,100,101,114,40,105,110,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,32,104,44,32,111,117,116,32,118,101,99,51,32,111,117,116,95,99,108,105,112,95,112,41,59,10,10,35,101,110,100,105,102,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_forward_declares.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,111,117,116,32,102,108,111,97,116,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,59,10,10,118,111,105,100,10,109,97,105,110,40,118,111,105,100,41,10,123,10,32,32,102,108,111,97,116,32,118,32,61,32,48,46,48,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,109,105,114,114,111,114,95,118,97,114,121,105,110,103,115,40,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,41,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,82,85,78,95,73,84,69,77,95,70,82,65,71,95,83,72,65,68,69,82,10,32,32,105,102,32,40,70,65,83,84,85,73,68,82,65,87,95,82,85,78,95,73,84,69,77,95,70,82,65,71,95,83,72,65,68,69,82,41,10,32,32,35,101,110,100,105,102,10,32,32,32,32,123,10,32,32,32,32,32,32,118,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,102,114,97,103,95,115,104,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,95,67,79,76,79,82,95,87,82,73,84,69,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,32,61,32,48,46,48,59,10,32,32,32,32,125,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,100,101,102,101,114,114,101,100,95,99,111,118,101,114,97,103,101,32,61,32,118,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_main_deferred_coverage.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,111,102,102,115,101,116,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,100,101,102,97,117,108,116,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,111,102,102,115,101,116,32,61,32,112,114,101,95,111,102,102,115,101,116,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,74,110,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,74,110,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,102,108,111,97,116,32,114,44,32,100,101,116,44,32,108,97,109,98,100,97,59,10,10,32,32,100,101,116,32,61,32,100,111,116,40,74,110,49,44,32,110,48,41,59,10,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,101,116,41,59,10,32,32,114,32,61,32,40,100,101,116,32,33,61,32,48,46,48,41,32,63,32,40,100,111,116,40,110,48,44,32,110,49,41,32,45,32,49,46,48,41,32,47,32,100,101,116,32,58,32,48,46,48,59,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,95,109,97,115,107,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,108,97,109,98,100,97,59,10,32,32,32,32,125,10,10,32,32,47,42,32,101,110,102,111,114,99,101,32,109,105,116,101,114,45,108,105,109,105,116,32,42,47,10,32,32,105,102,32,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,109,109,59,10,10,32,32,32,32,32,32,109,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,97,98,115,40,114,41,32,47,32,115,113,114,116,40,49,46,48,32,43,32,114,32,42,32,114,41,59,10,32,32,32,32,32,32,114,32,61,32,99,108,97,109,112,40,114,44,32,45,109,109,44,32,109,109,41,59,10,32,32,32,32,125,10,32,32,111,102,102,115,101,116,32,61,32,108,97,109,98,100,97,32,42,32,40,110,48,32,43,32,114,32,42,32,74,110,48,41,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,109,105,116,101,114,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,74,110,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,74,110,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,118,101,99,50,32,110,48,95,112,108,117,115,95,110,49,32,61,32,110,48,32,43,32,110,49,59,10,32,32,102,108,111,97,116,32,114,44,32,108,97,109,98,100,97,44,32,100,101,110,59,10,10,32,32,108,97,109,98,100,97,32,61,32,115,105,103,110,40,100,111,116,40,74,110,48,44,32,110,49,41,41,59,10,32,32,100,101,110,32,61,32,49,46,48,32,43,32,100,111,116,40,110,48,44,32,110,49,41,59,10,32,32,114,32,61,32,40,100,101,110,32,33,61,32,48,46,48,41,32,63,32,49,46,48,32,47,32,100,101,110,32,58,32,48,46,48,59,10,10,32,32,47,42,32,101,110,102,111,114,99,101,32,109,105,116,101,114,95,108,105,109,105,116,32,42,47,10,32,32,105,102,32,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,100,44,32,100,101,110,95,109,59,10,32,32,32,32,32,32,100,32,61,32,100,111,116,40,110,48,95,112,108,117,115,95,110,49,44,32,110,48,95,112,108,117,115,95,110,49,41,59,10,32,32,32,32,32,32,100,101,110,95,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,100,101,110,59,10,32,32,32,32,32,32,105,102,32,40,100,32,62,61,32,100,101,110,95,109,32,42,32,100,101,110,95,109,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,32,61,32,48,46,53,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,47,47,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,47,32,115,113,114,116,40,100,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,114,32,61,32,109,97,120,40,114,44,32,48,46,53,41,32,42,32,108,97,109,98,100,97,59,10,32,32,111,102,102,115,101,116,32,61,32,114,32,42,32,40,110,48,95,112,108,117,115,95,110,49,41,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,118,101,99,50,32,99,115,59,10,32,32,99,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,46,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,105,110,95,115,105,103,110,95,109,97,115,107,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,111,102,102,115,101,116,32,61,32,99,115,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,111,102,102,115,101,116,32,61,32,112,114,101,95,111,102,102,115,101,116,32,43,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,118,101,99,50,32,110,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,32,61,32,118,101,99,50,40,110,46,121,44,32,45,110,46,120,41,59,10,32,32,111,102,102,115,101,116,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,46,120,32,42,32,118,32,43,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,46,121,32,42,32,112,114,101,95,111,102,102,115,101,116,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,41,10,123,10,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,10,32,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,109,105,116,101,114,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,100,101,102,97,117,108,116,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,41,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,100,101,102,97,117,108,116,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,44,32,99,108,105,112,95,112,59,10,32,32,118,101,99,50,32,110,59,10,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,101,110,100,95,115,117,98,95,101,100,103,101,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,32,43,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,49,46,48,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,125,10,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,112,114,101,95,111,102,102,115,101,116,41,59,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,111,102,102,115,101,116,32,61,32,110,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,109,105,116,101,114,95,99,108,105,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,118,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,118,101,99,50,32,112,48,44,32,112,49,44,32,100,101,108,116,97,95,100,44,32,100,48,44,32,100,49,59,10,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,102,108,111,97,116,32,100,101,116,44,32,114,44,32,114,48,44,32,114,49,44,32,108,97,109,98,100,97,59,10,10,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,111,116,40,118,49,44,32,110,48,41,41,59,10,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,108,97,109,98,100,97,95,110,101,103,97,116,101,100,95,109,97,115,107,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,108,97,109,98,100,97,32,61,32,45,108,97,109,98,100,97,59,10,32,32,32,32,125,10,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,10,32,32,110,48,32,61,32,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,59,10,32,32,110,49,32,61,32,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,49,41,59,10,10,32,32,47,42,32,108,101,116,32,112,48,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,48,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,32,42,47,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,114,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,100,48,32,61,32,114,48,32,42,32,110,48,59,10,10,32,32,47,42,32,108,101,116,32,112,49,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,49,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,32,42,47,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,49,44,32,48,46,48,41,59,10,32,32,114,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,100,49,32,61,32,114,49,32,42,32,110,49,59,10,10,32,32,47,42,32,110,111,119,32,99,111,109,112,117,116,101,32,119,104,101,114,101,32,116,104,101,32,108,105,110,101,115,32,76,48,32,97,110,100,32,76,49,32,105,110,116,101,114,115,101,99,116,10,32,32,32,42,32,119,104,101,114,101,32,76,48,32,61,32,123,32,112,48,32,43,32,115,32,42,32,118,48,32,124,32,115,32,62,32,48,125,10,32,32,32,42,32,97,110,100,32,76,49,32,61,32,123,32,112,49,32,45,32,115,32,42,32,118,49,32,124,32,115,32,62,32,48,125,10,32,32,32,42,47,10,32,32,100,101,108,116,97,95,100,32,61,32,100,49,32,45,32,100,48,59,10,32,32,100,101,116,32,61,32,118,48,46,120,32,42,32,118,49,46,121,32,45,32,118,48,46,121,32,42,32,118,49,46,120,59,10,10,32,32,105,102,32,40,100,101,116,32,33,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,61,32,40,118,49,46,121,32,42,32,100,101,108,116,97,95,100,46,120,32,45,32,118,49,46,120,32,42,32,100,101,108,116,97,95,100,46,121,41,32,47,32,100,101,116,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,32,61,32,48,46,48,59,10,32,32,32,32,125,10,10,32,32,32,32,32,32,47,42,32,109,105,116,101,114,32,108,105,109,105,116,59,32,119,101,32,117,115,101,32,116,104,101,32,100,105,115,116,97,110,99,101,32,105,110,100,117,99,101,115,10,32,32,32,32,32,32,32,42,32,102,114,111,109,32,100,48,32,115,105,110,99,101,32,116,104,101,32,109,105,116,101,114,45,112,111,105,110,116,32,105,115,32,112,97,105,114,101,100,10,32,32,32,32,32,32,32,42,32,119,105,116,104,32,100,48,46,10,32,32,32,32,32,32,42,47,10,32,32,105,102,32,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,109,44,32,109,109,44,32,108,100,48,59,10,10,32,32,32,32,32,32,47,42,32,109,105,116,101,114,32,100,105,115,116,97,110,99,101,44,32,119,104,105,99,104,32,105,115,32,109,101,97,115,117,114,101,32,102,114,111,109,32,116,104,101,10,32,32,32,32,32,32,32,42,32,112,111,105,110,116,32,111,102,32,116,104,101,32,112,97,116,104,32,40,103,105,118,101,110,32,98,121,32,112,111,115,105,116,105,111,110,41,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,108,101,110,103,116,104,40,100,48,41,59,10,10,32,32,32,32,32,32,47,42,32,116,104,101,32,118,97,108,117,101,32,114,32,105,115,32,104,111,119,32,109,117,99,104,32,116,111,32,111,102,102,115,101,116,32,105,110,32,116,104,101,10,32,32,32,32,32,32,32,42,32,100,105,114,101,99,116,105,111,110,32,118,48,59,32,87,101,32,104,97,118,101,32,97,32,114,105,103,104,116,32,116,114,105,97,110,103,108,101,10,32,32,32,32,32,32,32,42,32,40,99,111,114,110,101,114,32,97,116,32,112,111,115,105,116,105,111,110,41,44,32,104,101,105,103,104,116,32,105,115,32,97,108,111,110,103,32,110,48,44,10,32,32,32,32,32,32,32,42,32,105,115,32,119,105,116,104,32,104,101,105,103,104,116,32,114,48,32,97,110,100,32,116,104,101,32,108,101,110,103,116,104,32,105,115,32,103,105,118,101,110,10,32,32,32,32,32,32,32,42,32,98,121,32,114,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,109,109,32,61,32,109,32,42,32,97,98,115,40,114,41,32,47,32,108,101,110,103,116,104,40,100,48,32,43,32,114,32,42,32,118,48,41,59,10,32,32,32,32,32,32,114,32,61,32,99,108,97,109,112,40,114,44,32,45,109,109,44,32,109,109,41,59,10,32,32,32,32,125,10,10,32,32,111,102,102,115,101,116,32,61,32,100,48,32,43,32,114,32,42,32,118,48,59,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,109,105,116,101,114,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,50,32,110,48,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,48,32,61,32,118,101,99,50,40,110,48,46,121,44,32,45,110,48,46,120,41,59,10,32,32,118,101,99,50,32,110,49,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,118,49,32,61,32,118,101,99,50,40,110,49,46,121,44,32,45,110,49,46,120,41,59,10,32,32,118,101,99,50,32,112,48,44,32,112,49,44,32,100,101,108,116,97,95,100,44,32,100,48,44,32,100,49,59,10,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,102,108,111,97,116,32,100,101,116,44,32,114,44,32,114,48,44,32,114,49,44,32,108,97,109,98,100,97,59,10,10,32,32,108,97,109,98,100,97,32,61,32,45,115,105,103,110,40,100,111,116,40,118,49,44,32,110,48,41,41,59,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,10,32,32,110,48,32,61,32,110,111,114,109,97,108,105,122,101,40,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,48,41,41,59,10,32,32,110,49,32,61,32,110,111,114,109,97,108,105,122,101,40,108,97,109,98,100,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,49,41,41,59,10,10,32,32,47,42,32,108,101,116,32,112,48,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,48,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,32,42,47,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,48,44,32,48,46,48,41,59,10,32,32,114,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,100,48,32,61,32,114,48,32,42,32,110,48,59,10,10,32,32,47,42,32,108,101,116,32,112,49,32,98,101,32,112,32,109,111,118,101,100,32,98,121,32,110,49,32,116,104,101,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,46,32,42,47,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,49,44,32,48,46,48,41,59,10,32,32,114,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,100,49,32,61,32,114,49,32,42,32,110,49,59,10,10,32,32,47,42,32,110,111,119,32,99,111,109,112,117,116,101,32,119,104,101,114,101,32,116,104,101,32,108,105,110,101,115,32,76,48,32,97,110,100,32,76,49,32,105,110,116,101,114,115,101,99,116,10,32,32,32,42,32,119,104,101,114,101,32,76,48,32,61,32,123,32,112,48,32,43,32,115,32,42,32,118,48,32,124,32,115,32,62,32,48,125,10,32,32,32,42,32,97,110,100,32,76,49,32,61,32,123,32,112,49,32,45,32,115,32,42,32,118,49,32,124,32,115,32,62,32,48,125,10,32,32,32,42,47,10,32,32,100,101,108,116,97,95,100,32,61,32,100,49,32,45,32,100,48,59,10,32,32,100,101,116,32,61,32,118,48,46,120,32,42,32,118,49,46,121,32,45,32,118,48,46,121,32,42,32,118,49,46,120,59,10,10,32,32,105,102,32,40,100,101,116,32,33,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,105,110,118,101,114,115,101,95,100,101,116,59,10,10,32,32,32,32,32,32,105,110,118,101,114,115,101,95,100,101,116,32,61,32,49,46,48,32,47,32,100,101,116,59,10,32,32,32,32,32,32,114,32,61,32,40,118,49,46,121,32,42,32,100,101,108,116,97,95,100,46,120,32,45,32,118,49,46,120,32,42,32,100,101,108,116,97,95,100,46,121,41,32,42,32,105,110,118,101,114,115,101,95,100,101,116,59,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,100,48,32,43,32,114,32,42,32,118,48,59,10,10,32,32,32,32,32,32,47,42,32,105,110,102,111,114,99,101,32,109,105,116,101,114,45,108,105,109,105,116,46,32,42,47,10,32,32,32,32,32,32,105,102,32,40,109,105,116,101,114,95,108,105,109,105,116,32,62,61,32,48,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,44,32,109,109,44,32,108,59,10,10,32,32,32,32,32,32,32,32,32,32,109,32,61,32,109,105,116,101,114,95,108,105,109,105,116,32,42,32,109,97,120,40,114,48,44,32,114,49,41,59,10,32,32,32,32,32,32,32,32,32,32,108,32,61,32,108,101,110,103,116,104,40,111,102,102,115,101,116,41,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,108,32,62,32,109,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,48,46,53,32,42,32,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,47,47,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,107,32,61,32,48,46,53,32,42,32,108,101,110,103,116,104,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,42,61,32,109,97,120,40,109,44,32,107,41,32,47,32,108,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,111,102,102,115,101,116,32,61,32,48,46,53,32,42,32,40,100,48,32,43,32,100,49,41,59,10,32,32,32,32,125,10,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,114,111,117,110,100,101,100,95,106,111,105,110,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,50,32,110,48,44,32,110,49,59,10,32,32,102,108,111,97,116,32,105,110,116,101,114,112,111,108,97,116,101,59,10,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,118,101,99,50,32,116,48,44,32,116,49,44,32,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,115,99,114,101,101,110,95,116,44,32,115,99,114,101,101,110,95,110,59,10,32,32,109,97,116,50,32,81,44,32,97,100,106,81,59,10,32,32,102,108,111,97,116,32,100,59,10,10,32,32,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,112,114,101,95,111,102,102,115,101,116,46,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,114,109,97,108,48,95,121,95,115,105,103,110,95,109,97,115,107,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,110,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,117,110,105,116,95,118,101,99,116,111,114,40,112,114,101,95,111,102,102,115,101,116,46,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,114,109,97,108,49,95,121,95,115,105,103,110,95,109,97,115,107,32,38,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,105,110,116,101,114,112,111,108,97,116,101,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,46,120,59,10,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,99,111,109,112,117,116,101,95,81,95,97,100,106,111,105,110,116,95,81,40,99,108,105,112,95,112,44,32,81,44,32,97,100,106,81,41,59,10,10,32,32,116,48,32,61,32,118,101,99,50,40,45,110,48,46,121,44,32,110,48,46,120,41,59,10,32,32,116,49,32,61,32,118,101,99,50,40,45,110,49,46,121,44,32,110,49,46,120,41,59,10,32,32,115,99,114,101,101,110,95,116,48,32,61,32,110,111,114,109,97,108,105,122,101,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,32,42,32,40,81,32,42,32,116,48,41,41,59,10,32,32,115,99,114,101,101,110,95,116,49,32,61,32,110,111,114,109,97,108,105,122,101,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,32,42,32,40,81,32,42,32,116,49,41,41,59,10,32,32,100,32,61,32,100,111,116,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,41,59,10,10,32,32,105,102,32,40,100,32,62,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,115,99,114,101,101,110,95,116,32,61,32,109,105,120,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,105,110,116,101,114,112,111,108,97,116,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,34,74,111,121,34,44,32,115,99,114,101,101,110,95,116,48,32,97,110,100,32,115,99,114,101,101,110,95,116,49,32,112,111,105,110,116,32,105,110,32,100,105,102,102,101,114,101,110,116,10,32,32,32,32,32,32,32,42,32,100,105,114,101,99,116,105,111,110,115,46,32,73,110,32,116,104,105,115,32,112,97,105,110,102,117,108,32,99,97,115,101,32,119,101,32,119,105,108,108,32,105,110,116,101,114,112,111,108,97,116,101,10,32,32,32,32,32,32,32,42,32,97,108,111,110,103,32,97,32,99,105,114,99,108,101,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,115,99,114,101,101,110,95,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,105,114,99,117,108,97,114,95,105,110,116,101,114,112,111,108,97,116,101,40,115,99,114,101,101,110,95,116,48,44,32,115,99,114,101,101,110,95,116,49,44,32,100,44,32,105,110,116,101,114,112,111,108,97,116,101,41,59,10,32,32,32,32,125,10,32,32,115,99,114,101,101,110,95,110,32,61,32,118,101,99,50,40,115,99,114,101,101,110,95,116,46,121,44,32,45,115,99,114,101,101,110,95,116,46,120,41,59,10,10,32,32,111,102,102,115,101,116,32,61,32,97,100,106,81,32,42,32,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,114,101,99,105,112,95,112,105,120,101,108,115,32,42,32,115,99,114,101,101,110,95,110,41,59,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,111,102,102,115,101,116,44,32,48,46,48,41,59,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,115,113,117,97,114,101,95,99,97,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,51,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,44,32,99,108,105,112,95,112,59,10,32,32,102,108,111,97,116,32,115,48,44,32,115,49,59,10,32,32,118,101,99,50,32,110,59,10,10,32,32,47,42,32,109,111,118,101,32,97,108,111,110,103,32,116,97,110,103,101,110,116,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,32,42,47,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,48,46,48,41,59,10,32,32,115,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,48,41,59,10,10,32,32,47,42,32,109,111,118,101,32,97,108,111,110,103,32,110,111,114,109,97,108,32,110,97,109,101,100,32,110,117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,32,42,47,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,32,43,32,115,48,32,42,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,32,49,46,48,41,59,10,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,112,114,101,95,111,102,102,115,101,116,41,59,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,115,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,49,41,59,10,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,111,102,102,115,101,116,32,61,32,115,48,32,42,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,32,43,32,115,49,32,42,32,110,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,114,111,117,110,100,101,100,95,99,97,112,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,118,101,99,50,32,110,32,61,32,112,114,101,95,111,102,102,115,101,116,44,32,118,32,61,32,118,101,99,50,40,110,46,121,44,32,45,110,46,120,41,59,10,32,32,118,101,99,51,32,99,108,105,112,95,110,44,32,99,108,105,112,95,118,44,32,99,108,105,112,95,112,59,10,32,32,118,101,99,50,32,116,110,32,61,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,59,10,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,99,108,105,112,95,112,44,32,110,41,59,10,10,32,32,99,108,105,112,95,118,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,118,44,32,48,46,48,41,59,10,32,32,116,110,46,120,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,116,110,46,120,32,42,32,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,118,41,59,10,10,32,32,99,108,105,112,95,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,110,44,32,48,46,48,41,59,10,32,32,116,110,46,121,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,116,110,46,121,32,42,32,115,116,114,111,107,101,95,114,97,100,105,117,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,110,41,59,10,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,49,46,48,59,10,32,32,111,102,102,115,101,116,32,61,32,116,110,46,120,32,42,32,118,32,43,32,116,110,46,121,32,42,32,110,59,10,125,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,41,40,105,110,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,112,114,101,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,109,105,116,101,114,95,108,105,109,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,10,123,10,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,99,108,105,112,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,109,105,116,101,114,95,99,108,105,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,106,111,105,110,10,32,32,32,32,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,109,105,116,101,114,95,98,101,118,101,108,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,109,105,116,101,114,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,106,111,105,110,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,114,111,117,110,100,101,100,95,106,111,105,110,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,115,113,117,97,114,101,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,115,113,117,97,114,101,95,99,97,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,114,111,117,110,100,101,100,95,99,97,112,41,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,114,111,117,110,100,101,100,95,99,97,112,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,67,65,76,40,99,111,109,112,117,116,101,95,111,102,102,115,101,116,95,112,105,120,101,108,115,95,100,101,102,97,117,108,116,41,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,111,102,102,115,101,116,95,116,121,112,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,44,32,112,114,101,95,111,102,102,115,101,116,44,32,97,117,120,105,108,105,97,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,105,116,101,114,95,108,105,109,105,116,44,32,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_stroke_compute_offset.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,99,111,110,115,116,97,110,116,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,99,111,110,115,116,97,110,116,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,32,49,117,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,107,105,112,95,100,97,115,104,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,95,109,97,115,107,32,50,117,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,95,99,111,110,115,116,97,110,116,32,52,117,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,110,101,103,97,116,105,118,101,95,97,114,99,95,97,110,103,108,101,95,109,97,115,107,32,56,117,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,118,101,114,116,101,100,95,105,110,110,101,114,95,114,101,103,105,111,110,95,109,97,115,107,32,49,54,117,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_stroke_util.constants.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,117,110,105,102,111,114,109,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,117,110,105,102,111,114,109,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,42,33,92,97,100,100,116,111,103,114,111,117,112,32,71,76,83,76,86,101,114,116,70,114,97,103,67,111,100,101,10,32,42,32,64,123,10,32,42,47,10,35,105,102,100,101,102,32,71,76,83,76,95,68,79,88,89,71,69,78,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,10,32,32,32,42,32,84,104,101,32,109,97,120,105,109,117,109,32,110,117,109,98,101,114,32,111,102,32,115,105,109,117,116,97,110,101,111,117,115,32,98,111,117,110,100,32,116,101,120,116,117,114,101,115,32,116,104,97,116,32,116,104,101,32,115,104,97,100,101,114,10,32,32,32,42,32,115,117,112,112,111,114,116,115,44,32,105,46,101,46,32,116,104,101,32,118,97,108,117,101,32,111,102,32,92,114,101,102,10,32,32,32,42,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,69,110,103,105,110,101,58,58,67,111,110,102,105,103,117,114,97,116,105,111,110,66,97,115,101,58,58,110,117,109,98,101,114,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,115,40,41,46,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,10,10,32,32,47,42,33,10,32,32,32,42,32,84,104,101,32,97,114,114,97,121,32,111,102,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,32,111,98,106,101,99,116,115,32,119,104,111,115,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,116,121,112,101,40,41,10,32,32,32,42,32,104,97,115,32,118,97,108,117,101,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,73,109,97,103,101,58,58,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,50,100,32,116,104,97,116,32,97,114,101,32,99,117,114,114,101,110,116,108,121,32,98,111,117,110,100,46,10,32,32,32,42,32,70,111,114,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,66,114,117,115,104,32,105,102,32,105,116,32,104,97,115,32,115,117,99,104,32,97,110,32,105,109,97,103,101,44,32,105,116,32,105,115,32,97,108,119,97,121,115,32,98,111,117,110,100,10,32,32,32,42,32,116,111,32,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,48,93,32,97,110,100,32,102,111,114,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,66,114,117,115,104,83,104,97,100,101,114,68,97,116,97,44,10,32,32,32,42,32,116,104,101,32,105,39,116,104,32,105,110,100,101,120,32,105,110,116,111,32,92,114,101,102,32,102,97,115,116,117,105,100,114,97,119,58,58,80,97,105,110,116,101,114,66,114,117,115,104,83,104,97,100,101,114,68,97,116,97,32,105,115,32,98,111,117,110,100,32,116,111,10,32,32,32,42,32,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,105,93,10,32,32,32,42,47,10,32,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,93,59,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,85,80,80,79,82,84,95,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,10,32,32,32,42,32,73,102,32,116,104,105,115,32,109,97,99,114,111,32,105,115,32,100,101,102,105,110,101,100,44,32,116,104,101,110,32,98,105,110,100,108,101,115,115,32,116,101,120,116,117,114,105,110,103,32,105,115,32,115,117,112,112,111,114,116,101,100,46,10,32,32,32,42,32,66,105,110,100,108,101,115,115,32,116,101,120,116,117,114,105,110,103,32,97,108,108,111,119,115,32,111,110,101,32,116,111,32,99,114,101,97,116,101,32,115,97,109,112,108,101,114,32,111,98,106,101,99,116,32,104,97,110,100,108,101,115,10,32,32,32,42,32,102,114,111,109,32,54,52,45,98,105,116,32,117,105,110,116,32,100,97,116,97,46,32,83,101,101,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,85,86,69,67,50,10,32,32,32,42,32,97,110,100,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,49,50,56,85,32,102,111,114,32,104,111,119,32,116,104,101,32,71,76,83,76,10,32,32,32,42,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,114,101,97,108,105,122,101,115,32,116,104,101,32,54,52,45,98,105,116,32,104,97,110,100,108,101,32,118,97,108,117,101,115,46,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,83,85,80,80,79,82,84,95,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,85,86,69,67,50,10,32,32,32,42,32,73,102,32,116,104,105,115,32,109,97,99,114,111,32,105,115,32,100,101,102,105,110,101,100,44,32,116,104,101,110,32,98,105,110,100,108,101,115,115,32,116,101,120,116,117,114,105,110,103,32,105,115,32,115,117,112,112,111,114,116,101,100,10,32,32,32,42,32,40,115,101,101,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,85,80,80,79,82,84,95,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,41,32,97,110,100,32,116,104,101,32,54,52,45,98,105,116,10,32,32,32,42,32,104,97,110,100,108,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,99,111,110,115,116,114,117,99,116,32,115,97,109,112,108,101,114,32,104,97,110,100,108,101,115,32,105,115,32,114,101,97,108,105,122,101,100,32,97,115,10,32,32,32,42,32,97,32,117,118,101,99,50,32,119,104,101,114,101,32,116,104,101,32,108,111,119,32,51,50,45,98,105,116,115,32,97,114,101,32,105,110,32,116,104,101,32,46,120,32,99,111,109,112,111,110,101,110,116,32,97,110,100,32,116,104,101,10,32,32,32,42,32,104,105,103,104,32,51,50,45,98,105,116,115,32,97,114,101,32,105,110,32,116,104,101,32,46,121,32,99,111,109,112,111,110,101,110,116,46,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,85,86,69,67,50,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,49,50,56,85,10,32,32,32,42,32,73,102,32,116,104,105,115,32,109,97,99,114,111,32,105,115,32,100,101,102,105,110,101,100,44,32,116,104,101,110,32,98,105,110,100,108,101,115,115,32,116,101,120,116,117,114,105,110,103,32,105,115,32,115,117,112,112,111,114,116,101,100,10,32,32,32,42,32,40,115,101,101,32,92,114,101,102,32,70,65,83,84,85,73,68,82,65,87,95,83,85,80,80,79,82,84,95,66,73,78,68,76,69,83,83,95,84,69,88,84,85,82,69,41,32,97,110,100,32,116,104,101,32,54,52,45,98,105,116,10,32,32,32,42,32,104,97,110,100,108,101,32,102,114,111,109,32,119,104,105,99,104,32,116,111,32,99,111,110,115,116,114,117,99,116,32,115,97,109,112,108,101,114,32,104,97,110,100,108,101,115,32,105,115,32,114,101,97,108,105,122,101,100,32,97,115,10,32,32,32,42,32,97,32,117,105,110,116,54,52,95,116,46,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,73,78,68,76,69,83,83,95,72,65,78,68,76,69,95,49,50,56,85,10,10,32,32,47,42,33,10,32,32,32,42,32,92,100,101,102,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,88,41,10,32,32,32,42,32,85,115,101,32,116,104,105,115,32,109,97,99,114,111,32,116,111,32,102,101,116,99,104,32,97,32,115,105,110,103,108,101,32,49,50,56,45,98,105,116,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,32,100,97,116,97,10,32,32,32,42,32,115,116,111,114,101,32,98,117,102,102,101,114,114,101,97,108,105,122,101,100,32,97,115,32,97,32,117,118,101,99,52,46,32,84,111,32,103,101,116,32,102,108,111,97,116,105,110,103,32,112,111,105,110,116,32,100,97,116,97,44,10,32,32,32,42,32,117,115,101,32,116,104,101,32,71,76,83,76,32,98,117,105,108,116,45,105,110,32,102,117,110,99,116,105,111,110,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,41,46,10,32,32,32,42,32,92,112,97,114,97,109,32,88,32,111,102,102,115,101,116,32,105,110,116,111,32,100,97,116,97,32,115,116,111,114,101,32,98,117,102,102,101,114,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,88,41,10,35,101,110,100,105,102,10,47,42,33,32,64,125,32,42,47,10,10,47,47,47,64,99,111,110,100,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,80,97,105,110,116,101,114,32,68,97,116,97,32,83,116,111,114,101,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,84,66,79,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,44,32,105,110,116,40,98,108,111,99,107,41,41,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,83,83,66,79,41,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,52,51,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,115,115,98,111,10,32,32,123,10,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,93,59,10,32,32,125,59,10,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,85,66,79,41,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,49,52,48,41,32,117,110,105,102,111,114,109,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,117,98,111,10,32,32,123,10,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,65,84,65,95,83,84,79,82,69,95,65,82,82,65,89,95,83,73,90,69,93,59,10,32,32,125,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,10,10,35,101,110,100,105,102,10,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,97,115,116,117,105,100,114,97,119,95,99,111,110,116,101,120,116,95,116,101,120,116,117,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,78,85,77,66,69,82,95,67,79,78,84,69,88,84,95,84,69,88,84,85,82,69,83,93,59,10,10,47,47,47,64,101,110,100,99,111,110,100,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_uniforms.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -0,0 +1,5 @@
+#include <fastuidraw/util/static_resource.hpp>
+namespace {const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,108,121,112,104,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,108,121,112,104,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,103,109,97,105,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,118,101,114,116,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,49,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,111,117,116,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,98,108,111,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,122,95,97,100,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,117,116,95,98,114,117,115,104,95,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,51,32,111,117,116,95,99,108,105,112,95,112,41,10,123,10,32,32,118,101,99,50,32,112,44,32,113,44,32,112,117,115,104,44,32,119,104,44,32,112,48,44,32,115,105,103,110,95,119,104,59,10,32,32,98,118,101,99,50,32,105,115,95,109,105,110,95,115,105,100,101,59,10,32,32,102,108,111,97,116,32,103,108,121,112,104,95,109,105,110,44,32,103,108,121,112,104,95,115,105,122,101,59,10,10,32,32,112,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,48,46,120,121,41,59,10,32,32,119,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,48,46,122,119,41,59,10,10,32,32,103,108,121,112,104,95,115,105,122,101,32,61,32,50,46,48,32,42,32,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,59,10,32,32,103,108,121,112,104,95,109,105,110,32,61,32,45,102,97,115,116,117,105,100,114,97,119,95,114,101,115,116,114,105,99,116,101,100,95,114,97,121,115,95,103,108,121,112,104,95,99,111,111,114,100,95,118,97,108,117,101,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,61,32,105,110,95,97,116,116,114,105,98,49,46,122,59,10,10,32,32,105,115,95,109,105,110,95,115,105,100,101,32,61,32,101,113,117,97,108,40,105,110,95,97,116,116,114,105,98,49,46,120,121,44,32,117,118,101,99,50,40,48,117,44,32,48,117,41,41,59,10,10,32,32,47,42,32,119,101,32,119,105,115,104,32,116,111,32,109,97,107,101,32,116,104,101,32,103,108,121,112,104,32,111,110,101,32,112,105,120,101,108,32,108,97,114,103,101,114,32,105,110,32,101,97,99,104,10,32,32,32,42,32,100,105,114,101,99,116,105,111,110,32,116,111,32,105,109,112,114,111,118,101,32,116,104,101,32,97,110,116,105,45,97,108,105,97,115,105,110,103,32,113,117,97,108,105,116,121,46,32,87,101,10,32,32,32,42,32,110,101,101,100,32,116,111,32,102,105,103,117,114,101,32,111,117,116,32,119,104,101,114,101,32,119,101,32,97,114,101,32,105,110,32,116,104,101,32,103,108,121,112,104,32,97,110,100,10,32,32,32,42,32,116,111,32,112,117,115,104,32,105,110,32,116,104,101,32,97,112,112,114,111,112,105,97,116,101,32,100,105,114,101,99,116,105,111,110,46,10,32,32,32,42,47,10,32,32,115,105,103,110,95,119,104,32,61,32,115,105,103,110,40,119,104,41,59,10,32,32,112,117,115,104,46,120,32,61,32,40,105,115,95,109,105,110,95,115,105,100,101,46,120,41,32,63,32,45,115,105,103,110,95,119,104,46,120,32,58,32,43,115,105,103,110,95,119,104,46,120,59,10,32,32,112,117,115,104,46,121,32,61,32,40,105,115,95,109,105,110,95,115,105,100,101,46,121,41,32,63,32,45,115,105,103,110,95,119,104,46,121,32,58,32,43,115,105,103,110,95,119,104,46,121,59,10,10,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,110,117,109,95,112,105,120,101,108,115,32,61,32,50,46,48,59,10,32,32,102,108,111,97,116,32,114,59,10,10,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,44,32,49,46,48,41,59,10,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,117,115,104,44,32,48,46,48,41,59,10,32,32,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,110,117,109,95,112,105,120,101,108,115,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,113,32,61,32,112,32,43,32,114,32,42,32,112,117,115,104,59,10,10,32,32,112,48,46,120,32,61,32,40,105,115,95,109,105,110,95,115,105,100,101,46,120,41,32,63,32,112,46,120,32,58,32,112,46,120,32,45,32,119,104,46,120,59,10,32,32,112,48,46,121,32,61,32,40,105,115,95,109,105,110,95,115,105,100,101,46,121,41,32,63,32,112,46,121,32,58,32,112,46,121,32,45,32,119,104,46,121,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,99,111,111,114,100,95,120,32,61,32,103,108,121,112,104,95,109,105,110,32,43,32,103,108,121,112,104,95,115,105,122,101,32,42,32,40,113,46,120,32,45,32,112,48,46,120,41,32,47,32,40,119,104,46,120,41,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,99,111,111,114,100,95,121,32,61,32,103,108,121,112,104,95,109,105,110,32,43,32,103,108,121,112,104,95,115,105,122,101,32,42,32,40,113,46,121,32,45,32,112,48,46,121,41,32,47,32,40,119,104,46,121,41,59,10,10,32,32,122,95,97,100,100,32,61,32,48,59,10,32,32,111,117,116,95,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,113,44,32,49,46,48,41,59,10,32,32,111,117,116,95,98,114,117,115,104,95,112,32,61,32,113,59,10,125,10, 0 };
+ fastuidraw::static_resource R("fastuidraw_painter_glyph_restricted_rays.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values))); 
+}
@@ -357,6 +357,16 @@ sdl_painter_demo(const std::string &about_text,
                          "painter_use_uber_item_shader",
                          "If true, use an uber-shader for all item shaders",
                          *this),
+  m_compact_attributes(m_painter_params.compact_attributes(),
+                       "painter_compact_attributes",
+                       "If true, only upload the fields of the attributes "
+                       "that the item shaders of a draw read",
+                       *this),
+  m_compact_indices(m_painter_params.compact_indices(),
+                    "painter_compact_indices",
+                    "If true, upload indices as 16-bit values when "
+                    "a draw has few enough vertices",
+                    *this),
   m_uber_blend_use_switch(m_painter_params.blend_shader_use_switch(),
                           "painter_uber_blend_use_switch",
                           "If true, use a switch statement in uber blend shader dispatch",
@@ -485,6 +495,11 @@ sdl_painter_demo(const std::string &about_text,
   m_print_painter_shader_ids(default_value_for_print_painter,
                              "print_painter_shader_ids",
                              "Print PainterBackendGL shader IDs", *this),
+  m_use_null_engine(false, "null_engine",
+                    "If true, the Painter draws to a PainterEngineNull instead "
+                    "of the GL backend: all the CPU work of drawing is done, "
+                    "but nothing is sent to GL and the window shows nothing. "
+                    "Use it to profile the CPU side of a demo", *this),
   m_pixel_counter_stack(-1, "pixel_counter_latency",
                         "If non-negative, will add code to the painter ubder- shader "
                         "to count number of helper and non-helper pixels. The value "
@@ -589,6 +604,8 @@ init_gl(int w, int h)
   APPLY_PARAM(fbf_blending_type, m_fbf_blending_type);
   APPLY_PARAM(support_dual_src_blend_shaders, m_support_dual_src_blend_shaders);
   APPLY_PARAM(use_uber_item_shader, m_use_uber_item_shader);
+  APPLY_PARAM(compact_attributes, m_compact_attributes);
+  APPLY_PARAM(compact_indices, m_compact_indices);
 
 #undef APPLY_PARAM
 
@@ -698,7 +715,23 @@ init_gl(int w, int h)
   fastuidraw::GlyphGenerateParams::banded_rays_max_recursion(m_banded_rays_max_recursion.value());
   fastuidraw::GlyphGenerateParams::banded_rays_average_number_curves_thresh(m_banded_rays_average_number_curves_thresh.value());
 
-  m_painter = FASTUIDRAWnew fastuidraw::Painter(m_backend);
+  if (m_use_null_engine.value())
+    {
+      m_null_engine = fastuidraw::PainterEngineNull::create(m_painter_params.attributes_per_buffer(),
+                                                            m_painter_params.indices_per_buffer(),
+                                                            m_painter_params.data_blocks_per_store_buffer());
+      m_painter = FASTUIDRAWnew fastuidraw::Painter(m_null_engine);
+      if (m_pixel_counter_stack.value() >= 0)
+        {
+          std::cout << "Pixel counting needs the GL backend, ignoring "
+                    << m_pixel_counter_stack.name() << "\n";
+          m_pixel_counter_stack.value() = -1;
+        }
+    }
+  else
+    {
+      m_painter = FASTUIDRAWnew fastuidraw::Painter(m_backend);
+    }
   m_font_database = FASTUIDRAWnew fastuidraw::FontDatabase();
   m_ft_lib = FASTUIDRAWnew fastuidraw::FreeTypeLib();
 
@@ -771,6 +804,8 @@ init_gl(int w, int h)
       LAZY_PARAM_ENUM(vert_shader_use_switch, m_uber_vert_use_switch);
       LAZY_PARAM_ENUM(frag_shader_use_switch, m_uber_frag_use_switch);
       LAZY_PARAM(use_uber_item_shader, m_use_uber_item_shader);
+      LAZY_PARAM_ENUM(compact_attributes, m_compact_attributes);
+      LAZY_PARAM_ENUM(compact_indices, m_compact_indices);
       LAZY_PARAM_ENUM(blend_shader_use_switch, m_uber_blend_use_switch);
       LAZY_PARAM_ENUM(data_store_backing, m_data_store_backing);
       LAZY_PARAM_ENUM(assign_layout_to_vertex_shader_inputs, m_assign_layout_to_vertex_shader_inputs);
@@ -803,7 +838,7 @@ init_gl(int w, int h)
   if (m_print_painter_shader_ids.value())
     {
       const fastuidraw::PainterShaderSet &sh(m_painter->default_shaders());
-      const fastuidraw::PainterShaderRegistrar &rp(m_backend->painter_shader_registrar());
+      const fastuidraw::PainterShaderRegistrar &rp(m_painter->painter_shader_registrar());
       std::cout << "Default shader IDs:\n";
 
       std::cout << "\tGlyph Shaders:\n";
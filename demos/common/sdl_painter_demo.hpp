@@ -3,6 +3,7 @@
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/font_database.hpp>
 #include <fastuidraw/painter/painter.hpp>
+#include <fastuidraw/painter/backend/painter_engine_null.hpp>
 #include <fastuidraw/gl_backend/painter_engine_gl.hpp>
 #include <fastuidraw/gl_backend/painter_surface_gl.hpp>
 #include <fastuidraw/text/font_freetype.hpp>
@@ -94,6 +95,11 @@ protected:
 
   fastuidraw::reference_counted_ptr<fastuidraw::gl::PainterSurfaceGL> m_surface;
   fastuidraw::reference_counted_ptr<fastuidraw::gl::PainterEngineGL> m_backend;
+
+  /* non-null if m_painter draws to a PainterEngineNull,
+   * see the command line option null_engine.
+   */
+  fastuidraw::reference_counted_ptr<fastuidraw::PainterEngineNull> m_null_engine;
   fastuidraw::reference_counted_ptr<fastuidraw::Painter> m_painter;
   fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> m_font_database;
   fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_ft_lib;
@@ -151,6 +157,8 @@ private:
   command_line_argument_value<bool> m_uber_vert_use_switch;
   command_line_argument_value<bool> m_uber_frag_use_switch;
   command_line_argument_value<bool> m_use_uber_item_shader;
+  command_line_argument_value<bool> m_compact_attributes;
+  command_line_argument_value<bool> m_compact_indices;
   command_line_argument_value<bool> m_uber_blend_use_switch;
   command_line_argument_value<bool> m_separate_program_for_discard;
   command_line_argument_value<bool> m_allow_bindless_texture_from_surface;
@@ -171,6 +179,7 @@ private:
   command_separator m_demo_options;
   command_line_argument_value<bool> m_print_painter_config;
   command_line_argument_value<bool> m_print_painter_shader_ids;
+  command_line_argument_value<bool> m_use_null_engine;
 
   /* if we are to record pixel counts only */
   command_line_argument_value<int> m_pixel_counter_stack;
@@ -326,6 +326,118 @@ generate(unsigned int num_threads,
     }
 }
 
+/////////////////////////////
+// GlyphCacheStress methods
+GlyphCacheStress::
+GlyphCacheStress(fastuidraw::GlyphRenderer r,
+                 fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> f,
+                 unsigned int num_glyphs,
+                 fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> atlas):
+  m_render(r),
+  m_font(f),
+  m_created(num_glyphs)
+{
+  m_fetch_cache = FASTUIDRAWnew fastuidraw::GlyphCache(atlas);
+  m_add_cache = FASTUIDRAWnew fastuidraw::GlyphCache(atlas);
+  SDL_AtomicSet(&m_thread_counter, 0);
+  SDL_AtomicSet(&m_add_failures, 0);
+}
+
+int
+GlyphCacheStress::
+execute(void *ptr)
+{
+  GlyphCacheStress *p(static_cast<GlyphCacheStress*>(ptr));
+  std::vector<fastuidraw::Glyph> &fetched(p->m_fetched[SDL_AtomicAdd(&p->m_thread_counter, 1)]);
+
+  fetched.resize(p->m_created.size());
+  for (unsigned int i = 0; i < fetched.size(); ++i)
+    {
+      fetched[i] = p->m_fetch_cache->fetch_glyph(p->m_render, p->m_font.get(), i);
+    }
+
+  for (const fastuidraw::Glyph &G : p->m_created)
+    {
+      if (G.valid() && p->m_add_cache->add_glyph(G) != fastuidraw::routine_success)
+        {
+          SDL_AtomicAdd(&p->m_add_failures, 1);
+        }
+    }
+  return 0;
+}
+
+enum fastuidraw::return_code
+GlyphCacheStress::
+run(unsigned int num_threads,
+    fastuidraw::GlyphRenderer r,
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> f,
+    unsigned int num_glyphs,
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> atlas)
+{
+  GlyphCacheStress S(r, f, fastuidraw::t_min(num_glyphs, f->number_glyphs()), atlas);
+  std::vector<SDL_Thread*> threads;
+  enum fastuidraw::return_code R(fastuidraw::routine_success);
+
+  for (unsigned int i = 0; i < S.m_created.size(); ++i)
+    {
+      S.m_created[i] = fastuidraw::Glyph::create_glyph(r, f, i);
+    }
+
+  num_threads = fastuidraw::t_max(1u, num_threads);
+  S.m_fetched.resize(num_threads);
+  for (unsigned int i = 0; i < num_threads; ++i)
+    {
+      threads.push_back(SDL_CreateThread(execute, "", &S));
+    }
+
+  for (unsigned int i = 0; i < num_threads; ++i)
+    {
+      SDL_WaitThread(threads[i], nullptr);
+    }
+
+  if (SDL_AtomicGet(&S.m_add_failures) != 0)
+    {
+      std::cout << "GlyphCacheStress: " << SDL_AtomicGet(&S.m_add_failures)
+                << " calls to add_glyph() failed\n";
+      R = fastuidraw::routine_fail;
+    }
+
+  for (unsigned int i = 0; i < S.m_created.size(); ++i)
+    {
+      const fastuidraw::Glyph &G(S.m_created[i]);
+      const fastuidraw::Glyph &F(S.m_fetched[0][i]);
+
+      if (G.valid() && (G.cache() != S.m_add_cache.get() || !G.uploaded_to_atlas()))
+        {
+          std::cout << "GlyphCacheStress: created glyph #" << i
+                    << " not added or not uploaded\n";
+          R = fastuidraw::routine_fail;
+        }
+
+      if (F.valid() && !F.uploaded_to_atlas())
+        {
+          std::cout << "GlyphCacheStress: fetched glyph #" << i
+                    << " not uploaded\n";
+          R = fastuidraw::routine_fail;
+        }
+
+      for (unsigned int t = 1; t < num_threads; ++t)
+        {
+          const fastuidraw::Glyph &Ft(S.m_fetched[t][i]);
+          if (Ft.valid() != F.valid()
+              || (F.valid() && Ft.cache_location() != F.cache_location()))
+            {
+              std::cout << "GlyphCacheStress: thread #" << t
+                        << " fetched a different glyph #" << i
+                        << " than thread #0\n";
+              R = fastuidraw::routine_fail;
+            }
+        }
+    }
+
+  return R;
+}
+
 //////////////////////////////
 // global methods
 void
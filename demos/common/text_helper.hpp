@@ -54,6 +54,49 @@ private:
   SDL_atomic_t m_counter;
 };
 
+/* Stress test for the thread safety of GlyphCache: several threads
+ * fetch, generate and upload the SAME glyphs from one GlyphCache and
+ * then add the SAME Glyph values (made with Glyph::create_glyph())
+ * to another GlyphCache. Both caches are created on the passed atlas
+ * and are released at the end of the test.
+ */
+class GlyphCacheStress
+{
+public:
+  /* Returns routine_success if all threads saw exactly the same glyphs
+   * and each glyph was placed on its GlyphCache and uploaded exactly once.
+   * \param num_threads number of threads to run
+   * \param r renderer of the glyphs
+   * \param f font of the glyphs
+   * \param num_glyphs number of glyphs, starting at glyph code 0, to use
+   * \param atlas GlyphAtlas on which to make the GlyphCache objects
+   */
+  static
+  enum fastuidraw::return_code
+  run(unsigned int num_threads,
+      fastuidraw::GlyphRenderer r,
+      fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> f,
+      unsigned int num_glyphs,
+      fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> atlas);
+
+private:
+  GlyphCacheStress(fastuidraw::GlyphRenderer r,
+                   fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> f,
+                   unsigned int num_glyphs,
+                   fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> atlas);
+
+  static
+  int
+  execute(void *ptr);
+
+  fastuidraw::GlyphRenderer m_render;
+  fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
+  fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> m_fetch_cache, m_add_cache;
+  std::vector<fastuidraw::Glyph> m_created;
+  std::vector<std::vector<fastuidraw::Glyph> > m_fetched;
+  SDL_atomic_t m_thread_counter, m_add_failures;
+};
+
 /*
  * \param[out] out_sequence sequence to which to add glyphs
  * \param glyph_codes sequence of glyph codes (not characater codes!)
@@ -31,12 +31,28 @@ private:
   void
   draw_scene(bool with_clipping);
 
+  void
+  save_restore_benchmark(void);
+
+  void
+  damage_rect_check(void);
+
+  command_line_argument_value<int> m_save_restore_benchmark_count;
+  command_line_argument_value<bool> m_damage_rect_check;
   bool m_draw_overlay, m_use_matrices;
   PanZoomTrackerSDLEvent m_zoomer;
 };
 
 painter_clip_test::
 painter_clip_test():
+  m_save_restore_benchmark_count(0, "save_restore_benchmark_count",
+                                 "If positive, before starting the demo, time this many "
+                                 "save()/translate()/restore() cycles of the Painter, "
+                                 "without and with a clip_in_rect() in each cycle", *this),
+  m_damage_rect_check(false, "damage_rect_check",
+                      "If true, before starting the demo, draw a translucent "
+                      "rect over the surface with two disjoint damage rects "
+                      "and check that only the damage rects are touched", *this),
   m_draw_overlay(false),
   m_use_matrices(false)
 {
@@ -46,8 +62,117 @@ void
 painter_clip_test::
 derived_init(int, int)
 {
+  if (m_save_restore_benchmark_count.value() > 0)
+    {
+      save_restore_benchmark();
+    }
+
+  if (m_damage_rect_check.value())
+    {
+      damage_rect_check();
+    }
 }
 
+void
+painter_clip_test::
+save_restore_benchmark(void)
+{
+  int count(m_save_restore_benchmark_count.value());
+  vec2 wh(dimensions());
+
+  for (int with_clipping = 0; with_clipping < 2; ++with_clipping)
+    {
+      simple_time timer;
+
+      m_painter->begin(m_surface, Painter::y_increases_downwards);
+      for (int i = 0; i < count; ++i)
+        {
+          m_painter->save();
+          m_painter->translate(vec2(1.0f, 1.0f));
+          if (with_clipping)
+            {
+              m_painter->clip_in_rect(Rect()
+                                      .min_point(wh * 0.25f)
+                                      .max_point(wh * 0.75f));
+            }
+          m_painter->restore();
+        }
+      m_painter->end();
+
+      std::cout << "save/translate/" << (with_clipping ? "clip_in_rect/" : "")
+                << "restore: " << 1000.0f * static_cast<float>(timer.elapsed_us()) / count
+                << " ns per cycle\n";
+    }
+}
+
+void
+painter_clip_test::
+damage_rect_check(void)
+{
+  ivec2 wh(dimensions());
+  vec4 clear_color(m_surface->clear_color());
+  vecN<Rect, 2> damage;
+  PainterBrush brush;
+
+  /* fill the surface with red */
+  m_surface->clear_color(vec4(1.0f, 0.0f, 0.0f, 1.0f));
+  m_painter->begin(m_surface, Painter::y_increases_downwards);
+  m_painter->end();
+
+  /* two full height bands at the left and right of the
+   * surface; the band between them is not damaged.
+   */
+  damage[0]
+    .min_point(vec2(0.0f, 0.0f))
+    .max_point(vec2(0.25f * wh.x(), wh.y()));
+  damage[1]
+    .min_point(vec2(0.75f * wh.x(), 0.0f))
+    .max_point(vec2(wh.x(), wh.y()));
+
+  m_surface->clear_color(vec4(0.0f, 0.0f, 1.0f, 1.0f));
+  m_painter->begin(m_surface, Painter::y_increases_downwards, damage);
+  brush.color(0.0f, 1.0f, 0.0f, 0.5f);
+  m_painter->fill_rect(PainterData(&brush), Rect().size(vec2(wh)));
+  m_painter->end();
+  m_surface->clear_color(clear_color);
+
+  if (m_null_engine)
+    {
+      std::cout << "damage rect check: no pixels to read with the null engine, "
+                << m_painter->query_stat(Painter::num_draws) << " draws\n";
+      return;
+    }
+
+  /* read back the middle of the left damage band and
+   * of the band between the damage rects.
+   */
+  vecN<ivec2, 2> pixels(ivec2(wh.x() / 8, wh.y() / 2),
+                        ivec2(wh.x() / 2, wh.y() / 2));
+  vecN<vecN<uint8_t, 4>, 2> expected, values;
+
+  expected[0] = vecN<uint8_t, 4>(0, 128, 127, 255);
+  expected[1] = vecN<uint8_t, 4>(255, 0, 0, 255);
+
+  fastuidraw_glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  m_surface->blit_surface(GL_NEAREST);
+  fastuidraw_glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+  bool passed(true);
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      fastuidraw_glReadPixels(pixels[i].x(), pixels[i].y(), 1, 1,
+                              GL_RGBA, GL_UNSIGNED_BYTE, values[i].c_ptr());
+      for (unsigned int c = 0; c < 4; ++c)
+        {
+          int d(int(values[i][c]) - int(expected[i][c]));
+          passed = passed && d >= -2 && d <= 2;
+        }
+      std::cout << "damage rect check: pixel " << pixels[i]
+                << " = " << vecN<int, 4>(values[i]) << ", expected "
+                << vecN<int, 4>(expected[i]) << "\n";
+    }
+  std::cout << "damage rect check: " << (passed ? "passed" : "FAILED") << "\n";
+}
 
 void
 painter_clip_test::
@@ -216,6 +216,8 @@ private:
   command_line_argument_value<bool> m_use_file;
   command_line_argument_value<bool> m_draw_glyph_set;
   command_line_argument_value<int> m_realize_glyphs_thread_count;
+  command_line_argument_value<int> m_stress_glyph_cache_thread_count;
+  command_line_argument_value<int> m_stress_glyph_cache_glyph_count;
   command_line_argument_value<float> m_render_format_size;
   command_line_argument_value<float> m_bg_red, m_bg_green, m_bg_blue;
   command_line_argument_value<float> m_fg_red, m_fg_green, m_fg_blue;
@@ -511,6 +513,15 @@ painter_glyph_test(void):
                                 "If draw_glyph_set is true, gives the number of threads to use "
                                 "to create the glyph data",
                                 *this),
+  m_stress_glyph_cache_thread_count(0, "stress_glyph_cache_thread_count",
+                                    "If positive, before starting the demo, run a stress test "
+                                    "where this many threads fetch, generate and upload the same "
+                                    "glyphs from a GlyphCache and add the same glyphs to a GlyphCache",
+                                    *this),
+  m_stress_glyph_cache_glyph_count(256, "stress_glyph_cache_glyph_count",
+                                   "Number of glyphs used by the stress test enabled by "
+                                   "stress_glyph_cache_thread_count",
+                                   *this),
   m_render_format_size(24.0f, "render_format_size", "format size at which to display glyphs", *this),
   m_bg_red(0.0f, "bg_red", "Background Red", *this),
   m_bg_green(0.0f, "bg_green", "Background Green", *this),
@@ -696,6 +707,30 @@ derived_init(int w, int h)
   m_change_stroke_width_rate.value() /= (1000.0f * 1000.0f);
 
   ready_glyph_data(w, h);
+
+  if (m_stress_glyph_cache_thread_count.value() > 0)
+    {
+      for (unsigned int i = 0; i < draw_glyph_auto; ++i)
+        {
+          GlyphRenderer R(m_draws[i]);
+          simple_time timer;
+          enum return_code rv;
+
+          std::cout << "Stressing GlyphCache with " << m_stress_glyph_cache_thread_count.value()
+                    << " threads on " << R << " glyphs ..." << std::flush;
+          rv = GlyphCacheStress::run(m_stress_glyph_cache_thread_count.value(), R, m_font,
+                                     m_stress_glyph_cache_glyph_count.value(),
+                                     &m_painter->glyph_atlas());
+          std::cout << ((rv == routine_success) ? "passed" : "FAILED")
+                    << ", took " << timer.elapsed() << " ms\n";
+          if (rv == routine_fail)
+            {
+              end_demo(-1);
+              return;
+            }
+        }
+    }
+
   m_draw_timer.restart();
 
   if (m_screen_orientation.value() == Painter::y_increases_upwards)
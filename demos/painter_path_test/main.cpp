@@ -7,8 +7,10 @@
 
 #include <fastuidraw/util/util.hpp>
 #include <fastuidraw/path_dash_effect.hpp>
+#include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/painter/attribute_data/stroked_point.hpp>
 #include <fastuidraw/painter/attribute_data/arc_stroked_point.hpp>
+#include <fastuidraw/painter/clip_culling_params.hpp>
 
 #include "sdl_painter_demo.hpp"
 #include "simple_time.hpp"
@@ -22,6 +24,7 @@
 #include "ostream_utility.hpp"
 #include "text_helper.hpp"
 #include "command_line_list.hpp"
+#include "random.hpp"
 
 using namespace fastuidraw;
 
@@ -689,6 +692,12 @@ private:
   void
   construct_paths(int w, int h);
 
+  void
+  benchmark_tessellation(void);
+
+  void
+  clip_culling_check(void);
+
   void
   per_path_processing(void);
 
@@ -886,6 +895,9 @@ private:
   command_line_argument_value<float> m_initial_zoom;
   command_line_argument_value<float> m_initial_pan_x;
   command_line_argument_value<float> m_initial_pan_y;
+  command_line_argument_value<bool> m_prepare_async;
+  command_line_argument_value<int> m_tessellation_benchmark_count;
+  command_line_argument_value<int> m_clip_culling_check_count;
 
   std::vector<reference_counted_ptr<PerPath> > m_paths;
   reference_counted_ptr<Image> m_image;
@@ -1142,6 +1154,23 @@ painter_stroke_test(void):
   m_initial_zoom(1.0f, "initial_zoom", "initial zoom for view if init_pan_zoom is true", *this),
   m_initial_pan_x(0.0f, "initial_pan_x", "initial x-offset for view if init_pan_zoom is true", *this),
   m_initial_pan_y(0.0f, "initial_pan_y", "initial y-offset for view if init_pan_zoom is true", *this),
+  m_prepare_async(false, "prepare_async",
+                  "If true, the fills and strokes of each path are prepared on background "
+                  "threads with Path::prepare_async() once the paths are loaded; until "
+                  "a finer tessellation is ready, the path is drawn with the finest "
+                  "one already prepared", *this),
+  m_tessellation_benchmark_count(0, "tessellation_benchmark_count",
+                                 "If positive, once the paths are loaded, tessellate each path "
+                                 "this many times with each of 1, 2, 4 and 8 threads (see "
+                                 "TessellatedPath::TessellationParams::m_max_number_threads) "
+                                 "and print the average time taken for each thread count", *this),
+  m_clip_culling_check_count(0, "clip_culling_check_count",
+                             "If positive, once the paths are loaded, select the subsets of "
+                             "the fill and stroke of each path against this many random "
+                             "rotated clip rectangles, both with and without the packed "
+                             "clip-plane tests (see ClipCullingParams::packed_culling()); "
+                             "check that both give the same subsets and print the average "
+                             "time taken by each", *this),
   m_selected_path(0),
   m_join_style(Painter::rounded_joins),
   m_cap_style(Painter::flat_caps),
@@ -1983,6 +2012,199 @@ construct_paths(int w, int h)
           P->m_path_zoomer.transformation(v);
         }
     }
+
+  if (m_tessellation_benchmark_count.value() > 0)
+    {
+      benchmark_tessellation();
+    }
+
+  if (m_clip_culling_check_count.value() > 0)
+    {
+      clip_culling_check();
+    }
+
+  if (m_prepare_async.value())
+    {
+      const float thresholds[] =
+        {
+          1.0f, 0.25f, 0.05f, 0.01f, 0.002f
+        };
+      c_array<const float> T(thresholds, sizeof(thresholds) / sizeof(thresholds[0]));
+
+      for (const auto &P : m_paths)
+        {
+          P->path().prepare_async(T, PathEnums::prepare_filled | PathEnums::prepare_stroked);
+        }
+    }
+}
+
+void
+painter_stroke_test::
+benchmark_tessellation(void)
+{
+  const unsigned int thread_counts[] =
+    {
+      1, 2, 4, 8
+    };
+  unsigned int count(m_tessellation_benchmark_count.value());
+
+  for (const auto &P : m_paths)
+    {
+      unsigned int number_segments(0);
+
+      std::cout << "Tessellation of " << P->m_label << " ("
+                << P->path().number_contours() << " contours):\n";
+      for (unsigned int num_threads : thread_counts)
+        {
+          TessellatedPath::TessellationParams params;
+          simple_time timer;
+
+          params.max_number_threads(num_threads);
+          for (unsigned int i = 0; i < count; ++i)
+            {
+              TessellatedPath tess(P->path(), params);
+              number_segments = tess.segment_data().size();
+            }
+          std::cout << "\t" << num_threads << " threads: "
+                    << static_cast<float>(timer.elapsed_us()) / (1000.0f * count)
+                    << " ms per tessellation, " << number_segments << " segments\n";
+        }
+    }
+}
+
+void
+painter_stroke_test::
+clip_culling_check(void)
+{
+  unsigned int count(m_clip_culling_check_count.value());
+  bool restore_value(ClipCullingParams::packed_culling());
+  vecN<float, PathEnums::path_geometry_inflation_index_count> inflation(1.0f);
+  float3x3 clip_matrix_local;
+  /* large enough that the selection is decided by culling
+   * and not by the size of the chunks
+   */
+  const unsigned int max_attribs(512 * 512), max_indices(512 * 512);
+
+  std::cout << "Clip culling, packed tests use "
+            << ClipCullingParams::packed_culling_instruction_set() << ":\n";
+  for (const auto &P : m_paths)
+    {
+      const TessellatedPath &tess(P->path().tessellation(-1.0f));
+      const FilledPath &filled(tess.filled());
+      const StrokedPath &stroked(tess.stroked());
+      const Rect &R(tess.bounding_box());
+      vec2 sz(R.size());
+      std::vector<vecN<vec3, 4> > clip_eqs(count);
+      FilledPath::ScratchSpace scratch;
+      StrokedPath::SubsetSelection stroked_selection;
+      std::vector<unsigned int> filled_selection(filled.number_subsets());
+      c_array<unsigned int> filled_dst(&filled_selection[0], filled_selection.size());
+      vecN<std::vector<unsigned int>, 2> selected;
+      vecN<float, 2> time_us;
+      unsigned int number_separators(0);
+
+      /* random rotated rectangles, centered in or near the
+       * bounding box of the path, from tiny to twice the size
+       * of the path; the clip equations are in local coordinates
+       * so clip_matrix_local is left as the identity.
+       */
+      for (vecN<vec3, 4> &eqs : clip_eqs)
+        {
+          vec2 center, half_size, u, v;
+          float angle;
+
+          center = random_value(R.m_min_point - 0.5f * sz, R.m_max_point + 0.5f * sz);
+          half_size = random_value(0.005f * sz, sz);
+          angle = random_value(0.0f, 2.0f * FASTUIDRAW_PI);
+          u = vec2(t_cos(angle), t_sin(angle));
+          v = vec2(-u.y(), u.x());
+          eqs[0] = vec3(u.x(), u.y(), half_size.x() - dot(u, center));
+          eqs[1] = vec3(-u.x(), -u.y(), half_size.x() + dot(u, center));
+          eqs[2] = vec3(v.x(), v.y(), half_size.y() - dot(v, center));
+          eqs[3] = vec3(-v.x(), -v.y(), half_size.y() + dot(v, center));
+        }
+
+      /* a Subset computes its sizes lazily on its first selection
+       * and which subsets are merged depends on that; select once
+       * against every clip rectangle so both modes start from the
+       * same state.
+       */
+      for (const vecN<vec3, 4> &eqs : clip_eqs)
+        {
+          filled.select_subsets(scratch, eqs, clip_matrix_local,
+                                max_attribs, max_indices, filled_dst);
+          stroked.select_subsets(eqs, clip_matrix_local, vec2(1.0f), inflation,
+                                 max_attribs, max_indices, true, stroked_selection);
+        }
+
+      for (unsigned int packed = 0; packed < 2; ++packed)
+        {
+          simple_time timer;
+
+          ClipCullingParams::packed_culling(packed == 1);
+
+          /* record the selections to compare the two modes,
+           * with ~0u after each selection.
+           */
+          for (const vecN<vec3, 4> &eqs : clip_eqs)
+            {
+              unsigned int num;
+
+              num = filled.select_subsets(scratch, eqs, clip_matrix_local,
+                                          max_attribs, max_indices, filled_dst);
+              stroked.select_subsets(eqs, clip_matrix_local, vec2(1.0f), inflation,
+                                     max_attribs, max_indices, true, stroked_selection);
+
+              selected[packed].insert(selected[packed].end(), filled_selection.begin(),
+                                      filled_selection.begin() + num);
+              selected[packed].push_back(~0u);
+              selected[packed].insert(selected[packed].end(), stroked_selection.subset_ids().begin(),
+                                      stroked_selection.subset_ids().end());
+              selected[packed].push_back(~0u);
+              selected[packed].insert(selected[packed].end(), stroked_selection.join_subset_ids().begin(),
+                                      stroked_selection.join_subset_ids().end());
+              selected[packed].push_back(~0u);
+            }
+
+          timer.restart_us();
+          for (const vecN<vec3, 4> &eqs : clip_eqs)
+            {
+              filled.select_subsets(scratch, eqs, clip_matrix_local,
+                                    max_attribs, max_indices, filled_dst);
+              stroked.select_subsets(eqs, clip_matrix_local, vec2(1.0f), inflation,
+                                     max_attribs, max_indices, true, stroked_selection);
+            }
+          time_us[packed] = static_cast<float>(timer.elapsed_us());
+        }
+
+      if (selected[0] != selected[1])
+        {
+          /* find the first clip rectangle for which they differ */
+          for (unsigned int i = 0, endi = t_min(selected[0].size(), selected[1].size());
+               i < endi && selected[0][i] == selected[1][i]; ++i)
+            {
+              if (selected[0][i] == ~0u)
+                {
+                  ++number_separators;
+                }
+            }
+        }
+
+      std::cout << "\t" << P->m_label << " (" << filled.number_subsets()
+                << " fill subsets, " << stroked.number_subsets() << " stroke subsets):\n"
+                << "\t\tscalar clipper: " << time_us[0] / count << " us per clip rect\n"
+                << "\t\tpacked: " << time_us[1] / count << " us per clip rect\n";
+      if (selected[0] == selected[1])
+        {
+          std::cout << "\t\tselections identical for all " << count << " clip rects\n";
+        }
+      else
+        {
+          std::cout << "\t\tMISMATCH: selections differ, first at clip rect #"
+                    << number_separators / 3 << "\n";
+        }
+    }
+  ClipCullingParams::packed_culling(restore_value);
 }
 
 void
@@ -2809,12 +3031,15 @@ derived_init(int w, int h)
 
   CustomShaderGenerator<glsl::PainterItemShaderGLSL> item_shaders;
   CustomShaderGenerator<glsl::PainterItemCoverageShaderGLSL> cvg_shaders;
-  m_stroke_shader = generate_stroke_shader(m_backend->default_shaders().stroke_shader(),
+  /* register the shaders to the engine that m_painter uses,
+   * which is not m_backend when the null engine is used.
+   */
+  m_stroke_shader = generate_stroke_shader(m_painter->default_shaders().stroke_shader(),
                                            item_shaders, cvg_shaders);
-  m_dashed_stroke_shader = generate_dashed_stroke_shader(m_backend->default_shaders().dashed_stroke_shader(),
+  m_dashed_stroke_shader = generate_dashed_stroke_shader(m_painter->default_shaders().dashed_stroke_shader(),
                                                          item_shaders, cvg_shaders);
-  m_backend->register_shader(m_stroke_shader);
-  m_backend->register_shader(m_dashed_stroke_shader);
+  m_painter->painter_shader_registrar().register_shader(m_stroke_shader);
+  m_painter->painter_shader_registrar().register_shader(m_dashed_stroke_shader);
 }
 
 int
@@ -704,6 +704,43 @@ namespace fastuidraw
         ConfigurationGL&
         use_uber_item_shader(bool);
 
+        /*!
+         * If true, the attribute data of a draw is written first
+         * to CPU memory and only the fields of \ref PainterAttribute
+         * read by the item shaders of the draw (see
+         * PainterItemShader::number_attribute_slots()) are
+         * uploaded to the GL buffer object, packed tightly. This
+         * reduces the attribute upload from 48 bytes per vertex to
+         * 16 bytes per vertex for fills and to 32 bytes per vertex
+         * for most glyph rendering at the cost of a copy on the
+         * CPU. Default value is false.
+         */
+        bool
+        compact_attributes(void) const;
+
+        /*!
+         * Set the value for compact_attributes(void) const
+         */
+        ConfigurationGL&
+        compact_attributes(bool);
+
+        /*!
+         * If true, the index data of a draw is written first to
+         * CPU memory and, when the draw uses no more than 65536
+         * attributes, is uploaded to the GL buffer object as
+         * 16-bit indices and drawn with GL_UNSIGNED_SHORT. This
+         * halves the index upload at the cost of a copy on the
+         * CPU. Default value is false.
+         */
+        bool
+        compact_indices(void) const;
+
+        /*!
+         * Set the value for compact_indices(void) const
+         */
+        ConfigurationGL&
+        compact_indices(bool);
+
         /*!
          * If true, the vertex shader inputs should be qualified
          * with a layout(location=) specifier. Default value is
@@ -43,7 +43,7 @@ namespace fastuidraw  {
  * of how one strokes the original path for drawing.
  */
 class StrokedPath:
-    public reference_counted<StrokedPath>::non_concurrent
+    public reference_counted<StrokedPath>::concurrent
 {
 public:
   /*!
@@ -173,6 +173,26 @@ namespace fastuidraw
     void
     add_action(const reference_counted_ptr<DelayedAction> &h) const;
 
+    /*!
+     * Called by \ref PainterPacker to indicate that the item
+     * shader of items written to this PainterDraw reads the
+     * first N fields of \ref PainterAttribute, see
+     * PainterItemShader::number_attribute_slots(). The value
+     * recorded is the maximum of all values passed.
+     * \param N number of fields of \ref PainterAttribute read
+     */
+    void
+    use_attribute_slots(unsigned int N);
+
+    /*!
+     * Returns the maximum value passed to use_attribute_slots();
+     * a backend only needs to upload the first
+     * number_attribute_slots_used() fields of each element
+     * of \ref m_attributes.
+     */
+    unsigned int
+    number_attribute_slots_used(void) const;
+
     /*!
      * Signals this PainterDraw to be unmapped.
      * Actual unmapping is delayed until all actions that
@@ -37,6 +37,23 @@ namespace fastuidraw
    * \brief
    * A \ref PainterEngine provides an interface to create
    * \ref PainterBackend derived objects.
+   *
+   * Several \ref Painter objects, each used by a single thread,
+   * may share one PainterEngine and record concurrently (for
+   * example into a \ref PainterCommandList each). The objects
+   * of a PainterEngine they share are safe to use concurrently:
+   *  - \ref ImageAtlas and \ref ColorStopAtlas allocate and
+   *    upload behind an internal mutex,
+   *  - \ref GlyphCache fetches and generates glyphs with a
+   *    lock per glyph (see \ref GlyphCache for the methods
+   *    that require exclusive access),
+   *  - \ref PainterShaderRegistrar registers shaders behind
+   *    its mutex() and a shader that is already registered is
+   *    detected without locking.
+   *
+   * Values that hold on to a \ref PainterPackedValuePool (for
+   * example a \ref PainterPackedValue) must only be created by
+   * the thread that uses the \ref Painter of that pool.
    */
   class PainterEngine:public reference_counted<PainterEngine>::concurrent
   {
@@ -0,0 +1,157 @@
+/*!
+ * \file painter_engine_null.hpp
+ * \brief file painter_engine_null.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <fastuidraw/painter/backend/painter_engine.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup PainterBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterEngineNull implements \ref PainterEngine without
+   * any 3D API. The \ref PainterDraw objects of the \ref
+   * PainterBackend objects it creates are backed by CPU memory
+   * and PainterDraw::draw() does nothing except record stats.
+   * The atlases of a PainterEngineNull are also backed by CPU
+   * memory. The purpose of PainterEngineNull is to measure
+   * (and regress) the CPU cost of \ref Painter without the
+   * need of a GL context. The \ref PainterShaderRegistrar
+   * object returned by \ref painter_shader_registrar()
+   * derives from glsl::PainterShaderRegistrarGLSL, so shaders
+   * made for the GL backend can be registered to it as well.
+   */
+  class PainterEngineNull:public PainterEngine
+  {
+  public:
+    /*!
+     * Enumeration to specify the stats PainterEngineNull
+     * records. The stats are accumulated across all
+     * \ref PainterBackend objects made from the
+     * PainterEngineNull.
+     */
+    enum stat_t
+      {
+        /*!
+         * Number of times PainterBackend::map_draw() was called
+         */
+        num_map_draws,
+
+        /*!
+         * Number of times PainterDraw::draw() was called
+         */
+        num_draws,
+
+        /*!
+         * Number of times a PainterDraw::draw_break() resulted
+         * in a draw break, i.e. the number of 3D API draw
+         * calls issued is the sum of \ref num_draws and
+         * \ref num_draw_breaks
+         */
+        num_draw_breaks,
+
+        /*!
+         * Number of PainterDrawBreakAction objects that were
+         * added to PainterDraw objects via PainterDraw::draw_break()
+         */
+        num_actions,
+
+        /*!
+         * Number of attributes unmapped
+         */
+        num_attributes,
+
+        /*!
+         * Number of indices unmapped
+         */
+        num_indices,
+
+        /*!
+         * Number of data store blocks (i.e. uvec4 values) unmapped
+         */
+        num_data_store_blocks,
+
+        /*!
+         * Number of times PainterBackend::on_pre_draw() was called
+         */
+        num_pre_draws,
+
+        number_stats
+      };
+
+    /*!
+     * Create a PainterEngineNull.
+     * \param attribs_per_mapping value for PainterBackend::attribs_per_mapping()
+     *                            of the \ref PainterBackend objects made
+     * \param indices_per_mapping value for PainterBackend::indices_per_mapping()
+     *                            of the \ref PainterBackend objects made
+     * \param data_blocks_per_mapping size of PainterDraw::m_store of the \ref
+     *                                PainterDraw objects made
+     */
+    static
+    reference_counted_ptr<PainterEngineNull>
+    create(unsigned int attribs_per_mapping = 512 * 512,
+           unsigned int indices_per_mapping = (512 * 512 * 6) / 4,
+           unsigned int data_blocks_per_mapping = 1024 * 64);
+
+    ~PainterEngineNull();
+
+    /*!
+     * Returns the value of a stat.
+     * \param st stat to query
+     */
+    uint64_t
+    stat(enum stat_t st) const;
+
+    /*!
+     * Reset all stats to zero.
+     */
+    void
+    reset_stats(void);
+
+    /*!
+     * Returns a string label for a stat.
+     * \param st stat to query
+     */
+    static
+    c_string
+    label(enum stat_t st);
+
+    virtual
+    reference_counted_ptr<PainterBackend>
+    create_backend(void) const override;
+
+    virtual
+    reference_counted_ptr<PainterSurface>
+    create_surface(ivec2 dims,
+                   enum PainterSurface::render_type_t render_type) override;
+
+  private:
+    PainterEngineNull(unsigned int attribs_per_mapping,
+                      unsigned int indices_per_mapping,
+                      unsigned int data_blocks_per_mapping);
+
+    void *m_d;
+  };
+/*! @} */
+}
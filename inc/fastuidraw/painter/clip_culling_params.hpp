@@ -0,0 +1,67 @@
+/*!
+ * \file clip_culling_params.hpp
+ * \brief file clip_culling_params.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+ * @{
+ */
+  /*!
+   * !\brief
+   * ClipCullingParams controls how bounding boxes and polygons are
+   * tested against clip equations when selecting what to draw, i.e.
+   * in FilledPath::select_subsets(), StrokedPath::select_subsets(),
+   * GlyphSequence and the culling done by \ref Painter. The values
+   * can be changed at any time and from any thread; a selection
+   * already in progress keeps the value it started with.
+   */
+  namespace ClipCullingParams
+  {
+    /*!
+     * If true, a bounding box or polygon is tested against 4
+     * clip equations at a time with the instruction set given by
+     * packed_culling_instruction_set() and only the boxes that
+     * straddle the clip region are clipped. If false, the boxes
+     * are clipped against one clip equation at a time. Both give
+     * the same results. Default value is true.
+     */
+    bool
+    packed_culling(void);
+
+    /*!
+     * Set the value returned by packed_culling(void).
+     * \param v value
+     */
+    void
+    packed_culling(bool v);
+
+    /*!
+     * Returns the instruction set, chosen when FastUIDraw was
+     * built, with which packed_culling() tests 4 clip equations
+     * at a time: "SSE", "NEON" or "none" for plain loops.
+     */
+    c_string
+    packed_culling_instruction_set(void);
+  }
+/*! @} */
+}
@@ -33,6 +33,8 @@
 
 #include <fastuidraw/painter/painter_brush.hpp>
 #include <fastuidraw/painter/painter_enums.hpp>
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <fastuidraw/painter/painter_picture.hpp>
 #include <fastuidraw/painter/stroking_style.hpp>
 #include <fastuidraw/painter/fill_rule.hpp>
 #include <fastuidraw/painter/shader_data/painter_stroke_params.hpp>
@@ -353,6 +355,122 @@ namespace fastuidraw
           enum screen_orientation orientation,
           bool clear_color_buffer = true);
 
+    /*!
+     * Indicate to start drawing with methods of this Painter where
+     * only the content within a set of damage rects is to be drawn,
+     * i.e. the rest of the content of the surface is left as is.
+     * The clipping is initialized to the union of the damage rects
+     * (a clip-in of their bounding box followed by a clip-out of the
+     * region between them) and a draw whose bounding box does not
+     * intersect any of the damage rects is not drawn (see
+     * \ref num_damage_culled). Only the damage rects are cleared and
+     * the content outside of the damage rects is not touched. If the
+     * list of damage rects is empty, all content is culled.
+     * \param surface the \ref PainterSurface to which to render content
+     * \param initial_transformation value to initialize transformation() which
+     *                               is the matrix from logical coordinates to
+     *                               API 3D clip coordinates.
+     * \param damage_rects damage rects in pixel coordinates where (0, 0)
+     *                     is the bottom left of the surface (see
+     *                     PainterSurface::Viewport::compute_normalized_device_coords())
+     * \param clear_color_buffer if true, clear the color buffer within
+     *                           the damage rects to the clear color
+     *                           of the surface
+     */
+    void
+    begin(const reference_counted_ptr<PainterSurface> &surface,
+          const float3x3 &initial_transformation,
+          c_array<const Rect> damage_rects,
+          bool clear_color_buffer = true);
+
+    /*!
+     * Indicate to start drawing with methods of this Painter where
+     * only the content within a set of damage rects is to be drawn.
+     * Equivalent to calling begin(const reference_counted_ptr<PainterSurface>&, const float3x3&, c_array<const Rect>, bool)
+     * with the transformation derived from the screen_orientation
+     * as in begin(const reference_counted_ptr<PainterSurface>&, enum screen_orientation, bool).
+     * \param surface the \ref PainterSurface to which to render content
+     * \param orientation orientation convention with which to initialize the
+     *                    transformation
+     * \param damage_rects damage rects in pixel coordinates where (0, 0)
+     *                     is the bottom left of the surface
+     * \param clear_color_buffer if true, clear the color buffer within
+     *                           the damage rects to the clear color
+     *                           of the surface
+     */
+    void
+    begin(const reference_counted_ptr<PainterSurface> &surface,
+          enum screen_orientation orientation,
+          c_array<const Rect> damage_rects,
+          bool clear_color_buffer = true);
+
+    /*!
+     * Indicate to start recording the drawing with methods of this
+     * Painter into a \ref PainterCommandList. The recorded commands
+     * are added to the command stream of a Painter with
+     * draw_command_list(). While recording, nothing is sent to the
+     * \ref PainterBackend of this Painter, thus recording can be
+     * done on a thread other than the thread that sends commands
+     * to the 3D API; see \ref PainterCommandList for the conditions
+     * to do so safely and for the shared resources (the GlyphCache
+     * and the atlases) that recording still accesses. The following are not supported while recording:
+     *  - begin_layer() and begin_cached_layer() behave like save()
+     *    and the content is drawn without the effect
+     *  - flush() always returns \ref routine_fail
+     * \param list the \ref PainterCommandList to which to record, any
+     *             commands previously recorded to it are cleared
+     * \param surface the \ref PainterSurface whose viewport and dimensions
+     *                the recorded commands are for; only these values are
+     *                used, the contents of the surface are not touched.
+     * \param initial_transformation value to initialize transformation() which
+     *                               is the matrix from logical coordinates to
+     *                               API 3D clip coordinates.
+     */
+    void
+    begin(const reference_counted_ptr<PainterCommandList> &list,
+          const PainterSurface &surface,
+          const float3x3 &initial_transformation);
+
+    /*!
+     * Indicate to start recording the drawing with methods of this
+     * Painter into a \ref PainterCommandList with the transformation
+     * matrix initialized with a projection matrix derived from the
+     * passed screen_orientation and the viewort of the passed
+     * PainterSurface.
+     * \param list the \ref PainterCommandList to which to record, any
+     *             commands previously recorded to it are cleared
+     * \param surface the \ref PainterSurface whose viewport and dimensions
+     *                the recorded commands are for; only these values are
+     *                used, the contents of the surface are not touched.
+     * \param orientation orientation convention with which to initialize the
+     *                    transformation
+     */
+    void
+    begin(const reference_counted_ptr<PainterCommandList> &list,
+          const PainterSurface &surface,
+          enum screen_orientation orientation);
+
+    /*!
+     * Indicate to start recording the drawing with methods of this
+     * Painter into a \ref PainterPicture. The recorded content is
+     * drawn with draw_picture(). The same restrictions as recording
+     * to a \ref PainterCommandList apply. The logical coordinates
+     * of the recording are those of the \ref PainterPicture, with
+     * the transformation initialized as a projection matrix of the
+     * rectangle [0, W] x [0, H] where (W, H) are the passed dimensions.
+     * \param picture the \ref PainterPicture to which to record, any
+     *                content previously recorded to it is cleared
+     * \param dimensions dimensions of the rectangle the content of
+     *                   the picture is within; content outside of
+     *                   the rectangle is culled
+     * \param orientation orientation convention with which to initialize
+     *                    the transformation
+     */
+    void
+    begin(const reference_counted_ptr<PainterPicture> &picture,
+          ivec2 dimensions,
+          enum screen_orientation orientation = y_increases_downwards);
+
     /*!
      * Indicate to end drawing with methods of this Painter.
      * Drawing commands sent to 3D hardware are buffered and not
@@ -710,6 +828,29 @@ namespace fastuidraw
     float
     curve_flatness(void);
 
+    /*!
+     * Set if the draws accumulated within each \ref PainterDraw
+     * are reordered to group draws by shader group, reducing the
+     * number of draw breaks (see PainterDraw::draw_break()).
+     * Only draws whose result does not depend on the order in
+     * which they are drawn are moved: draws to a deferred coverage
+     * buffer and draws whose 3D API blend mode does not read the
+     * destination and whose z-values are strictly greater than
+     * those of the draws they are moved before (for such draws
+     * the depth test realizes the drawing order). A change takes
+     * effect on the next begin().
+     * The number of shader group changes removed is reported by
+     * the stat \ref num_draw_breaks_avoided. Default value is false.
+     */
+    void
+    reorder_shader_groups(bool v);
+
+    /*!
+     * Returns the value set by reorder_shader_groups(bool).
+     */
+    bool
+    reorder_shader_groups(void) const;
+
     /*!
      * Save the current state of this Painter onto the save state stack.
      * The state is restored (and the stack popped) by called restore().
@@ -747,7 +888,9 @@ namespace fastuidraw
      * to begin_layer(). All restore() commands called after a
      * begin_layer() must match a save() from after a begin_layer().
      * It is acceptable to layer any number of begin_layer() calls
-     * as well.
+     * as well. When recording to a \ref PainterCommandList or
+     * \ref PainterPicture, there is no offscreen buffer: behaves
+     * as save() and the content is drawn without the effect.
      * \param effect effect to apply
      * \param effect_params effect parameters for the effect
      */
@@ -764,7 +907,9 @@ namespace fastuidraw
      * restore() commands called after a begin_layer()
      * must match a save() from after a begin_layer().
      * It is acceptable to layer any number of begin_layer()
-     * calls as well.
+     * calls as well. When recording to a \ref PainterCommandList
+     * or \ref PainterPicture, behaves as save() and the content
+     * is drawn without the color modulation.
      * \param color_modulate color value by which to modulate
      *                       the layer when it is to be blitted
      */
@@ -784,6 +929,71 @@ namespace fastuidraw
       begin_layer(vec4(1.0f, 1.0f, 1.0f, alpha));
     }
 
+    /*!
+     * Begin a cached transparency layer. A cached layer is
+     * a transparency layer (see begin_layer(const vec4&))
+     * whose rendered content is kept across frames so that
+     * drawing the same content again costs only a blit.
+     * The cached content is used if the layer named by ID
+     * was rendered before, was not invalidated (see
+     * invalidate_cached_layer() and invalidate_cached_layers())
+     * and covers the same pixels, i.e. the clipping region
+     * and viewport size are the same as when it was rendered.
+     * In that case the cached content is blitted and all
+     * drawing until the matching end_layer() is culled;
+     * otherwise the content drawn until the matching end_layer()
+     * is rendered to the cached layer and then blitted. In both
+     * cases the layer must be ended with end_layer(). Changes
+     * to the content of the layer are not detected; the caller
+     * must invalidate the cached layer when the content changes.
+     * A cached layer that is not used in a frame nor in the frame
+     * before it is dropped at begin(), releasing its surface.
+     * A given ID must be used at most once between begin()
+     * and end(); a second use behaves as begin_layer(const vec4&)
+     * and returns true (debug builds assert). When recording to a \ref PainterCommandList
+     * or \ref PainterPicture, behaves as begin_layer(const vec4&)
+     * and returns true.
+     * \param ID value naming the cached layer
+     * \param color_modulate color value by which to modulate
+     *                       the layer when it is to be blitted;
+     *                       the cached content does not depend
+     *                       on it
+     * \returns true if the content of the layer needs to
+     *          be drawn, false if the cached content is
+     *          used.
+     */
+    bool
+    begin_cached_layer(unsigned int ID, const vec4 &color_modulate);
+
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * begin_cached_layer(ID, vec4(1.0f, 1.0f, 1.0f, alpha));
+     * \endcode
+     * \param ID value naming the cached layer
+     * \param alpha alpha value for color modulation.
+     */
+    bool
+    begin_cached_layer(unsigned int ID, float alpha)
+    {
+      return begin_cached_layer(ID, vec4(1.0f, 1.0f, 1.0f, alpha));
+    }
+
+    /*!
+     * Invalidate the cached content of a cached layer
+     * (see begin_cached_layer()) and release its surface.
+     * \param ID value naming the cached layer
+     */
+    void
+    invalidate_cached_layer(unsigned int ID);
+
+    /*!
+     * Invalidate the cached content of all cached layers
+     * (see begin_cached_layer()) and release their surfaces.
+     */
+    void
+    invalidate_cached_layers(void);
+
     /*!
      * End the current transparency layer and blit
      * the layer.
@@ -1613,6 +1823,128 @@ namespace fastuidraw
       fill_rounded_rect(PainterData(&brush), R, apply_shader_anti_aliasing);
     }
 
+    /*!
+     * Fill an array of rects using a custom shader. The rects
+     * are culled against the current clipping and those that
+     * remain are sent as a single draw, sharing the same state
+     * and, when anti-aliasing, a single coverage buffer. All
+     * the rects share the same z-value. The result matches
+     * calling fill_rect() on each rect only where the rects do
+     * not overlap: when anti-aliasing, the anti-aliased edges of
+     * all the rects are drawn in one coverage pass under the
+     * interiors of all the rects, so the edge of a rect lying over
+     * another rect of the array is hidden by it, and where the
+     * edges of several rects overlap they are blended once rather
+     * than once per rect. For translucent brushes, or blend modes
+     * where drawing twice is not the same as drawing once, draw
+     * overlapping rects with fill_rect() instead.
+     * \param shader shader with which to draw the rects
+     * \param draw data for how to draw
+     * \param rects rectangles to fill
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rects(const PainterFillShader &shader, const PainterData &draw,
+               c_array<const Rect> rects,
+               bool apply_shader_anti_aliasing = true);
+
+    /*!
+     * Fill an array of rects using the default fill shader,
+     * see fill_rects(const PainterFillShader&, const PainterData&, c_array<const Rect>, bool).
+     * \param draw data for how to draw
+     * \param rects rectangles to fill
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rects(const PainterData &draw, c_array<const Rect> rects,
+               bool apply_shader_anti_aliasing = true);
+
+    /*!
+     * Fill an array of rects using the default fill shader
+     * \code
+     * fill_rects(PainterData(&brush), rects, apply_shader_anti_aliasing);
+     * \endcode
+     * \param brush \ref PainterBrush to apply to fill
+     * \param rects rectangles to fill
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rects(const PainterBrush &brush, c_array<const Rect> rects,
+               bool apply_shader_anti_aliasing = true)
+    {
+      fill_rects(PainterData(&brush), rects, apply_shader_anti_aliasing);
+    }
+
+    /*!
+     * Fill an array of rects, each with its own brush, using a
+     * custom shader. Consecutive rects whose brush values
+     * source from the same \ref PainterBrush, custom brush or
+     * packed brush data are drawn as one batch as in
+     * fill_rects(const PainterFillShader&, const PainterData&, c_array<const Rect>, bool);
+     * so ordering the rects by brush (for example by the \ref
+     * Image of an image brush) reduces the number of batches.
+     * \param shader shader with which to draw the rects
+     * \param draw data for how to draw; the value of
+     *             PainterData::m_brush is ignored
+     * \param rects rectangles to fill
+     * \param brushes brushes[i] is the brush with which to fill rects[i];
+     *                must be the same size as rects
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rects(const PainterFillShader &shader, const PainterData &draw,
+               c_array<const Rect> rects,
+               c_array<const PainterData::brush_value> brushes,
+               bool apply_shader_anti_aliasing = true);
+
+    /*!
+     * Fill an array of rects, each with its own brush, using the
+     * default fill shader, see fill_rects(const PainterFillShader&, const PainterData&, c_array<const Rect>, c_array<const PainterData::brush_value>, bool).
+     * \param draw data for how to draw; the value of
+     *             PainterData::m_brush is ignored
+     * \param rects rectangles to fill
+     * \param brushes brushes[i] is the brush with which to fill rects[i];
+     *                must be the same size as rects
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rects(const PainterData &draw, c_array<const Rect> rects,
+               c_array<const PainterData::brush_value> brushes,
+               bool apply_shader_anti_aliasing = true);
+
+    /*!
+     * Fill an array of rounded rects using a fill shader. Rounded
+     * rects whose bounding rect is culled by the current clipping
+     * are skipped without generating any of their data; those that
+     * remain are sent as a single draw, sharing the same state and,
+     * when anti-aliasing, a single coverage buffer. Unlike
+     * fill_rounded_rect(), the corners are approximated by line
+     * segments on the CPU, as set by the curve flatness (see
+     * curve_flatness()), and all the rounded rects share the same
+     * z-value. As for fill_rects(const PainterFillShader&, const PainterData&, c_array<const Rect>, bool),
+     * when anti-aliasing the result matches calling fill_rounded_rect()
+     * on each rounded rect only where they do not overlap.
+     * \param shader shader with which to draw the rounded rectangles
+     * \param draw data for how to draw
+     * \param rects rounded rectangles to draw
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rounded_rects(const PainterFillShader &shader, const PainterData &draw,
+                       c_array<const RoundedRect> rects,
+                       bool apply_shader_anti_aliasing = true);
+
+    /*!
+     * Fill an array of rounded rects using the default fill shader,
+     * see fill_rounded_rects(const PainterFillShader&, const PainterData&, c_array<const RoundedRect>, bool).
+     * \param draw data for how to draw
+     * \param rects rounded rectangles to draw
+     * \param apply_shader_anti_aliasing if true, fill with shader based anti-aliasing
+     */
+    void
+    fill_rounded_rects(const PainterData &draw, c_array<const RoundedRect> rects,
+                       bool apply_shader_anti_aliasing = true);
+
     /*!
      * Draw generic attribute data.
      * \param shader shader with which to draw data
@@ -1730,6 +2062,58 @@ namespace fastuidraw
     void
     queue_action(const reference_counted_ptr<const PainterDrawBreakAction> &action);
 
+    /*!
+     * Add the commands recorded in a \ref PainterCommandList
+     * to the command stream of this Painter. The recorded
+     * commands are drawn with the clipping and transformation
+     * that were active when they were recorded; the current
+     * clipping and transformation of this Painter are not
+     * applied. The z-value of this Painter is incremented
+     * by PainterCommandList::z_increment() so that content
+     * drawn afterwards is drawn above the recorded content.
+     * The \ref PainterCommandList must have been recorded by a
+     * Painter whose \ref PainterEngine is the same as this
+     * Painter and must not be recording. A recorded draw is
+     * skipped if a later draw of the same list covers it with
+     * opaque content; draws recognized as opaque are those of
+     * fill_rect(), fill_rects() and fill_convex_polygon() with
+     * the default fill shader, a \ref PainterBrush of opaque
+     * color without image or gradient and the blend mode
+     * \ref blend_porter_duff_src_over or \ref blend_porter_duff_src.
+     * The number of skipped draws is reported by the stat
+     * \ref num_occlusion_culled. When drawing to damage rects,
+     * recorded draws outside of the damage rects are skipped
+     * as well and reported by the stat \ref num_damage_culled.
+     * \param list commands to add
+     */
+    void
+    draw_command_list(const PainterCommandList &list);
+
+    /*!
+     * Draw the content of a \ref PainterPicture. The transformation
+     * of the drawn content is the current transformation of this
+     * Painter composed with the passed matrix, where the passed
+     * matrix maps the coordinates of the \ref PainterPicture (see
+     * begin(const reference_counted_ptr<PainterPicture>&, ivec2, enum screen_orientation))
+     * to the current logical coordinates of this Painter. The
+     * content is clipped against the current clipping of this
+     * Painter and the clipping applied when the picture was
+     * recorded. Only the transformation and clipping of the
+     * recorded draws are recomputed, the attribute and index
+     * data are taken as-is from the picture. Returns false and
+     * draws nothing if the picture is not valid (see
+     * PainterPicture::valid()). The \ref PainterPicture must have
+     * been recorded by a Painter whose \ref PainterEngine is the
+     * same as this Painter. Draws hidden by opaque draws of the
+     * picture are skipped as in draw_command_list().
+     * \param picture content to draw
+     * \param matrix transformation from the coordinates of the picture
+     *               to the current logical coordinates of this Painter
+     */
+    bool
+    draw_picture(const PainterPicture &picture,
+                 const float3x3 &matrix = float3x3());
+
     /*!
      * Returns a stat on how much data the Packer has
      * handled in the last begin()/end() pair. Calling
@@ -0,0 +1,161 @@
+/*!
+ * \file painter_command_list.hpp
+ * \brief file painter_command_list.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw
+{
+  ///@cond
+  class Painter;
+  ///@endcond
+
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterCommandList holds the draws recorded by a \ref Painter
+   * that was started with Painter::begin(const reference_counted_ptr<PainterCommandList>&, const PainterSurface&, const float3x3&)
+   * so that they can be added to the command stream of another
+   * \ref Painter with Painter::draw_command_list().
+   *
+   * The intended use case is to have a seperate \ref Painter for
+   * each worker thread that records into its own PainterCommandList
+   * in parallel; the main thread then adds the recorded commands,
+   * in the order it wishes, to its \ref Painter. Recording does
+   * not send anything to the \ref PainterBackend, so all the
+   * CPU work of generating attribute and index data and computing
+   * clipping is done on the worker thread. The conditions for this
+   * to be thread safe are:
+   *  - each thread must use its own \ref Painter (and thus its own
+   *    \ref PainterPackedValuePool)
+   *  - a PainterCommandList must not be drawn while it is being
+   *    recorded and must not be recorded (or cleared) while it is
+   *    being drawn with Painter::draw_command_list().
+   *
+   * Recording is not free of shared resources however. Drawing
+   * text fetches (and if necessary generates and uploads) glyphs
+   * from the \ref GlyphCache of the \ref PainterEngine, which is
+   * shared by all the Painter objects made from it; the GlyphCache
+   * and its \ref GlyphAtlas guard their state with locks, so worker
+   * threads drawing text contend with each other and with the
+   * thread of the \ref PainterBackend. Likewise, an \ref Image
+   * drawn while recording lives in the shared \ref ImageAtlas,
+   * whose allocation and deallocation are behind its own mutex.
+   * Consequently, GlyphCache::clear_atlas() and
+   * GlyphCache::clear_cache() must not be called while any
+   * Painter records or while a recorded PainterCommandList that
+   * has text is yet to be drawn, as the recorded glyph locations
+   * would then be stale.
+   *
+   * Transparency layers are not supported while recording: the
+   * content of a layer must be rendered to an offscreen surface
+   * by the \ref PainterBackend. Painter::begin_layer() and
+   * Painter::begin_cached_layer() then behave as Painter::save()
+   * (issuing a warning) so that the matching Painter::end_layer()
+   * remains correct, and the content of the layer is drawn
+   * directly without the layer's effect or color modulation.
+   *
+   * The \ref Painter that recorded a PainterCommandList may record
+   * to a different PainterCommandList while the first one is being
+   * drawn by another thread. This allows pipelining: by giving each
+   * worker thread two PainterCommandList objects used alternately
+   * each frame, the worker threads record frame N + 1 while the
+   * thread of the \ref PainterBackend draws and submits frame N.
+   * The values a PainterCommandList references (packed values
+   * and images) stay alive until the PainterCommandList is
+   * recorded again or cleared.
+   * The one restriction is that the \ref PainterPackedValuePool
+   * of the recording \ref Painter must not be used to create
+   * values on another thread than the thread recording.
+   *
+   * A PainterCommandList is reset every time a \ref Painter begins
+   * recording to it.
+   */
+  class PainterCommandList:
+    public reference_counted<PainterCommandList>::concurrent
+  {
+  public:
+    /*!
+     * Ctor.
+     */
+    PainterCommandList(void);
+
+    ~PainterCommandList();
+
+    /*!
+     * Clear all recorded commands, releasing the references
+     * to the values held by the recorded commands. Must not
+     * be called while a \ref Painter is recording into the
+     * PainterCommandList.
+     */
+    void
+    clear(void);
+
+    /*!
+     * Returns true if no commands have been recorded.
+     */
+    bool
+    empty(void) const;
+
+    /*!
+     * Returns true if a \ref Painter is currently
+     * recording to this PainterCommandList.
+     */
+    bool
+    recording(void) const;
+
+    /*!
+     * Returns the number of commands recorded.
+     */
+    unsigned int
+    number_commands(void) const;
+
+    /*!
+     * Returns the number of \ref PainterAttribute values
+     * that the recorded commands hold.
+     */
+    unsigned int
+    number_attributes(void) const;
+
+    /*!
+     * Returns the number of \ref PainterIndex values that
+     * the recorded commands hold.
+     */
+    unsigned int
+    number_indices(void) const;
+
+    /*!
+     * Returns by how much the z-value of a \ref Painter is
+     * incremented when this PainterCommandList is drawn by
+     * Painter::draw_command_list().
+     */
+    int
+    z_increment(void) const;
+
+  private:
+    friend class Painter;
+    void *m_d;
+  };
+
+/*! @} */
+}
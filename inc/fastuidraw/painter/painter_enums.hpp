@@ -826,6 +826,105 @@ namespace fastuidraw
          * Number of begin_coverage_buffer()/end_coverage_buffer() pairs called
          */
         num_deferred_coverages,
+
+        /*!
+         * Number of times the packed data of a state value
+         * (clip equations, item matrix, brush data, etc) was
+         * found already placed onto the store buffer of the
+         * current PainterDraw with the same values and that
+         * location was reused instead of packing the data
+         * again.
+         */
+        num_state_dedup_hits,
+
+        /*!
+         * Number of times the packed data of a state value
+         * was placed onto the store buffer of a PainterDraw.
+         */
+        num_state_dedup_misses,
+
+        /*!
+         * Number of shader group changes within PainterDraw
+         * objects removed by reordering draws, see
+         * Painter::reorder_shader_groups(bool).
+         */
+        num_draw_breaks_avoided,
+
+        /*!
+         * Number of draws of a \ref PainterCommandList or
+         * \ref PainterPicture that were not drawn because
+         * draws after them in the same list cover them with
+         * opaque content, see Painter::draw_command_list()
+         * and Painter::draw_picture().
+         */
+        num_occlusion_culled,
+
+        /*!
+         * Number of draws not drawn because their bounding
+         * box does not intersect any of the damage rects
+         * passed to Painter::begin(const reference_counted_ptr<PainterSurface>&, const float3x3&, c_array<const Rect>, bool).
+         */
+        num_damage_culled,
+
+        /*!
+         * Number of times a brush value that was not packed
+         * was replaced by an equal brush value packed before
+         * and held by the \ref Painter. A \ref Painter packs
+         * the brush of a draw when stroking and when recording
+         * to a \ref PainterCommandList or \ref PainterPicture;
+         * the \ref Painter holds the most recently used packed
+         * brush values so that repeated colors, gradients and
+         * image brushes reuse their packed data.
+         */
+        num_brush_intern_hits,
+
+        /*!
+         * Number of times a brush value that was not packed
+         * did not have an equal packed brush value held by
+         * the \ref Painter and was packed into a new value.
+         */
+        num_brush_intern_misses,
+
+        /*!
+         * Time in micro-seconds spent selecting the subsets of
+         * paths and glyph sequences to draw. The timing stats
+         * are only measured if FastUIDraw is built with
+         * FASTUIDRAW_PAINTER_PHASE_TIMING defined, otherwise
+         * they are always zero.
+         */
+        time_subset_selection,
+
+        /*!
+         * Time in micro-seconds spent fetching (and if needed
+         * creating) the tessellation of paths at the level of
+         * detail needed to draw them.
+         */
+        time_tessellation_fetch,
+
+        /*!
+         * Time in micro-seconds spent applying \ref PathEffect
+         * objects.
+         */
+        time_path_effect,
+
+        /*!
+         * Time in micro-seconds spent writing attribute and index
+         * data with PainterAttributeWriter::write_data().
+         */
+        time_attribute_write,
+
+        /*!
+         * Time in micro-seconds spent packing painter state
+         * (transformation, clipping and headers) to the store
+         * of a \ref PainterDraw.
+         */
+        time_state_packing,
+
+        /*!
+         * Time in micro-seconds spent unmapping \ref PainterDraw
+         * objects and submitting them to the \ref PainterBackend.
+         */
+        time_submission,
       };
 
     /*!
@@ -0,0 +1,115 @@
+/*!
+ * \file painter_picture.hpp
+ * \brief file painter_picture.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/vecN.hpp>
+
+namespace fastuidraw
+{
+  ///@cond
+  class Painter;
+  ///@endcond
+
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterPicture holds the attribute data, index data and
+   * per-draw state generated by a sequence of \ref Painter calls
+   * so that the content can be drawn again, with a different
+   * transformation, without regenerating that data. A PainterPicture
+   * is recorded by a \ref Painter started with Painter::begin(const reference_counted_ptr<PainterPicture>&, ivec2, enum PainterEnums::screen_orientation)
+   * and is drawn with Painter::draw_picture(). Drawing a
+   * PainterPicture only recomputes the transformation and
+   * clipping of the recorded draws.
+   *
+   * The content of a PainterPicture is the content drawn
+   * within the rectangle [0, W] x [0, H] where (W, H) is
+   * the value of dimensions(); content outside of that
+   * rectangle is culled when recording.
+   *
+   * Glyph data is stored by location within the \ref GlyphAtlas;
+   * a PainterPicture becomes invalid (see valid()) when the
+   * \ref GlyphCache of the \ref Painter that recorded it clears
+   * its atlas (see GlyphCache::number_times_atlas_cleared()).
+   * An invalid PainterPicture is not drawn and needs to be
+   * recorded again.
+   *
+   * The thread-safety rules of \ref PainterCommandList also
+   * apply to PainterPicture.
+   */
+  class PainterPicture:
+    public reference_counted<PainterPicture>::concurrent
+  {
+  public:
+    /*!
+     * Ctor.
+     */
+    PainterPicture(void);
+
+    ~PainterPicture();
+
+    /*!
+     * Clear the recorded content, releasing the references
+     * to the values held by the recorded content. Must not
+     * be called while a \ref Painter is recording into the
+     * PainterPicture.
+     */
+    void
+    clear(void);
+
+    /*!
+     * Returns true if nothing has been recorded.
+     */
+    bool
+    empty(void) const;
+
+    /*!
+     * Returns true if a \ref Painter is currently
+     * recording to this PainterPicture.
+     */
+    bool
+    recording(void) const;
+
+    /*!
+     * Returns true if this PainterPicture has been recorded
+     * and the \ref GlyphAtlas it references has not been
+     * cleared since it was recorded.
+     */
+    bool
+    valid(void) const;
+
+    /*!
+     * Returns the dimensions of the rectangle the
+     * PainterPicture was recorded against.
+     */
+    ivec2
+    dimensions(void) const;
+
+  private:
+    friend class Painter;
+    void *m_d;
+  };
+
+/*! @} */
+}
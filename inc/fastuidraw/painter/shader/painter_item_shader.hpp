@@ -18,6 +18,7 @@
 
 
 #pragma once
+#include <fastuidraw/util/math.hpp>
 #include <fastuidraw/painter/shader/painter_shader.hpp>
 #include <fastuidraw/painter/shader/painter_item_coverage_shader.hpp>
 
@@ -50,7 +51,8 @@ namespace fastuidraw
     PainterItemShader(const reference_counted_ptr<PainterItemCoverageShader> &cvg =
                       reference_counted_ptr<PainterItemCoverageShader>()):
       PainterShader(),
-      m_coverage_shader(cvg)
+      m_coverage_shader(cvg),
+      m_number_attribute_slots(3)
     {}
 
     /*!
@@ -72,7 +74,8 @@ namespace fastuidraw
                       const reference_counted_ptr<PainterItemCoverageShader> &cvg =
                       reference_counted_ptr<PainterItemCoverageShader>()):
       PainterShader(num_sub_shaders),
-      m_coverage_shader(cvg)
+      m_coverage_shader(cvg),
+      m_number_attribute_slots(3)
     {}
 
     /*!
@@ -92,7 +95,8 @@ namespace fastuidraw
                       const reference_counted_ptr<PainterItemCoverageShader> &cvg =
                       reference_counted_ptr<PainterItemCoverageShader>()):
       PainterShader(parent, sub_shader),
-      m_coverage_shader(cvg)
+      m_coverage_shader(cvg),
+      m_number_attribute_slots(parent ? parent->number_attribute_slots() : 3)
     {}
 
     /*!
@@ -108,8 +112,40 @@ namespace fastuidraw
       return m_coverage_shader;
     }
 
+    /*!
+     * Returns how many of the fields of \ref PainterAttribute
+     * the shader reads: a value of 1 means only
+     * PainterAttribute::m_attrib0 is read, a value of 2
+     * means PainterAttribute::m_attrib0 and
+     * PainterAttribute::m_attrib1 are read and a value of
+     * 3 means all fields are read. A \ref PainterBackend
+     * may use this value to upload only the fields that
+     * the shaders of a \ref PainterDraw read. A sub-shader
+     * takes the value of its parent on construction.
+     * Default value is 3.
+     */
+    unsigned int
+    number_attribute_slots(void) const
+    {
+      return m_number_attribute_slots;
+    }
+
+    /*!
+     * Set the value returned by number_attribute_slots(void) const.
+     * The value is clamped to the range [1, 3]. Must be called
+     * before the shader is registered.
+     * \param v value to use
+     */
+    PainterItemShader&
+    number_attribute_slots(unsigned int v)
+    {
+      m_number_attribute_slots = t_max(1u, t_min(3u, v));
+      return *this;
+    }
+
   private:
     reference_counted_ptr<PainterItemCoverageShader> m_coverage_shader;
+    unsigned int m_number_attribute_slots;
   };
 
 /*! @} */
@@ -49,7 +49,7 @@ class Path;
  * path when drawn has very high density of edges.
  */
 class ShaderFilledPath:
-  public reference_counted<ShaderFilledPath>::non_concurrent
+  public reference_counted<ShaderFilledPath>::concurrent
 {
 public:
   /*!
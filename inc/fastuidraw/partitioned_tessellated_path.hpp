@@ -47,7 +47,7 @@ namespace fastuidraw  {
    * TessellatedPath::segment values.
    */
   class PartitionedTessellatedPath:
-    public reference_counted<PartitionedTessellatedPath>::non_concurrent
+    public reference_counted<PartitionedTessellatedPath>::concurrent
   {
   public:
     /*!
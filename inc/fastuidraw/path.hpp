@@ -46,7 +46,7 @@ namespace fastuidraw  {
  * to the first point.
  */
 class PathContour:
-    public reference_counted<PathContour>::non_concurrent
+    public reference_counted<PathContour>::concurrent
 {
 public:
   /*!
@@ -91,7 +91,7 @@ public:
    * the shape of an edge.
    */
   class interpolator_base:
-    public reference_counted<interpolator_base>::non_concurrent
+    public reference_counted<interpolator_base>::concurrent
   {
   public:
     /*!
@@ -250,10 +250,14 @@ public:
   public:
     /*!
      * A tessellated_region is a base class for a cookie
-     * used and generated by tessellate().
+     * used and generated by tessellate(). Path objects that
+     * share a \ref PathContour may be tessellated on different
+     * threads at the same time, so the methods of a region may
+     * be called from several threads at once; a derived class
+     * that computes values lazily must guard them.
      */
     class tessellated_region:
-      public reference_counted<tessellated_region>::non_concurrent
+      public reference_counted<tessellated_region>::concurrent
     {
     public:
       /*!
@@ -398,6 +402,18 @@ public:
     bool
     is_flat(void) const;
 
+    /*!
+     * If TessellatedPath::TessellationParams::m_flatten_curves
+     * is true and the curve is quadratic or cubic, tessellates
+     * the curve directly into line segments, otherwise does the
+     * same as interpolator_generic::produce_tessellation().
+     */
+    virtual
+    reference_counted_ptr<tessellation_state>
+    produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                         TessellatedPath::SegmentStorage *out_data,
+                         float *out_max_distance) const;
+
     virtual
     void
     tessellate(reference_counted_ptr<tessellated_region> in_region,
@@ -663,6 +679,19 @@ private:
  * \brief
  * A Path represents a collection of PathContour
  * objects.
+ *
+ * The values returned by tessellation(), shader_filled_path()
+ * and approximate_bounding_box() are computed lazily. These
+ * methods may be called from several threads at the same time,
+ * for example to construct the tessellations of a Path on a
+ * worker thread while another thread draws it; a value is only
+ * computed once and fetching a value that was already computed
+ * does not lock. The tessellations can also be prepared on
+ * background threads with prepare_async(). Path objects that
+ * share a \ref PathContour (see add_contour()) may also be
+ * tessellated at the same time on different threads. The Path
+ * (and its contours) must not be modified while another thread
+ * uses it.
  */
 class Path:noncopyable
 {
@@ -1084,6 +1113,77 @@ public:
   const TessellatedPath&
   tessellation(void) const;
 
+  /*!
+   * Set the maximum number of threads used to construct the
+   * TessellatedPath values returned by tessellation(), see
+   * TessellatedPath::TessellationParams::m_max_number_threads.
+   * Default value is 1.
+   * \param v value to use
+   */
+  Path&
+  max_tessellation_threads(unsigned int v);
+
+  /*!
+   * Returns the value set by max_tessellation_threads(unsigned int).
+   */
+  unsigned int
+  max_tessellation_threads(void) const;
+
+  /*!
+   * Set if the TessellatedPath values returned by tessellation()
+   * tessellate quadratic and cubic curves directly into line
+   * segments, see TessellatedPath::TessellationParams::m_flatten_curves.
+   * Changing the value discards the tessellations already made.
+   * Default value is false.
+   * \param v value to use
+   */
+  Path&
+  flatten_curves(bool v);
+
+  /*!
+   * Returns the value set by flatten_curves(bool).
+   */
+  bool
+  flatten_curves(void) const;
+
+  /*!
+   * Prepare on background threads the tessellations of this Path
+   * for the given thresholds (see tessellation(float) const) and
+   * the values named by what of those tessellations. The coarsest
+   * tessellation is always prepared first and the thresholds are
+   * prepared from largest to smallest. Modifying or destroying the
+   * Path waits until the preparation is finished. While a preparation
+   * is pending, prepared_threshold() allows to draw with geometry
+   * that is already prepared instead of waiting for it.
+   * \param thresholds thresholds for which to prepare tessellations
+   * \param what bit mask of PathEnums::prepare_geometry_t values
+   *             naming what to prepare of each tessellation
+   */
+  void
+  prepare_async(c_array<const float> thresholds, uint32_t what) const;
+
+  /*!
+   * Returns the threshold to use in place of thresh for
+   * tessellation(float) const and for the values named by
+   * what of the returned \ref TessellatedPath so that the
+   * values come from a preparation started with prepare_async()
+   * that has finished:
+   *  - if a threshold no more than thresh was prepared, returns
+   *    the largest such threshold
+   *  - otherwise, if a preparation is still pending, returns the
+   *    smallest threshold prepared so far so that a coarser level
+   *    of detail is used until the finer one is ready
+   *  - otherwise returns thresh.
+   *
+   * If prepare_async() was not called since the Path was last
+   * modified, or if thresh is not positive, returns thresh.
+   * \param thresh threshold as passed to tessellation(float) const
+   * \param what bit mask of PathEnums::prepare_geometry_t values
+   *             naming what of the tessellation is to be used
+   */
+  float
+  prepared_threshold(float thresh, uint32_t what) const;
+
   /*!
    * Returns the \ref ShaderFilledPath coming from this
    * Path. The returned reference will be null if the
@@ -94,6 +94,24 @@ public:
 
       path_geometry_inflation_index_count,
     };
+
+  /*!
+   * Bit flags to specify, in addition to the \ref TessellatedPath
+   * values, what Path::prepare_async() prepares.
+   */
+  enum prepare_geometry_t
+    {
+      /*!
+       * Prepare the values of TessellatedPath::filled(float) const
+       */
+      prepare_filled = 1,
+
+      /*!
+       * Prepare the values of TessellatedPath::stroked() const
+       * of the tessellations and of their linearizations.
+       */
+      prepare_stroked = 2,
+    };
 };
 /*! @} */
 
@@ -57,9 +57,15 @@ class PartitionedTessellatedPath;
  * the source \ref PathContour. In particular, for each contour
  * of a TessellatedPath, if an edge is closed, the closing edge
  * is the last edge.
+ *
+ * The values returned by linearization(), stroked(), filled()
+ * and partitioned() are constructed lazily. These methods may be
+ * called from several threads at the same time: each value is
+ * constructed only once, and after it is constructed, fetching
+ * it does not lock.
  */
 class TessellatedPath:
-    public reference_counted<TessellatedPath>::non_concurrent
+    public reference_counted<TessellatedPath>::concurrent
 {
 public:
   /*!
@@ -127,7 +133,9 @@ public:
      */
     TessellationParams(void):
       m_max_distance(-1.0f),
-      m_max_recursion(5)
+      m_max_recursion(5),
+      m_max_number_threads(1),
+      m_flatten_curves(false)
     {}
 
     /*!
@@ -155,6 +163,28 @@ public:
       return *this;
     }
 
+    /*!
+     * Set the value of \ref m_max_number_threads.
+     * \param v value to which to assign to \ref m_max_number_threads
+     */
+    TessellationParams&
+    max_number_threads(unsigned int v)
+    {
+      m_max_number_threads = v;
+      return *this;
+    }
+
+    /*!
+     * Set the value of \ref m_flatten_curves.
+     * \param v value to which to assign to \ref m_flatten_curves
+     */
+    TessellationParams&
+    flatten_curves(bool v)
+    {
+      m_flatten_curves = v;
+      return *this;
+    }
+
     /*!
      * Maximum distance to attempt between the actual curve and the
      * tessellation. A value less than or equal to zero indicates to
@@ -168,6 +198,35 @@ public:
      * Default value is 5.
      */
     unsigned int m_max_recursion;
+
+    /*!
+     * Maximum number of threads used to tessellate the contours
+     * of a \ref Path, including the thread constructing the \ref
+     * TessellatedPath; an additional thread is only used when
+     * there are enough edges to tessellate to make it worthwhile.
+     * The additional threads come from a pool of background threads
+     * shared by the process, so the actual parallelism is also limited
+     * by the size of that pool.
+     * The value affects only how fast a \ref TessellatedPath is
+     * constructed; the tessellation is the same regardless of the
+     * number of threads. A \ref Refiner uses the value of the
+     * \ref TessellatedPath from which it was created. Default
+     * value is 1.
+     */
+    unsigned int m_max_number_threads;
+
+    /*!
+     * If true, quadratic and cubic PathContour::bezier edges
+     * are tessellated directly into line segments instead of
+     * by recursively cutting the curve in half and fitting
+     * arcs; the number of line segments is computed from an
+     * upper bound of the distance between the curve and its
+     * flattening (Wang's formula) so that the distance is no
+     * more than \ref m_max_distance. The number of line
+     * segments is no more than 2 raised to \ref m_max_recursion.
+     * Default value is false.
+     */
+    bool m_flatten_curves;
   };
 
   /*!
@@ -940,6 +999,12 @@ public:
   partitioned(void) const;
 
 private:
+  friend class Path;
+
+  TessellatedPath(const Path &input, TessellationParams P,
+                  reference_counted_ptr<Refiner> *ref,
+                  void *contour_cache);
+
   TessellatedPath(Refiner *p, float threshhold,
                   unsigned int additional_recursion_count);
 
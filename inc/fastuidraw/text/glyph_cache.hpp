@@ -38,6 +38,21 @@ namespace fastuidraw
    * of the data to a GlyphAtlas. The methods of GlyphAtlas are thread
    * safe because it maintains an internal mutex lock for the durations
    * of its methods.
+   *
+   * The fetch methods (and add_glyph()) of a GlyphCache may be called
+   * concurrently from several threads, for example by several \ref
+   * Painter objects on different threads sharing one \ref PainterEngine.
+   * The lookup of glyphs is done behind a mutex of the GlyphCache, but
+   * the generation of the rendering data of a glyph and its upload to
+   * the GlyphAtlas are done behind a mutex of the glyph only; thus
+   * threads fetching different glyphs generate them in parallel and a
+   * fetch of a glyph that is already generated and uploaded does not
+   * block on the generation of other glyphs. The methods delete_glyph(),
+   * clear_atlas() and clear_cache() are thread safe with respect to the
+   * GlyphCache, but they invalidate (or require re-uploading of) \ref
+   * Glyph values that other threads may be using; they should only be
+   * called when no other thread is fetching glyphs or drawing with
+   * glyphs from the GlyphCache.
    */
   class GlyphCache:public reference_counted<GlyphCache>::concurrent
   {
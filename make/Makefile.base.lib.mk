@@ -1,5 +1,5 @@
-FASTUIDRAW_DEPS_LIBS += $(shell pkg-config freetype2 --libs)
-FASTUIDRAW_DEPS_STATIC_LIBS += $(shell pkg-config freetype2 --static --libs)
+FASTUIDRAW_DEPS_LIBS += $(shell pkg-config freetype2 --libs) -pthread
+FASTUIDRAW_DEPS_STATIC_LIBS += $(shell pkg-config freetype2 --static --libs) -pthread
 
 FASTUIDRAW_BASE_CFLAGS = -std=c++11
 FASTUIDRAW_debug_BASE_CFLAGS = $(FASTUIDRAW_BASE_CFLAGS) -DFASTUIDRAW_DEBUG
@@ -11,6 +11,10 @@ FASTUIDRAW_release_CFLAGS = $(FASTUIDRAW_DEPENDS_CFLAGS) $(FASTUIDRAW_release_BA
 
 FASTUIDRAW_BUILD_debug_FLAGS = -g -D_GLIBCXX_DEBUG
 FASTUIDRAW_BUILD_release_FLAGS = -O3 -fstrict-aliasing
+ifeq ($(PAINTER_PHASE_TIMING),1)
+FASTUIDRAW_BUILD_debug_FLAGS += -DFASTUIDRAW_PAINTER_PHASE_TIMING
+FASTUIDRAW_BUILD_release_FLAGS += -DFASTUIDRAW_PAINTER_PHASE_TIMING
+endif
 FASTUIDRAW_BUILD_WARN_FLAGS = -Wall -Wextra -Wcast-qual -Wwrite-strings
 FASTUIDRAW_BUILD_INCLUDES_CFLAGS = -Iinc -Isrc/fastuidraw/internal -Isrc/fastuidraw/internal/3rd_party
 
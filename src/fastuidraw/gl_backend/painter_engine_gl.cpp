@@ -116,7 +116,9 @@ namespace
       m_fbf_blending_type(fastuidraw::glsl::PainterShaderRegistrarGLSL::fbf_blending_not_supported),
       m_allow_bindless_texture_from_surface(true),
       m_support_dual_src_blend_shaders(true),
-      m_use_uber_item_shader(true)
+      m_use_uber_item_shader(true),
+      m_compact_attributes(false),
+      m_compact_indices(false)
     {}
 
     unsigned int m_attributes_per_buffer;
@@ -139,6 +141,8 @@ namespace
     bool m_allow_bindless_texture_from_surface;
     bool m_support_dual_src_blend_shaders;
     bool m_use_uber_item_shader;
+    bool m_compact_attributes;
+    bool m_compact_indices;
 
     std::string m_glsl_version_override;
     fastuidraw::gl::PainterEngineGL::ImageAtlasParams m_image_atlas_params;
@@ -1081,6 +1085,10 @@ setget_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, Configuration
                  bool, support_dual_src_blend_shaders)
 setget_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, ConfigurationGLPrivate,
                  bool, use_uber_item_shader)
+setget_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, ConfigurationGLPrivate,
+                 bool, compact_attributes)
+setget_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, ConfigurationGLPrivate,
+                 bool, compact_indices)
 get_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, ConfigurationGLPrivate,
               const fastuidraw::gl::PainterEngineGL::ImageAtlasParams&, image_atlas_params)
 get_implement(fastuidraw::gl::PainterEngineGL::ConfigurationGL, ConfigurationGLPrivate,
@@ -0,0 +1,142 @@
+/*!
+ * \file background_jobs.cpp
+ * \brief file background_jobs.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/math.hpp>
+#include <private/background_jobs.hpp>
+
+namespace
+{
+  class BackgroundJobs:fastuidraw::noncopyable
+  {
+  public:
+    typedef std::function<void ()> Job;
+
+    enum
+      {
+        max_number_threads = 4
+      };
+
+    BackgroundJobs(void);
+    ~BackgroundJobs();
+
+    void
+    submit(const Job &job);
+
+  private:
+    void
+    run(void);
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<Job> m_jobs;
+    bool m_stop;
+    std::vector<std::thread> m_threads;
+  };
+}
+
+/////////////////////////////////
+// BackgroundJobs methods
+BackgroundJobs::
+BackgroundJobs(void):
+  m_stop(false)
+{
+  unsigned int num_threads;
+
+  /* leave one hardware thread for the thread
+   * that submits the jobs.
+   */
+  num_threads = std::thread::hardware_concurrency();
+  num_threads = (num_threads > 1u) ? num_threads - 1u : 1u;
+  num_threads = fastuidraw::t_min(num_threads, static_cast<unsigned int>(max_number_threads));
+
+  m_threads.reserve(num_threads);
+  for (unsigned int i = 0; i < num_threads; ++i)
+    {
+      m_threads.push_back(std::thread([this]() { run(); }));
+    }
+}
+
+BackgroundJobs::
+~BackgroundJobs()
+{
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_all();
+
+  for (std::thread &t : m_threads)
+    {
+      t.join();
+    }
+}
+
+void
+BackgroundJobs::
+submit(const Job &job)
+{
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    m_jobs.push_back(job);
+  }
+  m_condition.notify_one();
+}
+
+void
+BackgroundJobs::
+run(void)
+{
+  for (;;)
+    {
+      Job job;
+
+      {
+        std::unique_lock<std::mutex> m(m_mutex);
+
+        /* the threads only exit once all the jobs are
+         * done because a job might have something
+         * waiting on it.
+         */
+        m_condition.wait(m, [this]() { return m_stop || !m_jobs.empty(); });
+        if (m_jobs.empty())
+          {
+            return;
+          }
+        job.swap(m_jobs.front());
+        m_jobs.pop_front();
+      }
+
+      job();
+    }
+}
+
+/////////////////////////////////
+// fastuidraw::detail methods
+void
+fastuidraw::detail::
+submit_background_job(const std::function<void ()> &job)
+{
+  static BackgroundJobs jobs;
+  jobs.submit(job);
+}
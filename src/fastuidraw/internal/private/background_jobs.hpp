@@ -0,0 +1,37 @@
+/*!
+ * \file background_jobs.hpp
+ * \brief file background_jobs.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <functional>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Run a job on one of the threads of a process wide pool
+     * of background threads. The threads are created the first
+     * time a job is submitted; jobs are started in the order they
+     * are submitted. All submitted jobs are run before the process
+     * exits, so a job must not wait for anything that is only done
+     * after main() returns.
+     */
+    void
+    submit_background_job(const std::function<void ()> &job);
+  }
+}
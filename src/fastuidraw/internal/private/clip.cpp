@@ -16,11 +16,103 @@
  *
  */
 
+#include <atomic>
 #include <private/clip.hpp>
 #include <private/util_private.hpp>
 
+/* The box and point culling tests work on 4 clip equations
+ * at a time; use SSE or NEON when the target has it and
+ * fall back to plain loops over 4 floats otherwise.
+ */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FASTUIDRAW_CLIP_USE_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FASTUIDRAW_CLIP_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace
 {
+  std::atomic<bool>&
+  packed_clip_planes_flag(void)
+  {
+    static std::atomic<bool> R(true);
+    return R;
+  }
+
+#if defined(FASTUIDRAW_CLIP_USE_SSE)
+  typedef __m128 float4;
+
+  inline float4 load4(const float *p) { return _mm_loadu_ps(p); }
+  inline float4 splat4(float v) { return _mm_set1_ps(v); }
+  inline float4 add4(float4 a, float4 b) { return _mm_add_ps(a, b); }
+  inline float4 mul4(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+  inline float4 min4(float4 a, float4 b) { return _mm_min_ps(a, b); }
+  inline float4 max4(float4 a, float4 b) { return _mm_max_ps(a, b); }
+
+  /* returns a bit mask with bit i up if lane i is >= 0 */
+  inline
+  unsigned int
+  non_negative_mask4(float4 a)
+  {
+    return _mm_movemask_ps(_mm_cmpge_ps(a, _mm_setzero_ps()));
+  }
+#elif defined(FASTUIDRAW_CLIP_USE_NEON)
+  typedef float32x4_t float4;
+
+  inline float4 load4(const float *p) { return vld1q_f32(p); }
+  inline float4 splat4(float v) { return vdupq_n_f32(v); }
+  inline float4 add4(float4 a, float4 b) { return vaddq_f32(a, b); }
+  inline float4 mul4(float4 a, float4 b) { return vmulq_f32(a, b); }
+  inline float4 min4(float4 a, float4 b) { return vminq_f32(a, b); }
+  inline float4 max4(float4 a, float4 b) { return vmaxq_f32(a, b); }
+
+  inline
+  unsigned int
+  non_negative_mask4(float4 a)
+  {
+    uint32x4_t m;
+
+    m = vcgeq_f32(a, vdupq_n_f32(0.0f));
+    return (vgetq_lane_u32(m, 0) & 1u)
+      | (vgetq_lane_u32(m, 1) & 2u)
+      | (vgetq_lane_u32(m, 2) & 4u)
+      | (vgetq_lane_u32(m, 3) & 8u);
+  }
+#else
+  typedef fastuidraw::vecN<float, 4> float4;
+
+  inline float4 load4(const float *p) { return float4(p[0], p[1], p[2], p[3]); }
+  inline float4 splat4(float v) { return float4(v); }
+  inline float4 add4(const float4 &a, const float4 &b) { return a + b; }
+  inline float4 mul4(const float4 &a, const float4 &b) { return a * b; }
+
+  inline
+  float4
+  min4(const float4 &a, const float4 &b)
+  {
+    return float4(fastuidraw::t_min(a[0], b[0]), fastuidraw::t_min(a[1], b[1]),
+                  fastuidraw::t_min(a[2], b[2]), fastuidraw::t_min(a[3], b[3]));
+  }
+
+  inline
+  float4
+  max4(const float4 &a, const float4 &b)
+  {
+    return float4(fastuidraw::t_max(a[0], b[0]), fastuidraw::t_max(a[1], b[1]),
+                  fastuidraw::t_max(a[2], b[2]), fastuidraw::t_max(a[3], b[3]));
+  }
+
+  inline
+  unsigned int
+  non_negative_mask4(const float4 &a)
+  {
+    return (a[0] >= 0.0f ? 1u : 0u) | (a[1] >= 0.0f ? 2u : 0u)
+      | (a[2] >= 0.0f ? 4u : 0u) | (a[3] >= 0.0f ? 8u : 0u);
+  }
+#endif
+
   inline
   float
   compute_clip_dist(const fastuidraw::vec3 &clip_eq,
@@ -126,6 +218,94 @@ namespace
     *out_idx = src;
     return unclipped;
   }
+
+  bool
+  all_pts_culled_by_one_half_plane_packed(fastuidraw::c_array<const fastuidraw::vec3> clip_eq,
+                                          fastuidraw::c_array<const fastuidraw::vec3> pts)
+  {
+    using namespace fastuidraw;
+
+    for (unsigned int i = 0; i < clip_eq.size(); i += 4)
+      {
+        vecN<float, 4> ax(0.0f), ay(0.0f), az(1.0f);
+        unsigned int n, active, not_culled(0u);
+
+        n = t_min(4u, static_cast<unsigned int>(clip_eq.size()) - i);
+        active = (1u << n) - 1u;
+        for (unsigned int k = 0; k < n; ++k)
+          {
+            ax[k] = clip_eq[i + k].x();
+            ay[k] = clip_eq[i + k].y();
+            az[k] = clip_eq[i + k].z();
+          }
+
+        float4 a(load4(ax.c_ptr())), b(load4(ay.c_ptr())), c(load4(az.c_ptr()));
+        for (unsigned int p = 0; p < pts.size() && (not_culled & active) != active; ++p)
+          {
+            float4 d;
+
+            d = add4(add4(mul4(splat4(pts[p].x()), a),
+                          mul4(splat4(pts[p].y()), b)),
+                     mul4(splat4(pts[p].z()), c));
+            not_culled |= non_negative_mask4(d);
+          }
+
+        if ((not_culled & active) != active)
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+
+  bool
+  all_pts_culled_by_one_half_plane_per_plane(fastuidraw::c_array<const fastuidraw::vec3> clip_eq,
+                                             fastuidraw::c_array<const fastuidraw::vec3> pts)
+  {
+    for (const fastuidraw::vec3 &eq : clip_eq)
+      {
+        bool culled(true);
+
+        for (unsigned int p = 0; p < pts.size() && culled; ++p)
+          {
+            /* same order of operations as the packed test */
+            culled = (pts[p].x() * eq.x() + pts[p].y() * eq.y() + pts[p].z() * eq.z() < 0.0f);
+          }
+
+        if (culled)
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+}
+
+bool
+fastuidraw::detail::
+packed_clip_planes_enabled(void)
+{
+  return packed_clip_planes_flag().load(std::memory_order_relaxed);
+}
+
+void
+fastuidraw::detail::
+packed_clip_planes_enabled(bool v)
+{
+  packed_clip_planes_flag().store(v, std::memory_order_relaxed);
+}
+
+fastuidraw::c_string
+fastuidraw::detail::
+packed_clip_planes_instruction_set(void)
+{
+#if defined(FASTUIDRAW_CLIP_USE_SSE)
+  return "SSE";
+#elif defined(FASTUIDRAW_CLIP_USE_NEON)
+  return "NEON";
+#else
+  return "none";
+#endif
 }
 
 bool
@@ -161,3 +341,127 @@ clip_against_planes(c_array<const vec3> clip_eq, c_array<const vec3> in_pts,
 {
   return clip_against_planesT<vec3>(clip_eq, in_pts, out_idx, scratch_space);
 }
+
+////////////////////////////////////////
+// fastuidraw::detail::PackedClipPlanes methods
+void
+fastuidraw::detail::PackedClipPlanes::
+set(c_array<const vec3> clip_eq)
+{
+  unsigned int sz;
+
+  m_packed = packed_clip_planes_enabled();
+  m_number_planes = clip_eq.size();
+  sz = (m_number_planes + 3u) & ~3u;
+  m_x.resize(sz);
+  m_y.resize(sz);
+  m_z.resize(sz);
+  for (unsigned int i = 0; i < m_number_planes; ++i)
+    {
+      m_x[i] = clip_eq[i].x();
+      m_y[i] = clip_eq[i].y();
+      m_z[i] = clip_eq[i].z();
+    }
+  for (unsigned int i = m_number_planes; i < sz; ++i)
+    {
+      m_x[i] = 0.0f;
+      m_y[i] = 0.0f;
+      m_z[i] = 1.0f;
+    }
+}
+
+enum fastuidraw::detail::PackedClipPlanes::box_classification_t
+fastuidraw::detail::PackedClipPlanes::
+classify_box(const vec2 &min_pt, const vec2 &max_pt) const
+{
+  enum box_classification_t R;
+
+  if (!m_packed)
+    {
+      return box_partially_clipped;
+    }
+
+  R = classify_box_packed(min_pt, max_pt);
+  FASTUIDRAWassert(R == classify_box_per_plane(min_pt, max_pt));
+  return R;
+}
+
+enum fastuidraw::detail::PackedClipPlanes::box_classification_t
+fastuidraw::detail::PackedClipPlanes::
+classify_box_per_plane(const vec2 &min_pt, const vec2 &max_pt) const
+{
+  bool unclipped(true);
+
+  for (unsigned int i = 0; i < m_number_planes; ++i)
+    {
+      vec3 eq(m_x[i], m_y[i], m_z[i]);
+      vecN<float, 4> d;
+      float near_d, far_d;
+
+      d[0] = compute_clip_dist(eq, vec2(min_pt.x(), min_pt.y()));
+      d[1] = compute_clip_dist(eq, vec2(max_pt.x(), min_pt.y()));
+      d[2] = compute_clip_dist(eq, vec2(max_pt.x(), max_pt.y()));
+      d[3] = compute_clip_dist(eq, vec2(min_pt.x(), max_pt.y()));
+      near_d = t_min(t_min(d[0], d[1]), t_min(d[2], d[3]));
+      far_d = t_max(t_max(d[0], d[1]), t_max(d[2], d[3]));
+
+      if (!(far_d >= 0.0f))
+        {
+          return box_culled;
+        }
+      unclipped = unclipped && (near_d >= 0.0f);
+    }
+
+  return unclipped ? box_unclipped : box_partially_clipped;
+}
+
+enum fastuidraw::detail::PackedClipPlanes::box_classification_t
+fastuidraw::detail::PackedClipPlanes::
+classify_box_packed(const vec2 &min_pt, const vec2 &max_pt) const
+{
+  float4 x0(splat4(min_pt.x())), x1(splat4(max_pt.x()));
+  float4 y0(splat4(min_pt.y())), y1(splat4(max_pt.y()));
+  bool unclipped(true);
+
+  for (unsigned int i = 0, endi = m_x.size(); i < endi; i += 4)
+    {
+      float4 a(load4(&m_x[i])), b(load4(&m_y[i])), c(load4(&m_z[i]));
+      float4 ax0(mul4(a, x0)), ax1(mul4(a, x1));
+      float4 by0(mul4(b, y0)), by1(mul4(b, y1));
+      float4 near_d, far_d;
+
+      /* The corner of the box closest to (resp. farthest from)
+       * the wrong side of a plane is the one that minimizes
+       * (resp. maximizes) each of a * x and b * y; the sums are
+       * formed in the same order as clip_against_plane() does
+       * so that the classification agrees with it exactly.
+       */
+      near_d = add4(add4(min4(ax0, ax1), min4(by0, by1)), c);
+      far_d = add4(add4(max4(ax0, ax1), max4(by0, by1)), c);
+
+      if (non_negative_mask4(far_d) != 0xF)
+        {
+          return box_culled;
+        }
+      unclipped = unclipped && (non_negative_mask4(near_d) == 0xF);
+    }
+
+  return unclipped ? box_unclipped : box_partially_clipped;
+}
+
+bool
+fastuidraw::detail::
+all_pts_culled_by_one_half_plane(c_array<const vec3> clip_eq,
+                                 c_array<const vec3> pts)
+{
+  bool R;
+
+  if (!packed_clip_planes_enabled())
+    {
+      return all_pts_culled_by_one_half_plane_per_plane(clip_eq, pts);
+    }
+
+  R = all_pts_culled_by_one_half_plane_packed(clip_eq, pts);
+  FASTUIDRAWassert(R == all_pts_culled_by_one_half_plane_per_plane(clip_eq, pts));
+  return R;
+}
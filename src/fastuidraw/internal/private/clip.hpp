@@ -20,6 +20,7 @@
 #pragma once
 
 #include <vector>
+#include <fastuidraw/util/util.hpp>
 #include <fastuidraw/util/vecN.hpp>
 #include <fastuidraw/util/c_array.hpp>
 
@@ -68,6 +69,118 @@ namespace fastuidraw
       return return_value;
     }
 
+    /* Returns true if PackedClipPlanes and
+     * all_pts_culled_by_one_half_plane() use the tests that
+     * handle 4 clip equations at a time; if false they fall back
+     * to testing one clip equation at a time (and classify_box()
+     * leaves the work to clip_against_planes()). Default is true.
+     * Backs ClipCullingParams::packed_culling().
+     */
+    bool
+    packed_clip_planes_enabled(void);
+
+    /* Set the value returned by packed_clip_planes_enabled().
+     * PackedClipPlanes objects read the value in set().
+     */
+    void
+    packed_clip_planes_enabled(bool v);
+
+    /* Returns the instruction set used by the tests that handle
+     * 4 clip equations at a time: "SSE", "NEON" or "none".
+     */
+    c_string
+    packed_clip_planes_instruction_set(void);
+
+    /* A PackedClipPlanes holds a set of clip equations with the
+     * x, y and z coefficients in seperate arrays padded to a
+     * multiple of 4 so that boxes and points are tested against
+     * 4 planes at once with SSE (or NEON) instructions. The
+     * padding planes are (0, 0, 1) and thus never clip anything.
+     * In debug builds every packed classification is checked
+     * against testing the planes one at a time.
+     */
+    class PackedClipPlanes
+    {
+    public:
+      enum box_classification_t
+        {
+          /* the box is on the wrong side of one of the planes
+           * and thus completely clipped.
+           */
+          box_culled,
+
+          /* the box is completely unclipped
+           */
+          box_unclipped,
+
+          /* the box is neither culled by a single plane nor
+           * completely unclipped; the caller needs to clip the
+           * box with clip_against_planes() to know if any of the
+           * box survives clipping.
+           */
+          box_partially_clipped,
+        };
+
+      PackedClipPlanes(void):
+        m_number_planes(0),
+        m_packed(true)
+      {}
+
+      /* Set the clip equations, the equations and the boxes
+       * classified by classify_box() are in the same coordinate
+       * system. Also latches packed_clip_planes_enabled().
+       */
+      void
+      set(c_array<const vec3> clip_eq);
+
+      unsigned int
+      number_planes(void) const
+      {
+        return m_number_planes;
+      }
+
+      /* Classify the box [min_pt, max_pt] against the planes.
+       * The box is box_unclipped exactly when clip_against_planes()
+       * would return true for the polygon of the corners of the
+       * box. If packed_clip_planes_enabled() was false at set(),
+       * always returns box_partially_clipped so that callers use
+       * the return value of clip_against_planes() instead.
+       */
+      enum box_classification_t
+      classify_box(const vec2 &min_pt, const vec2 &max_pt) const;
+
+      /* Classify the box given as a polygon by Rect::inflated_polygon()
+       * or BoundingBox::inflated_polygon().
+       */
+      enum box_classification_t
+      classify_box(const vecN<vec2, 4> &bb) const
+      {
+        return classify_box(bb[0], bb[2]);
+      }
+
+    private:
+      enum box_classification_t
+      classify_box_packed(const vec2 &min_pt, const vec2 &max_pt) const;
+
+      enum box_classification_t
+      classify_box_per_plane(const vec2 &min_pt, const vec2 &max_pt) const;
+
+      unsigned int m_number_planes;
+      bool m_packed;
+      std::vector<float> m_x, m_y, m_z;
+    };
+
+    /* Returns true if there is a clip equation for which all
+     * of the points pts are on the wrong side, i.e. the polygon
+     * of the points is culled. The clip equations and points are
+     * in the same coordinate system (likely clip-coordinates).
+     * The points are tested against 4 clip equations at a time
+     * unless packed_clip_planes_enabled() is false.
+     */
+    bool
+    all_pts_culled_by_one_half_plane(c_array<const vec3> clip_eq,
+                                     c_array<const vec3> pts);
+
     /* Clip a polygon against a single plane. The clip equation
      * clip_eq and the polygon pts are both in the same coordinate
      * system (likely clip-coordinates). Returns true if the polygon
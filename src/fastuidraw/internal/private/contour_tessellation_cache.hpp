@@ -0,0 +1,70 @@
+/*!
+ * \file contour_tessellation_cache.hpp
+ * \brief file contour_tessellation_cache.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A ContourTessellationCache holds the segments of each
+     * edge of each contour of a Path from the last time the
+     * base tessellation of the Path was made; the cache is
+     * cleared whenever a change to the Path changes the
+     * TessellationParams used for the base tessellation.
+     * The interpolators of a PathContour are never changed
+     * once added, so an edge whose interpolator is the same
+     * object as the cached one has the same tessellation. This
+     * allows a Path that was appended to only tessellate the
+     * edges that were added since it was last tessellated.
+     */
+    class ContourTessellationCache:fastuidraw::noncopyable
+    {
+    public:
+      class Edge
+      {
+      public:
+        reference_counted_ptr<const PathContour::interpolator_base> m_interpolator;
+        std::vector<TessellatedPath::segment> m_segments;
+        float m_max_distance;
+        unsigned int m_recursion_depth;
+      };
+
+      class Contour
+      {
+      public:
+        reference_counted_ptr<const PathContour> m_contour;
+        std::vector<Edge> m_edges;
+      };
+
+      void
+      clear(void)
+      {
+        m_contours.clear();
+      }
+
+      /* one element for each contour of the Path */
+      std::vector<Contour> m_contours;
+    };
+  }
+}
@@ -17,6 +17,7 @@
  */
 
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <sstream>
@@ -184,6 +185,13 @@ public:
   void
   add_entry(GLsizei count, const void *offset);
 
+  /* change the index type to GL_UNSIGNED_SHORT, converting
+   * the offsets added with add_entry() from PainterIndex
+   * offsets to uint16_t offsets.
+   */
+  void
+  use_16bit_indices(void);
+
   void
   draw(fastuidraw::gl::detail::PainterBackendGL *pr,
        const fastuidraw::gl::detail::painter_vao &vao,
@@ -196,6 +204,7 @@ private:
 
   std::vector<GLsizei> m_counts;
   std::vector<const GLvoid*> m_indices;
+  GLenum m_index_type;
   fastuidraw::gl::Program *m_new_program;
   enum fastuidraw::PainterBlendShader::shader_type m_blend_type;
 };
@@ -212,6 +221,14 @@ public:
   virtual
   ~DrawCommand()
   {
+    if (!m_attribute_staging.empty())
+      {
+        m_pool->release_staging(m_attribute_staging);
+      }
+    if (!m_index_staging.empty())
+      {
+        m_pool->release_staging(m_index_staging);
+      }
     m_pool->release_vao(m_vao);
   }
 
@@ -242,9 +259,18 @@ private:
   void
   add_entry(unsigned int indices_written);
 
+  void
+  upload_compact_attributes(unsigned int attributes_written);
+
+  void
+  upload_compact_indices(unsigned int attributes_written,
+                         unsigned int indices_written);
+
   PainterBackendGL *m_pr;
   reference_counted_ptr<painter_vao_pool> m_pool;
   painter_vao m_vao;
+  std::vector<PainterAttribute> m_attribute_staging;
+  std::vector<PainterIndex> m_index_staging;
   unsigned int m_attributes_written, m_indices_written;
   std::list<DrawEntry> m_draws;
 };
@@ -257,6 +283,7 @@ DrawEntry(const BlendMode &mode,
           enum PainterBlendShader::shader_type blend_type):
   m_set_blend(true),
   m_blend_mode(mode),
+  m_index_type(opengl_trait<PainterIndex>::type),
   m_new_program(new_program),
   m_blend_type(blend_type)
 {
@@ -266,6 +293,7 @@ fastuidraw::gl::detail::PainterBackendGL::DrawEntry::
 DrawEntry(const BlendMode &mode):
   m_set_blend(true),
   m_blend_mode(mode),
+  m_index_type(opengl_trait<PainterIndex>::type),
   m_new_program(nullptr),
   m_blend_type(PainterBlendShader::number_types)
 {
@@ -275,6 +303,7 @@ fastuidraw::gl::detail::PainterBackendGL::DrawEntry::
 DrawEntry(const reference_counted_ptr<const PainterDrawBreakAction> &action):
   m_set_blend(false),
   m_action(action),
+  m_index_type(opengl_trait<PainterIndex>::type),
   m_new_program(nullptr),
   m_blend_type(PainterBlendShader::number_types)
 {
@@ -288,6 +317,23 @@ add_entry(GLsizei count, const void *offset)
   m_indices.push_back(offset);
 }
 
+void
+fastuidraw::gl::detail::PainterBackendGL::DrawEntry::
+use_16bit_indices(void)
+{
+  FASTUIDRAWassert(m_index_type == opengl_trait<PainterIndex>::type);
+  m_index_type = GL_UNSIGNED_SHORT;
+  for (const GLvoid* &offset : m_indices)
+    {
+      uintptr_t v;
+
+      v = reinterpret_cast<uintptr_t>(offset);
+      FASTUIDRAWassert(v % sizeof(PainterIndex) == 0);
+      v = (v / sizeof(PainterIndex)) * sizeof(uint16_t);
+      offset = reinterpret_cast<const GLvoid*>(v);
+    }
+}
+
 void
 fastuidraw::gl::detail::PainterBackendGL::DrawEntry::
 draw(fastuidraw::gl::detail::PainterBackendGL *pr,
@@ -337,7 +383,7 @@ draw(fastuidraw::gl::detail::PainterBackendGL *pr,
   #ifndef FASTUIDRAW_GL_USE_GLES
     {
       fastuidraw_glMultiDrawElements(GL_TRIANGLES, &m_counts[0],
-                                     opengl_trait<PainterIndex>::type,
+                                     m_index_type,
                                      &m_indices[0], m_counts.size());
     }
   #else
@@ -345,7 +391,7 @@ draw(fastuidraw::gl::detail::PainterBackendGL *pr,
       if (pr->m_reg_gl->has_multi_draw_elements())
         {
           fastuidraw_glMultiDrawElementsEXT(GL_TRIANGLES, &m_counts[0],
-                                            opengl_trait<PainterIndex>::type,
+                                            m_index_type,
                                             &m_indices[0], m_counts.size());
         }
       else
@@ -353,7 +399,7 @@ draw(fastuidraw::gl::detail::PainterBackendGL *pr,
           for(unsigned int i = 0, endi = m_counts.size(); i < endi; ++i)
             {
               fastuidraw_glDrawElements(GL_TRIANGLES, m_counts[i],
-                                        opengl_trait<PainterIndex>::type,
+                                        m_index_type,
                                         m_indices[i]);
             }
         }
@@ -381,17 +427,39 @@ DrawCommand(const reference_counted_ptr<painter_vao_pool> &hnd,
 
   flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_FLUSH_EXPLICIT_BIT;
 
-  fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
-  attr_bo = fastuidraw_glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->attribute_buffer_size(), flags);
-  FASTUIDRAWassert(attr_bo != nullptr);
+  if (hnd->compact_attributes())
+    {
+      /* attributes are written to CPU memory and only the
+       * fields read by the shaders are uploaded at unmap.
+       */
+      hnd->request_staging(m_attribute_staging);
+      attr_bo = &m_attribute_staging[0];
+    }
+  else
+    {
+      fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
+      attr_bo = fastuidraw_glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->attribute_buffer_size(), flags);
+      FASTUIDRAWassert(attr_bo != nullptr);
+    }
 
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_header_bo);
   header_bo = fastuidraw_glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->header_buffer_size(), flags);
   FASTUIDRAWassert(header_bo != nullptr);
 
-  fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
-  index_bo = fastuidraw_glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, hnd->index_buffer_size(), flags);
-  FASTUIDRAWassert(index_bo != nullptr);
+  if (hnd->compact_indices())
+    {
+      /* indices are written to CPU memory and uploaded at
+       * unmap as 16-bit values if the attribute count allows.
+       */
+      hnd->request_staging(m_index_staging);
+      index_bo = &m_index_staging[0];
+    }
+  else
+    {
+      fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
+      index_bo = fastuidraw_glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, hnd->index_buffer_size(), flags);
+      FASTUIDRAWassert(index_bo != nullptr);
+    }
 
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_data_bo);
   data_bo = fastuidraw_glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->data_buffer_size(), flags);
@@ -557,23 +625,130 @@ unmap_implement(unsigned int attributes_written,
   add_entry(indices_written);
   FASTUIDRAWassert(m_indices_written == indices_written);
 
-  fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
-  fastuidraw_glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(PainterAttribute));
-  fastuidraw_glUnmapBuffer(GL_ARRAY_BUFFER);
+  if (m_attribute_staging.empty())
+    {
+      fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
+      fastuidraw_glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(PainterAttribute));
+      fastuidraw_glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+  else
+    {
+      upload_compact_attributes(attributes_written);
+    }
 
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_header_bo);
   fastuidraw_glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(uint32_t));
   fastuidraw_glUnmapBuffer(GL_ARRAY_BUFFER);
 
-  fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
-  fastuidraw_glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * sizeof(PainterIndex));
-  fastuidraw_glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+  if (m_index_staging.empty())
+    {
+      fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
+      fastuidraw_glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * sizeof(PainterIndex));
+      fastuidraw_glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+    }
+  else
+    {
+      upload_compact_indices(attributes_written, indices_written);
+    }
 
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_data_bo);
   fastuidraw_glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, data_store_written * sizeof(uvec4));
   fastuidraw_glUnmapBuffer(GL_ARRAY_BUFFER);
 }
 
+void
+fastuidraw::gl::detail::PainterBackendGL::DrawCommand::
+upload_compact_attributes(unsigned int attributes_written)
+{
+  const PainterAttribute::pointer_to_field fields[3] =
+    {
+      &PainterAttribute::m_attrib0,
+      &PainterAttribute::m_attrib1,
+      &PainterAttribute::m_attrib2,
+    };
+  unsigned int number_slots;
+
+  number_slots = number_attribute_slots_used();
+  FASTUIDRAWassert(number_slots <= 3);
+  if (attributes_written > 0 && number_slots > 0)
+    {
+      uvec4 *dst;
+
+      fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
+      dst = static_cast<uvec4*>(fastuidraw_glMapBufferRange(GL_ARRAY_BUFFER, 0,
+                                                            attributes_written * number_slots * sizeof(uvec4),
+                                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+      FASTUIDRAWassert(dst != nullptr);
+      if (number_slots == 3)
+        {
+          std::copy(m_attribute_staging.begin(), m_attribute_staging.begin() + attributes_written,
+                    reinterpret_cast<PainterAttribute*>(dst));
+        }
+      else
+        {
+          for (unsigned int i = 0; i < attributes_written; ++i)
+            {
+              for (unsigned int k = 0; k < number_slots; ++k, ++dst)
+                {
+                  *dst = m_attribute_staging[i].*fields[k];
+                }
+            }
+        }
+      fastuidraw_glUnmapBuffer(GL_ARRAY_BUFFER);
+
+      if (number_slots != 3)
+        {
+          m_pool->compact_vao_attributes(m_vao, number_slots);
+        }
+    }
+  m_pool->release_staging(m_attribute_staging);
+}
+
+void
+fastuidraw::gl::detail::PainterBackendGL::DrawCommand::
+upload_compact_indices(unsigned int attributes_written,
+                       unsigned int indices_written)
+{
+  bool use_16bit;
+  unsigned int index_size;
+
+  use_16bit = (attributes_written <= 65536u);
+  index_size = (use_16bit) ? sizeof(uint16_t) : sizeof(PainterIndex);
+  if (indices_written > 0)
+    {
+      void *dst;
+
+      fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
+      dst = fastuidraw_glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * index_size,
+                                        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+      FASTUIDRAWassert(dst != nullptr);
+      if (use_16bit)
+        {
+          uint16_t *dst16(static_cast<uint16_t*>(dst));
+          for (unsigned int i = 0; i < indices_written; ++i)
+            {
+              FASTUIDRAWassert(m_index_staging[i] < attributes_written);
+              dst16[i] = static_cast<uint16_t>(m_index_staging[i]);
+            }
+        }
+      else
+        {
+          std::copy(m_index_staging.begin(), m_index_staging.begin() + indices_written,
+                    static_cast<PainterIndex*>(dst));
+        }
+      fastuidraw_glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+    }
+
+  if (use_16bit)
+    {
+      for (DrawEntry &entry : m_draws)
+        {
+          entry.use_16bit_indices();
+        }
+    }
+  m_pool->release_staging(m_index_staging);
+}
+
 void
 fastuidraw::gl::detail::PainterBackendGL::DrawCommand::
 add_entry(unsigned int indices_written)
@@ -25,6 +25,8 @@ fastuidraw::gl::detail::painter_vao_pool::
 painter_vao_pool(const PainterEngineGL::ConfigurationGL &params,
                  enum tex_buffer_support_t tex_buffer_support,
                  unsigned int data_store_binding):
+  m_compact_attributes(params.compact_attributes()),
+  m_compact_indices(params.compact_indices()),
   m_attribute_buffer_size(params.attributes_per_buffer() * sizeof(PainterAttribute)),
   m_header_buffer_size(params.attributes_per_buffer() * sizeof(uint32_t)),
   m_index_buffer_size(params.indices_per_buffer() * sizeof(PainterIndex)),
@@ -35,7 +37,9 @@ painter_vao_pool(const PainterEngineGL::ConfigurationGL &params,
   m_data_store_binding(data_store_binding),
   m_current_pool(0),
   m_free_vaos(params.number_pools()),
-  m_ubos(params.number_pools(), 0)
+  m_ubos(params.number_pools(), 0),
+  m_attribute_staging(params.attributes_per_buffer()),
+  m_index_staging(params.indices_per_buffer())
 {}
 
 fastuidraw::gl::detail::painter_vao_pool::
@@ -127,20 +131,7 @@ create_vao(painter_vao &return_value)
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, return_value.m_attribute_bo);
   fastuidraw_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, return_value.m_index_bo);
 
-  fastuidraw_glEnableVertexAttribArray(glsl::PainterShaderRegistrarGLSL::attribute0_slot);
-  v = opengl_trait_values<uvec4>(sizeof(PainterAttribute),
-                                 offsetof(PainterAttribute, m_attrib0));
-  VertexAttribIPointer(glsl::PainterShaderRegistrarGLSL::attribute0_slot, v);
-
-  fastuidraw_glEnableVertexAttribArray(glsl::PainterShaderRegistrarGLSL::attribute1_slot);
-  v = opengl_trait_values<uvec4>(sizeof(PainterAttribute),
-                                 offsetof(PainterAttribute, m_attrib1));
-  VertexAttribIPointer(glsl::PainterShaderRegistrarGLSL::attribute1_slot, v);
-
-  fastuidraw_glEnableVertexAttribArray(glsl::PainterShaderRegistrarGLSL::attribute2_slot);
-  v = opengl_trait_values<uvec4>(sizeof(PainterAttribute),
-                                 offsetof(PainterAttribute, m_attrib2));
-  VertexAttribIPointer(glsl::PainterShaderRegistrarGLSL::attribute2_slot, v);
+  specify_attributes(3);
 
   fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, return_value.m_header_bo);
   fastuidraw_glEnableVertexAttribArray(glsl::PainterShaderRegistrarGLSL::header_attrib_slot);
@@ -149,6 +140,49 @@ create_vao(painter_vao &return_value)
   fastuidraw_glBindVertexArray(0);
 }
 
+void
+fastuidraw::gl::detail::painter_vao_pool::
+specify_attributes(unsigned int number_slots)
+{
+  /* the fields of PainterAttribute are consecutive uvec4 values,
+   * so the layout of number_slots fields packed tightly is
+   * the same as PainterAttribute when number_slots is 3.
+   */
+  const vecN<GLuint, 3> slots(glsl::PainterShaderRegistrarGLSL::attribute0_slot,
+                              glsl::PainterShaderRegistrarGLSL::attribute1_slot,
+                              glsl::PainterShaderRegistrarGLSL::attribute2_slot);
+
+  FASTUIDRAWstatic_assert(sizeof(PainterAttribute) == 3 * sizeof(uvec4));
+  FASTUIDRAWassert(number_slots <= 3);
+  for (unsigned int i = 0; i < 3; ++i)
+    {
+      if (i < number_slots)
+        {
+          opengl_trait_value v;
+
+          v = opengl_trait_values<uvec4>(number_slots * sizeof(uvec4), i * sizeof(uvec4));
+          fastuidraw_glEnableVertexAttribArray(slots[i]);
+          VertexAttribIPointer(slots[i], v);
+        }
+      else
+        {
+          fastuidraw_glDisableVertexAttribArray(slots[i]);
+        }
+    }
+}
+
+void
+fastuidraw::gl::detail::painter_vao_pool::
+compact_vao_attributes(const painter_vao &V, unsigned int number_slots)
+{
+  FASTUIDRAWassert(V.m_vao != 0);
+  fastuidraw_glBindVertexArray(V.m_vao);
+  fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, V.m_attribute_bo);
+  specify_attributes(number_slots);
+  fastuidraw_glBindVertexArray(0);
+  fastuidraw_glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void
 fastuidraw::gl::detail::painter_vao_pool::
 release_vao_resources(const painter_vao &V)
@@ -51,6 +51,43 @@ public:
   unsigned int m_pool;
 };
 
+/* A staging_pool holds CPU buffers of a fixed size
+ * that are handed out and returned by swapping
+ * std::vector values.
+ */
+template<typename T>
+class staging_pool
+{
+public:
+  explicit
+  staging_pool(unsigned int sz):
+    m_size(sz)
+  {}
+
+  void
+  request(std::vector<T> &dst)
+  {
+    FASTUIDRAWassert(dst.empty());
+    if (!m_free.empty())
+      {
+        dst.swap(m_free.back());
+        m_free.pop_back();
+      }
+    dst.resize(m_size);
+  }
+
+  void
+  release(std::vector<T> &src)
+  {
+    m_free.push_back(std::vector<T>());
+    m_free.back().swap(src);
+  }
+
+private:
+  unsigned int m_size;
+  std::vector<std::vector<T> > m_free;
+};
+
 class painter_vao_pool:public reference_counted<painter_vao_pool>::non_concurrent
 {
 public:
@@ -104,6 +141,68 @@ public:
   void
   release_vao(painter_vao &V);
 
+  /*
+   * returns true if the attribute data is to be staged
+   * in CPU memory and uploaded with only the fields of
+   * PainterAttribute that are read, see
+   * PainterEngineGL::ConfigurationGL::compact_attributes().
+   */
+  bool
+  compact_attributes(void) const
+  {
+    return m_compact_attributes;
+  }
+
+  /*
+   * returns true if the index data is to be staged
+   * in CPU memory and uploaded as 16-bit indices when
+   * possible, see
+   * PainterEngineGL::ConfigurationGL::compact_indices().
+   */
+  bool
+  compact_indices(void) const
+  {
+    return m_compact_indices;
+  }
+
+  /*
+   * swap into dst a CPU buffer large enough to hold
+   * the attributes (or indices) of a single draw; the
+   * buffer is to be returned with release_staging().
+   */
+  void
+  request_staging(std::vector<PainterAttribute> &dst)
+  {
+    m_attribute_staging.request(dst);
+  }
+
+  void
+  release_staging(std::vector<PainterAttribute> &src)
+  {
+    m_attribute_staging.release(src);
+  }
+
+  void
+  request_staging(std::vector<PainterIndex> &dst)
+  {
+    m_index_staging.request(dst);
+  }
+
+  void
+  release_staging(std::vector<PainterIndex> &src)
+  {
+    m_index_staging.release(src);
+  }
+
+  /*
+   * change the VAO of V to source only the first
+   * number_slots fields of PainterAttribute from
+   * the attribute buffer where the fields are
+   * packed tightly.
+   */
+  void
+  compact_vao_attributes(const painter_vao &V, unsigned int number_slots);
+
 private:
   GLuint
   generate_tbo(GLuint src_buffer, GLenum fmt, unsigned int unit);
@@ -114,9 +213,13 @@ private:
   void
   create_vao(painter_vao &V);
 
+  void
+  specify_attributes(unsigned int number_slots);
+
   void
   release_vao_resources(const painter_vao &V);
 
+  bool m_compact_attributes, m_compact_indices;
   unsigned int m_attribute_buffer_size, m_header_buffer_size;
   unsigned int m_index_buffer_size;
   int m_blocks_per_data_buffer;
@@ -128,6 +231,8 @@ private:
   unsigned int m_current_pool;
   std::vector<std::vector<painter_vao> > m_free_vaos;
   std::vector<GLuint> m_ubos;
+  staging_pool<PainterAttribute> m_attribute_staging;
+  staging_pool<PainterIndex> m_index_staging;
 };
 
 }}}
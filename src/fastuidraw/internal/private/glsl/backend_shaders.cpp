@@ -628,7 +628,8 @@ reference_counted_ptr<PainterItemShader>
 ShaderSetCreator::
 create_glyph_item_shader(c_string vert_src,
                          c_string frag_src,
-                         const varying_list &varyings)
+                         const varying_list &varyings,
+                         unsigned int number_attribute_slots)
 {
   ShaderSource vert, frag;
   reference_counted_ptr<PainterItemShader> shader;
@@ -642,6 +643,7 @@ create_glyph_item_shader(c_string vert_src,
     .add_source(frag_src, ShaderSource::from_resource);
 
   shader = FASTUIDRAWnew PainterItemShaderGLSL(false, vert, frag, varyings);
+  shader->number_attribute_slots(number_attribute_slots);
   return shader;
 }
 
@@ -684,24 +686,24 @@ create_glyph_shader(void)
     .shader(coverage_glyph,
             create_glyph_item_shader("fastuidraw_painter_glyph_coverage_distance_field.vert.glsl.resource_string",
                                      "fastuidraw_painter_glyph_coverage.frag.glsl.resource_string",
-                                     coverage_varyings));
+                                     coverage_varyings, 2));
 
   return_value
     .shader(restricted_rays_glyph,
             create_glyph_item_shader("fastuidraw_painter_glyph_restricted_rays.vert.glsl.resource_string",
                                      "fastuidraw_painter_glyph_restricted_rays.frag.glsl.resource_string",
-                                     restricted_rays_varyings));
+                                     restricted_rays_varyings, 2));
   return_value
     .shader(distance_field_glyph,
             create_glyph_item_shader("fastuidraw_painter_glyph_coverage_distance_field.vert.glsl.resource_string",
                                      "fastuidraw_painter_glyph_distance_field.frag.glsl.resource_string",
-                                     distance_varyings));
+                                     distance_varyings, 2));
 
   return_value
     .shader(banded_rays_glyph,
             create_glyph_item_shader("fastuidraw_painter_glyph_banded_rays.vert.glsl.resource_string",
                                      "fastuidraw_painter_glyph_banded_rays.frag.glsl.resource_string",
-                                     banded_rays_varyings));
+                                     banded_rays_varyings, 3));
 
   return return_value;
 }
@@ -779,6 +781,9 @@ create_fill_shader(void)
                                                                 ShaderSource::from_resource),
                                                     varying_list());
 
+  /* the fill shader only reads the position from PainterAttribute::m_attrib0 */
+  item_shader->number_attribute_slots(1);
+
   /* the aa-fuzz shader via deferred coverage is not a part of the uber-fuzz shader */
   aa_fuzz_deferred_coverage =
     FASTUIDRAWnew PainterItemCoverageShaderGLSL(ShaderSource()
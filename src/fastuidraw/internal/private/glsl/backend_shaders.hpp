@@ -134,7 +134,8 @@ private:
   reference_counted_ptr<PainterItemShader>
   create_glyph_item_shader(c_string vert_src,
                            c_string frag_src,
-                           const varying_list &varyings);
+                           const varying_list &varyings,
+                           unsigned int number_attribute_slots);
 
   PainterGlyphShader
   create_glyph_shader(void);
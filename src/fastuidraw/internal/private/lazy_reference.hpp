@@ -0,0 +1,78 @@
+/*!
+ * \file lazy_reference.hpp
+ * \brief file lazy_reference.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A LazyReference holds a reference to an object that is
+     * created the first time it is fetched. If several threads
+     * fetch it at the same time, only one creates the object and
+     * the others wait for it; once the object is created, fetching
+     * it does not lock.
+     */
+    template<typename T>
+    class LazyReference:fastuidraw::noncopyable
+    {
+    public:
+      LazyReference(void):
+        m_ready(false)
+      {}
+
+      /* F is called with no arguments and returns
+       * a reference_counted_ptr<const T>.
+       */
+      template<typename F>
+      const T&
+      get(const F &create)
+      {
+        if (!m_ready.load(std::memory_order_acquire))
+          {
+            std::lock_guard<std::mutex> m(m_mutex);
+            if (!m_ready.load(std::memory_order_relaxed))
+              {
+                m_value = create();
+                FASTUIDRAWassert(m_value);
+                m_ready.store(true, std::memory_order_release);
+              }
+          }
+        return *m_value;
+      }
+
+      /* must not be called while another thread is in get() */
+      void
+      clear(void)
+      {
+        m_ready.store(false, std::memory_order_relaxed);
+        m_value.clear();
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::atomic<bool> m_ready;
+      reference_counted_ptr<const T> m_value;
+    };
+  }
+}
@@ -0,0 +1,241 @@
+/*!
+ * \file attribute_index_src_from_array.hpp
+ * \brief file attribute_index_src_from_array.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_writer.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* An AttributeIndexSrcFromArray realizes the interface of
+     * PainterAttributeWriter from arrays of attribute and index
+     * chunks; it is used by PainterPacker to implement the
+     * draw_generic() methods that take arrays of chunks.
+     */
+    class AttributeIndexSrcFromArray:public PainterAttributeWriter
+    {
+    public:
+      AttributeIndexSrcFromArray(c_array<const c_array<const PainterAttribute> > attrib_chunks,
+                                 c_array<const c_array<const PainterIndex> > index_chunks,
+                                 c_array<const int> index_adjusts,
+                                 c_array<const unsigned int> attrib_chunk_selector):
+        m_attrib_chunks(attrib_chunks),
+        m_index_chunks(index_chunks),
+        m_index_adjusts(index_adjusts),
+        m_attrib_chunk_selector(attrib_chunk_selector)
+      {
+        FASTUIDRAWassert((m_attrib_chunk_selector.empty() && m_attrib_chunks.size() == m_index_chunks.size())
+                         || (m_attrib_chunk_selector.size() == m_index_chunks.size()) );
+        FASTUIDRAWassert(m_index_adjusts.size() == m_index_chunks.size() || m_index_adjusts.empty());
+      }
+
+      virtual
+      bool
+      requires_coverage_buffer(void) const override
+      {
+        return false;
+      }
+
+      virtual
+      unsigned int
+      state_length(void) const override
+      {
+        /* [0] stores what is the current index chunk,
+         * [I + 1] store where the I'th attribute chunk was written
+         */
+        return 1 + number_attribute_chunks();
+      }
+
+      virtual
+      bool
+      initialize_state(WriteState *state) const override
+      {
+        state->m_state[0] = 0;
+        state->m_z_range.m_begin = 0;
+        state->m_z_range.m_end = 0;
+        if (number_index_chunks() > 0 && number_attribute_chunks() > 0)
+          {
+            on_new_store(state);
+            return true;
+          }
+        else
+          {
+            return false;
+          }
+      }
+
+      virtual
+      void
+      on_new_store(WriteState *state) const override
+      {
+        unsigned int index_chunk(state->m_state[0]);
+        unsigned int attribute_chunk(attribute_chunk_selection(index_chunk));
+
+        for (unsigned int i = 0; i < m_attrib_chunks.size(); ++i)
+          {
+            state->m_state[i + 1] = NOT_LOADED;
+          }
+        state->m_min_attributes_for_next = number_attributes(attribute_chunk);
+        state->m_min_indices_for_next = number_indices(index_chunk);
+      }
+
+      virtual
+      bool
+      write_data(c_array<PainterAttribute> dst_attribs,
+                 c_array<PainterIndex> dst_indices,
+                 unsigned int attrib_location,
+                 WriteState *state,
+                 unsigned int *num_attribs_written,
+                 unsigned int *num_indices_written) const override
+      {
+        unsigned int index_chunk(state->m_state[0]);
+        unsigned int attribute_chunk(attribute_chunk_selection(index_chunk));
+
+        if (state->m_state[attribute_chunk + 1] == NOT_LOADED)
+          {
+            /* indicate the chunk is not yet loaded, so load
+             * it into dst_attribs.
+             */
+            write_attributes(dst_attribs, attribute_chunk);
+            state->m_state[attribute_chunk + 1] = attrib_location;
+            *num_attribs_written = number_attributes(attribute_chunk);
+          }
+        else
+          {
+            attrib_location = state->m_state[attribute_chunk + 1];
+            *num_attribs_written = 0;
+          }
+
+        write_indices(dst_indices, attrib_location, index_chunk);
+        *num_indices_written = number_indices(index_chunk);
+
+        ++(state->m_state[0]);
+        index_chunk = state->m_state[0];
+        if (index_chunk < number_index_chunks())
+          {
+            attribute_chunk = attribute_chunk_selection(index_chunk);
+            state->m_min_indices_for_next = number_indices(index_chunk);
+            state->m_min_attributes_for_next = (state->m_state[attribute_chunk + 1] == NOT_LOADED) ?
+              number_attributes(attribute_chunk) :
+              0u;
+            return true;
+          }
+        else
+          {
+            state->m_min_indices_for_next = 0;
+            state->m_min_attributes_for_next = 0;
+            return false;
+          }
+      }
+
+    private:
+      enum
+        {
+          NOT_LOADED = ~0u
+        };
+
+      unsigned int
+      number_attribute_chunks(void) const
+      {
+        return m_attrib_chunks.size();
+      }
+
+      unsigned int
+      number_attributes(unsigned int attribute_chunk) const
+      {
+        FASTUIDRAWassert(attribute_chunk < m_attrib_chunks.size());
+        return m_attrib_chunks[attribute_chunk].size();
+      }
+
+      unsigned int
+      number_index_chunks(void) const
+      {
+        return m_index_chunks.size();
+      }
+
+      unsigned int
+      number_indices(unsigned int index_chunk) const
+      {
+        FASTUIDRAWassert(index_chunk < m_index_chunks.size());
+        return m_index_chunks[index_chunk].size();
+      }
+
+      unsigned int
+      attribute_chunk_selection(unsigned int index_chunk) const
+      {
+        FASTUIDRAWassert(m_attrib_chunk_selector.empty() || index_chunk < m_attrib_chunk_selector.size());
+        return m_attrib_chunk_selector.empty() ?
+          index_chunk :
+          m_attrib_chunk_selector[index_chunk];
+      }
+
+      void
+      write_indices(c_array<PainterIndex> dst,
+                    unsigned int index_offset_value,
+                    unsigned int index_chunk) const
+      {
+        c_array<const PainterIndex> src;
+
+        FASTUIDRAWassert(index_chunk < m_index_chunks.size());
+        src = m_index_chunks[index_chunk];
+
+        FASTUIDRAWassert(dst.size() >= src.size());
+        for(unsigned int i = 0; i < src.size(); ++i)
+          {
+            int adjust;
+
+            adjust = (m_index_adjusts.empty()) ? 0 : m_index_adjusts[index_chunk];
+            FASTUIDRAWassert(int(src[i]) + adjust >= 0);
+            dst[i] = int(src[i] + index_offset_value) + adjust;
+          }
+      }
+
+      void
+      write_attributes(c_array<PainterAttribute> dst,
+                       unsigned int attribute_chunk) const
+      {
+        c_array<const PainterAttribute> src;
+
+        FASTUIDRAWassert(attribute_chunk < m_attrib_chunks.size());
+        src = m_attrib_chunks[attribute_chunk];
+
+        FASTUIDRAWassert(dst.size() >= src.size());
+        /* use void pointers to silence a compiler warning on
+         * using memcpy PainterAttributeData; some compilers
+         * will warn on using memcpy with pointer to a type
+         * that is not POD. That PainterAttributeData is not
+         * a POD comes from that vecN() has non-trivial ctor's
+         * (which for the generic_type are the same as memcpy
+         * though ).
+         */
+        void *dst_ptr(dst.c_ptr());
+        std::memcpy(dst_ptr, src.c_ptr(), sizeof(PainterAttribute) * src.size());
+      }
+
+      c_array<const c_array<const PainterAttribute> > m_attrib_chunks;
+      c_array<const c_array<const PainterIndex> > m_index_chunks;
+      c_array<const int> m_index_adjusts;
+      c_array<const unsigned int> m_attrib_chunk_selector;
+    };
+  }
+}
@@ -0,0 +1,318 @@
+/*!
+ * \file painter_command_list_private.hpp
+ * \brief file painter_command_list_private.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/rect.hpp>
+#include <fastuidraw/util/blend_mode.hpp>
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <fastuidraw/painter/attribute_data/painter_attribute_writer.hpp>
+#include <fastuidraw/painter/backend/painter_draw_break_action.hpp>
+#include <fastuidraw/painter/shader/painter_item_shader.hpp>
+#include <fastuidraw/painter/shader/painter_blend_shader.hpp>
+#include <private/painter_backend/painter_packer_data.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A PainterCommandListPrivate stores the commands recorded
+     * by a Painter. The attribute and index data of a draw are
+     * realized by recording what a PainterAttributeWriter writes
+     * against a virtual store whose size matches that of the
+     * PainterDraw objects of the recording Painter. The data is
+     * then replayed through PainterPacker via the class Writer.
+     */
+    class PainterCommandListPrivate
+    {
+    public:
+      enum command_type_t
+        {
+          draw_command,
+          coverage_draw_command,
+          action_command,
+          begin_coverage_buffer_command,
+          end_coverage_buffer_command,
+          add_occluder_command,
+          remove_occluder_command,
+          finalize_occluder_command,
+        };
+
+      /* A Piece is what is written by a single call to
+       * PainterAttributeWriter::write_data(). The indices
+       * of a Piece reference the attributes of the range
+       * [m_group_begin, m_attribute_end) and are stored
+       * relative to m_group_begin. A group is the data
+       * written between calls to on_new_store().
+       */
+      class Piece
+      {
+      public:
+        unsigned int m_group_begin, m_attribute_end;
+        range_type<unsigned int> m_indices;
+        range_type<int> m_z_range;
+        PainterItemShader *m_item_shader_override;
+        PainterItemCoverageShader *m_item_coverage_shader_override;
+      };
+
+      /* Occlusion information of a draw in the normalized
+       * device coordinates of the recording, used to skip
+       * draws hidden by opaque draws that follow them when
+       * the list is drawn.
+       */
+      class Occlusion
+      {
+      public:
+        Occlusion(void):
+          m_opaque(false)
+        {}
+
+        /* contains everything the draw affects */
+        Rect m_bounds;
+
+        /* if m_opaque is true, the draw covers m_opaque_rect
+         * with opaque content.
+         */
+        bool m_opaque;
+        Rect m_opaque_rect;
+      };
+
+      class Command
+      {
+      public:
+        explicit
+        Command(enum command_type_t tp):
+          m_type(tp),
+          m_shader(nullptr),
+          m_coverage_shader(nullptr),
+          m_blend_shader(nullptr),
+          m_requires_coverage_buffer(false),
+          m_pieces(0, 0),
+          m_data(0),
+          m_z(0),
+          m_z_max(0),
+          m_id(0),
+          m_non_empty(false)
+        {}
+
+        enum command_type_t m_type;
+
+        /* for draw_command and coverage_draw_command */
+        PainterItemShader *m_shader;
+        PainterItemCoverageShader *m_coverage_shader;
+        PainterBlendShader *m_blend_shader;
+        BlendMode m_blend_mode;
+        bool m_requires_coverage_buffer;
+        range_type<unsigned int> m_pieces;
+        unsigned int m_data;
+
+        /* z-value of draw or of occluder finalize */
+        int m_z;
+
+        /* for draw_command, the largest depth value of the
+         * draw and where it is and if it is opaque.
+         */
+        int m_z_max;
+        Occlusion m_occlusion;
+
+        /* occluder ID */
+        unsigned int m_id;
+
+        /* for begin_coverage_buffer_command */
+        Rect m_rect;
+        bool m_non_empty;
+
+        /* for action_command */
+        reference_counted_ptr<const PainterDrawBreakAction> m_action;
+      };
+
+      /* Realizes the PainterAttributeWriter interface for a
+       * range of Piece values to feed PainterPacker.
+       */
+      class Writer:public PainterAttributeWriter
+      {
+      public:
+        Writer(const PainterCommandListPrivate &list,
+               range_type<unsigned int> pieces):
+          m_list(list),
+          m_pieces(pieces)
+        {}
+
+        virtual
+        bool
+        requires_coverage_buffer(void) const override
+        {
+          return false;
+        }
+
+        virtual
+        unsigned int
+        state_length(void) const override
+        {
+          /* [0] the current piece
+           * [1] where the group of the piece starts in the store
+           * [2] how many attributes of the group are in the store
+           */
+          return 3;
+        }
+
+        virtual
+        bool
+        initialize_state(WriteState *state) const override;
+
+        virtual
+        void
+        on_new_store(WriteState *state) const override;
+
+        virtual
+        bool
+        write_data(c_array<PainterAttribute> dst_attribs,
+                   c_array<PainterIndex> dst_indices,
+                   unsigned int attrib_location,
+                   WriteState *state,
+                   unsigned int *num_attribs_written,
+                   unsigned int *num_indices_written) const override;
+
+      private:
+        enum
+          {
+            NOT_LOADED = ~0u
+          };
+
+        void
+        set_state_for_current_piece(WriteState *state) const;
+
+        const PainterCommandListPrivate &m_list;
+        range_type<unsigned int> m_pieces;
+      };
+
+      /* A DrawingScope marks a PainterCommandListPrivate as being
+       * drawn by a Painter::draw_command_list() for its lifetime;
+       * the Painter that recorded it may be recording to another
+       * list on another thread at the same time, but must not
+       * record to this one until the drawing is done.
+       */
+      class DrawingScope:fastuidraw::noncopyable
+      {
+      public:
+        explicit
+        DrawingScope(const PainterCommandListPrivate &list):
+          m_list(list)
+        {
+          m_list.m_drawing.fetch_add(1, std::memory_order_acquire);
+        }
+
+        ~DrawingScope()
+        {
+          m_list.m_drawing.fetch_sub(1, std::memory_order_release);
+        }
+
+      private:
+        const PainterCommandListPrivate &m_list;
+      };
+
+      PainterCommandListPrivate(void):
+        m_recording(false),
+        m_drawing(0),
+        m_attribs_per_mapping(0),
+        m_indices_per_mapping(0),
+        m_z_begin(0),
+        m_z_end(0),
+        m_number_occluders(0)
+      {}
+
+      void
+      clear(void);
+
+      void
+      begin_recording(unsigned int attribs_per_mapping,
+                      unsigned int indices_per_mapping,
+                      int z);
+
+      void
+      end_recording(int z);
+
+      /* returns the max of PainterAttributeWriter::WriteState::m_z_range.m_end */
+      int
+      record_draw(PainterItemShader *shader,
+                  PainterBlendShader *blend_shader, BlendMode blend_mode,
+                  bool requires_coverage_buffer,
+                  const PainterPackerData &data,
+                  const Occlusion &occlusion,
+                  const PainterAttributeWriter &src, int z);
+
+      void
+      record_coverage_draw(PainterItemCoverageShader *shader,
+                           const PainterPackerData &data,
+                           const PainterAttributeWriter &src);
+
+      void
+      record_action(const reference_counted_ptr<const PainterDrawBreakAction> &action);
+
+      void
+      record_begin_coverage_buffer(const Rect &normalized_rect, bool non_empty);
+
+      void
+      record_end_coverage_buffer(void);
+
+      unsigned int
+      record_add_occluder(void);
+
+      void
+      record_remove_occluder(unsigned int id);
+
+      void
+      record_finalize_occluder(unsigned int id, int z);
+
+      bool
+      drawing(void) const
+      {
+        return m_drawing.load(std::memory_order_acquire) != 0;
+      }
+
+      bool m_recording;
+      mutable std::atomic<int> m_drawing;
+      unsigned int m_attribs_per_mapping, m_indices_per_mapping;
+      int m_z_begin, m_z_end;
+      unsigned int m_number_occluders;
+
+      std::vector<Command> m_commands;
+      std::vector<PainterPackerData> m_data;
+      std::vector<Piece> m_pieces;
+      std::vector<PainterAttribute> m_attributes;
+      std::vector<PainterIndex> m_indices;
+
+    private:
+      template<typename ShaderType>
+      range_type<unsigned int>
+      record_pieces(ShaderType *shader,
+                    const PainterAttributeWriter &src,
+                    int *max_z_end);
+
+      unsigned int
+      add_data(const PainterPackerData &data);
+
+      std::vector<unsigned int> m_state_values;
+      std::vector<PainterAttribute> m_scratch_attributes;
+      std::vector<PainterIndex> m_scratch_indices;
+    };
+  }
+}
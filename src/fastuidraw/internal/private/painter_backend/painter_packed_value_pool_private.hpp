@@ -19,6 +19,8 @@
 #pragma once
 
 #include <vector>
+#include <atomic>
+#include <mutex>
 #include <fastuidraw/util/reference_counted.hpp>
 #include <fastuidraw/util/vecN.hpp>
 #include <fastuidraw/painter/backend/painter_surface.hpp>
@@ -170,9 +172,29 @@ namespace fastuidraw
       };
     }
 
-    class PackedValuePoolBase:public reference_counted<PackedValuePoolBase>::non_concurrent
+    class PackedValuePoolBase:public reference_counted<PackedValuePoolBase>::concurrent
     {
     public:
+      /* Hash of packed data; PainterPacker uses the hash to find
+       * if the same values are already packed onto the store of
+       * the current PainterDraw.
+       */
+      static
+      uint32_t
+      compute_hash(c_array<const uvec4> data)
+      {
+        uint32_t h(2166136261u);
+        for (const uvec4 &v : data)
+          {
+            for (unsigned int i = 0; i < 4; ++i)
+              {
+                h = (h ^ v[i]) * 16777619u;
+                h ^= (h >> 15u);
+              }
+          }
+        return h;
+      }
+
       /* PainterPackedValueBase holds a pointer to an Element, thus
        * we cannot have a vector because resizing the vector would
        * move the Element to another location in memory. Instead
@@ -228,35 +250,54 @@ namespace fastuidraw
         {
           FASTUIDRAWassert(m_pool);
           FASTUIDRAWassert(m_pool_slot.valid());
-          FASTUIDRAWassert(m_ref_count >= 0);
-          ++m_ref_count;
+          FASTUIDRAWassert(m_ref_count.load(std::memory_order_relaxed) >= 0);
+          m_ref_count.fetch_add(1, std::memory_order_relaxed);
         }
 
+        /* The reference count is atomic so that the values of a
+         * PainterCommandList can be referenced by the Painter drawing
+         * it while the Painter that recorded it records to another
+         * list on a different thread. Thus the last reference can be
+         * released on a thread other than the one allocating from the
+         * pool, which is why the free slots are behind a mutex.
+         */
         static
         void
         release(ElementBase *p)
         {
           FASTUIDRAWassert(p->m_pool);
           FASTUIDRAWassert(p->m_pool_slot.valid());
-          FASTUIDRAWassert(p->m_ref_count >= 0);
+          FASTUIDRAWassert(p->m_ref_count.load(std::memory_order_relaxed) >= 0);
 
-          --p->m_ref_count;
-          if (p->m_ref_count == 0)
+          if (p->m_ref_count.fetch_sub(1, std::memory_order_release) == 1)
             {
-              p->m_pool->m_free_slots.push_back(p->m_pool_slot);
-              /* Reseting the reference to the pool might trigger its
-               * deconstruction which then would trigger p's dtor as
-               * well.
+              reference_counted_ptr<PackedValuePoolBase> pool;
+              Slot slot(p->m_pool_slot);
+
+              std::atomic_thread_fence(std::memory_order_acquire);
+
+              /* Once the slot is on the free list, the thread of the
+               * pool may reuse p, so p must not be touched after it.
                */
-              p->m_pool = nullptr;
+              pool.swap(p->m_pool);
               p = nullptr;
+              {
+                std::lock_guard<std::mutex> M(pool->m_free_slots_mutex);
+                pool->m_free_slots.push_back(slot);
+              }
+
+              /* Reseting the reference to the pool might trigger its
+               * deconstruction which then would trigger the dtor of
+               * the element as well.
+               */
+              pool = nullptr;
             }
         }
 
         int
         ref_count(void) const
         {
-          return m_ref_count;
+          return m_ref_count.load(std::memory_order_relaxed);
         }
 
         /* To what PainterPacker and where in data store buffer
@@ -269,6 +310,9 @@ namespace fastuidraw
         std::vector<reference_counted_ptr<const Image> > m_bind_images;
         vecN<unsigned int, PainterSurface::number_buffer_types> m_draw_command_id, m_offset;
 
+        /* value of compute_hash() on m_data */
+        uint32_t m_hash;
+
       protected:
         void
         initialize_common(Slot slot, PackedValuePoolBase *p)
@@ -284,15 +328,17 @@ namespace fastuidraw
       private:
         reference_counted_ptr<PackedValuePoolBase> m_pool;
         Slot m_pool_slot;
-        int m_ref_count;
+        std::atomic<int> m_ref_count;
       };
 
     protected:
+      std::mutex m_free_slots_mutex;
       std::vector<Slot> m_free_slots;
     };
 
     /* The intention is that a fixed Pool is for a fixed Painter, which is
-     * not thread safe, so PackedValuePool is not thread safe either.
+     * not thread safe, so allocating from a PackedValuePool is not thread
+     * safe either; only returning elements to the free slots is.
      */
     template<typename T>
     class PackedValuePool:public PackedValuePoolBase
@@ -309,6 +355,7 @@ namespace fastuidraw
           this->initialize_common(slot, p);
           m_data.resize(st.data_size());
           st.pack_data(make_c_array(m_data));
+          m_hash = compute_hash(make_c_array(m_data));
           ResourceType::fetch_resources(st, &m_resources);
           BindImageType::fetch_bind_images(st, &m_bind_images);
           m_copy.copy_value(st);
@@ -437,14 +484,17 @@ namespace fastuidraw
         Element *return_value(nullptr);
         PackedValuePoolBase::Slot slot;
 
-        if (m_free_slots.empty())
-          {
-            create_bucket();
-          }
+        {
+          std::lock_guard<std::mutex> M(this->m_free_slots_mutex);
+          if (this->m_free_slots.empty())
+            {
+              create_bucket();
+            }
 
-        FASTUIDRAWassert(!this->m_free_slots.empty());
-        slot = this->m_free_slots.back();
-        this->m_free_slots.pop_back();
+          FASTUIDRAWassert(!this->m_free_slots.empty());
+          slot = this->m_free_slots.back();
+          this->m_free_slots.pop_back();
+        }
 
         Bucket &bucket(*m_data[slot.m_bucket]);
 
@@ -20,9 +20,11 @@
 #include <vector>
 #include <list>
 #include <cstring>
+#include <limits>
 
 #include <private/painter_backend/painter_packer.hpp>
 #include <private/painter_backend/painter_packed_value_pool_private.hpp>
+#include <private/painter_backend/attribute_index_src_from_array.hpp>
 #include <private/util_private.hpp>
 
 namespace
@@ -67,6 +69,67 @@ namespace
     }
   };
 
+  /* Returns true if changing from the shader group prev
+   * to the shader group current requires a draw break
+   */
+  bool
+  shader_group_changed(enum fastuidraw::PainterSurface::render_type_t render_type,
+                       const PainterShaderGroupValues &prev,
+                       const PainterShaderGroupValues &current)
+  {
+    return current.m_item_group != prev.m_item_group
+      || current.m_blend_mode != prev.m_blend_mode
+      || (render_type == fastuidraw::PainterSurface::color_buffer_type &&
+          (current.m_blend_group != prev.m_blend_group
+           || current.m_blend_shader_type != prev.m_blend_shader_type
+           || current.m_brush_group != prev.m_brush_group));
+  }
+
+  bool
+  blend_func_reads_dst(enum fastuidraw::BlendMode::func_t f)
+  {
+    return f != fastuidraw::BlendMode::ZERO
+      && f != fastuidraw::BlendMode::ONE
+      && f != fastuidraw::BlendMode::SRC_COLOR
+      && f != fastuidraw::BlendMode::ONE_MINUS_SRC_COLOR
+      && f != fastuidraw::BlendMode::SRC_ALPHA
+      && f != fastuidraw::BlendMode::ONE_MINUS_SRC_ALPHA;
+  }
+
+  /* Returns true if draws of the named shader group give the
+   * same result regardless of the order in which they are drawn
+   * relative to other such draws. For color buffers this is the
+   * case when the blending does not read the destination because
+   * the depth test then realizes the order. Deferred coverage
+   * buffers have no depth buffer, but all of their draws blend
+   * with MAX which is commutative.
+   */
+  bool
+  shader_group_commutable(enum fastuidraw::PainterSurface::render_type_t render_type,
+                          const PainterShaderGroupValues &group)
+  {
+    using namespace fastuidraw;
+
+    if (render_type != PainterSurface::color_buffer_type)
+      {
+        return true;
+      }
+
+    if (group.m_blend_shader_type == PainterBlendShader::framebuffer_fetch)
+      {
+        return false;
+      }
+
+    const BlendMode &md(group.m_blend_mode);
+    return !md.blending_on()
+      || (md.equation_rgb() == BlendMode::ADD
+          && md.equation_alpha() == BlendMode::ADD
+          && md.func_dst_rgb() == BlendMode::ZERO
+          && md.func_dst_alpha() == BlendMode::ZERO
+          && !blend_func_reads_dst(md.func_src_rgb())
+          && !blend_func_reads_dst(md.func_src_alpha()));
+  }
+
   template<typename T>
   T*
   get_shader(T*, const fastuidraw::PainterAttributeWriter::WriteState&)
@@ -91,200 +154,20 @@ namespace
     return (state.m_item_coverage_shader_override) ? state.m_item_coverage_shader_override : shader;
   }
 
-  class AttributeIndexSrcFromArray
+  unsigned int
+  number_attribute_slots(const fastuidraw::PainterItemShader *shader)
   {
-  public:
-    AttributeIndexSrcFromArray(fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterAttribute> > attrib_chunks,
-                               fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterIndex> > index_chunks,
-                               fastuidraw::c_array<const int> index_adjusts,
-                               fastuidraw::c_array<const unsigned int> attrib_chunk_selector):
-      m_attrib_chunks(attrib_chunks),
-      m_index_chunks(index_chunks),
-      m_index_adjusts(index_adjusts),
-      m_attrib_chunk_selector(attrib_chunk_selector)
-    {
-      FASTUIDRAWassert((m_attrib_chunk_selector.empty() && m_attrib_chunks.size() == m_index_chunks.size())
-                       || (m_attrib_chunk_selector.size() == m_index_chunks.size()) );
-      FASTUIDRAWassert(m_index_adjusts.size() == m_index_chunks.size() || m_index_adjusts.empty());
-    }
-
-    unsigned int
-    state_length(void) const
-    {
-      /* [0] stores what is the current index chunk,
-       * [I + 1] store where the I'th attribute chunk was written
-       */
-      return 1 + number_attribute_chunks();
-    }
-
-    bool
-    initialize_state(fastuidraw::PainterAttributeWriter::WriteState *state) const
-    {
-      state->m_state[0] = 0;
-      state->m_z_range.m_begin = 0;
-      state->m_z_range.m_end = 0;
-      if (number_index_chunks() > 0 && number_attribute_chunks() > 0)
-        {
-          on_new_store(state);
-          return true;
-        }
-      else
-        {
-          return false;
-        }
-    }
-
-    void
-    on_new_store(fastuidraw::PainterAttributeWriter::WriteState *state) const
-    {
-      unsigned int index_chunk(state->m_state[0]);
-      unsigned int attribute_chunk(attribute_chunk_selection(index_chunk));
-
-      for (unsigned int i = 0; i < m_attrib_chunks.size(); ++i)
-        {
-          state->m_state[i + 1] = NOT_LOADED;
-        }
-      state->m_min_attributes_for_next = number_attributes(attribute_chunk);
-      state->m_min_indices_for_next = number_indices(index_chunk);
-    }
-
-    bool
-    write_data(fastuidraw::c_array<fastuidraw::PainterAttribute> dst_attribs,
-               fastuidraw::c_array<fastuidraw::PainterIndex> dst_indices,
-               unsigned int attrib_location,
-               fastuidraw::PainterAttributeWriter::WriteState *state,
-               unsigned int *num_attribs_written,
-               unsigned int *num_indices_written) const
-    {
-      unsigned int index_chunk(state->m_state[0]);
-      unsigned int attribute_chunk(attribute_chunk_selection(index_chunk));
-
-      if (state->m_state[attribute_chunk + 1] == NOT_LOADED)
-        {
-          /* indicate the chunk is not yet loaded, so load
-           * it into dst_attribs.
-           */
-          write_attributes(dst_attribs, attribute_chunk);
-          state->m_state[attribute_chunk + 1] = attrib_location;
-          *num_attribs_written = number_attributes(attribute_chunk);
-        }
-      else
-        {
-          attrib_location = state->m_state[attribute_chunk + 1];
-          *num_attribs_written = 0;
-        }
-
-      write_indices(dst_indices, attrib_location, index_chunk);
-      *num_indices_written = number_indices(index_chunk);
-
-      ++(state->m_state[0]);
-      index_chunk = state->m_state[0];
-      if (index_chunk < number_index_chunks())
-        {
-          attribute_chunk = attribute_chunk_selection(index_chunk);
-          state->m_min_indices_for_next = number_indices(index_chunk);
-          state->m_min_attributes_for_next = (state->m_state[attribute_chunk + 1] == NOT_LOADED) ?
-            number_attributes(attribute_chunk) :
-            0u;
-          return true;
-        }
-      else
-        {
-          state->m_min_indices_for_next = 0;
-          state->m_min_attributes_for_next = 0;
-          return false;
-        }
-    }
-
-  private:
-    enum
-      {
-        NOT_LOADED = ~0u
-      };
-
-    unsigned int
-    number_attribute_chunks(void) const
-    {
-      return m_attrib_chunks.size();
-    }
-
-    unsigned int
-    number_attributes(unsigned int attribute_chunk) const
-    {
-      FASTUIDRAWassert(attribute_chunk < m_attrib_chunks.size());
-      return m_attrib_chunks[attribute_chunk].size();
-    }
-
-    unsigned int
-    number_index_chunks(void) const
-    {
-      return m_index_chunks.size();
-    }
-
-    unsigned int
-    number_indices(unsigned int index_chunk) const
-    {
-      FASTUIDRAWassert(index_chunk < m_index_chunks.size());
-      return m_index_chunks[index_chunk].size();
-    }
-
-    unsigned int
-    attribute_chunk_selection(unsigned int index_chunk) const
-    {
-      FASTUIDRAWassert(m_attrib_chunk_selector.empty() || index_chunk < m_attrib_chunk_selector.size());
-      return m_attrib_chunk_selector.empty() ?
-        index_chunk :
-        m_attrib_chunk_selector[index_chunk];
-    }
-
-    void
-    write_indices(fastuidraw::c_array<fastuidraw::PainterIndex> dst,
-                  unsigned int index_offset_value,
-                  unsigned int index_chunk) const
-    {
-      fastuidraw::c_array<const fastuidraw::PainterIndex> src;
-
-      FASTUIDRAWassert(index_chunk < m_index_chunks.size());
-      src = m_index_chunks[index_chunk];
-
-      FASTUIDRAWassert(dst.size() >= src.size());
-      for(unsigned int i = 0; i < src.size(); ++i)
-        {
-          int adjust;
-
-          adjust = (m_index_adjusts.empty()) ? 0 : m_index_adjusts[index_chunk];
-          FASTUIDRAWassert(int(src[i]) + adjust >= 0);
-          dst[i] = int(src[i] + index_offset_value) + adjust;
-        }
-    }
-
-    void
-    write_attributes(fastuidraw::c_array<fastuidraw::PainterAttribute> dst,
-                     unsigned int attribute_chunk) const
-    {
-      fastuidraw::c_array<const fastuidraw::PainterAttribute> src;
-
-      FASTUIDRAWassert(attribute_chunk < m_attrib_chunks.size());
-      src = m_attrib_chunks[attribute_chunk];
-
-      FASTUIDRAWassert(dst.size() >= src.size());
-      /* use void pointers to silence a compiler warning on
-       * using memcpy PainterAttributeData; some compilers
-       * will warn on using memcpy with pointer to a type
-       * that is not POD. That PainterAttributeData is not
-       * a POD comes from that vecN() has non-trivial ctor's
-       * (which for the generic_type are the same as memcpy
-       * though ).
-       */
-      void *dst_ptr(dst.c_ptr());
-      std::memcpy(dst_ptr, src.c_ptr(), sizeof(fastuidraw::PainterAttribute) * src.size());
-    }
+    return shader->number_attribute_slots();
+  }
 
-    fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterAttribute> > m_attrib_chunks;
-    fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterIndex> > m_index_chunks;
-    fastuidraw::c_array<const int> m_index_adjusts;
-    fastuidraw::c_array<const unsigned int> m_attrib_chunk_selector;
-  };
+  unsigned int
+  number_attribute_slots(const fastuidraw::PainterItemCoverageShader*)
+  {
+    /* coverage shaders do not declare what attribute
+     * fields they read, so assume they read all of them.
+     */
+    return 3;
+  }
 }
 
 class fastuidraw::PainterPacker::per_draw_command
@@ -346,8 +229,13 @@ public:
               int z,
               const painter_state_location &loc,
               const std::list<reference_counted_ptr<PainterPacker::DataCallBack> > &call_backs,
+              PainterPacker *p,
               unsigned int *header_location);
 
+  void
+  emit_staged_indices(enum PainterSurface::render_type_t render_type,
+                      PainterPacker *p);
+
   bool
   draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action)
   {
@@ -373,7 +261,10 @@ private:
 
   template<typename T>
   void
-  pack_state_data_from_value(const T &st, uint32_t &location);
+  pack_state_data_from_value(PainterPacker *p, const T &st, uint32_t &location);
+
+  uint32_t
+  pack_state_data_from_packed(PainterPacker *p, c_array<const uvec4> src, uint32_t hash);
 
   template<typename T>
   void
@@ -387,6 +278,32 @@ private:
   PainterShaderRegistrar &m_registrar;
 };
 
+class fastuidraw::PainterPacker::shader_group_segment
+{
+public:
+  shader_group_segment(void):
+    m_index_begin(0),
+    m_commutable(false),
+    m_z_min(std::numeric_limits<int>::max()),
+    m_z_max(std::numeric_limits<int>::min())
+  {}
+
+  /* add the depth values [z_begin, z_end) of a header */
+  void
+  add_z_range(int z_begin, int z_end)
+  {
+    m_z_min = t_min(m_z_min, z_begin);
+    m_z_max = t_max(m_z_max, t_max(z_begin, z_end - 1));
+  }
+
+  PainterShaderGroupPrivate m_group;
+  unsigned int m_index_begin;
+  bool m_commutable;
+
+  /* range of depth values of the headers of the segment */
+  int m_z_min, m_z_max;
+};
+
 //////////////////////////////////////////
 // fastuidraw::PainterPacker::per_draw_command methods
 fastuidraw::PainterPacker::per_draw_command::
@@ -418,15 +335,36 @@ allocate_store(unsigned int num_elements)
 template<typename T>
 void
 fastuidraw::PainterPacker::per_draw_command::
-pack_state_data_from_value(const T &st, uint32_t &location)
+pack_state_data_from_value(PainterPacker *p, const T &st, uint32_t &location)
 {
+  std::vector<uvec4> &packed(p->m_work_room.m_packed_state);
+
+  packed.resize(st.data_size());
+  st.pack_data(make_c_array(packed));
+  location = pack_state_data_from_packed(p, make_c_array(packed),
+                                         detail::PackedValuePoolBase::compute_hash(make_c_array(packed)));
+}
+
+uint32_t
+fastuidraw::PainterPacker::per_draw_command::
+pack_state_data_from_packed(PainterPacker *p, c_array<const uvec4> src, uint32_t hash)
+{
+  uint32_t location;
   c_array<uvec4> dst;
-  unsigned int data_sz;
+
+  if (p->m_state_cache.find(hash, src, &location))
+    {
+      ++p->m_stats[PainterEnums::num_state_dedup_hits];
+      return location;
+    }
 
   location = store_written();
-  data_sz = st.data_size();
-  dst = allocate_store(data_sz);
-  st.pack_data(dst);
+  dst = allocate_store(src.size());
+  std::copy(src.begin(), src.end(), dst.begin());
+  p->m_state_cache.add(hash, src, location);
+  ++p->m_stats[PainterEnums::num_state_dedup_misses];
+
+  return location;
 }
 
 template<typename T>
@@ -445,7 +383,7 @@ pack_state_data(enum fastuidraw::PainterSurface::render_type_t render_type,
     }
   else if (obj.m_value != nullptr)
     {
-      pack_state_data_from_value(*obj.m_value, location);
+      pack_state_data_from_value(p, *obj.m_value, location);
     }
   else
     {
@@ -477,18 +415,12 @@ pack_state_data(enum fastuidraw::PainterSurface::render_type_t render_type,
     }
 
   /* data not in current data store but packed in d->m_data, place
-   * it onto the current store.
+   * it onto the current store unless an equal value already is.
    */
-  c_array<const uvec4 > src;
-  c_array<uvec4> dst;
-
-  location = store_written();
-  src = make_c_array(d->m_data);
-  dst = allocate_store(src.size());
-  std::copy(src.begin(), src.end(), dst.begin());
+  location = pack_state_data_from_packed(p, make_c_array(d->m_data), d->m_hash);
 
   d->m_painter[render_type] = p;
-  d->m_draw_command_id[render_type] = p->m_accumulated_draws.size();
+  d->m_draw_command_id[render_type] = p->m_number_commands;
   d->m_offset[render_type] = location;
 }
 
@@ -529,6 +461,7 @@ pack_header(enum PainterSurface::render_type_t render_type,
             int z,
             const painter_state_location &loc,
             const std::list<reference_counted_ptr<PainterPacker::DataCallBack> > &call_backs,
+            PainterPacker *p,
             unsigned int *header_location)
 {
   bool return_value(false);
@@ -589,19 +522,28 @@ pack_header(enum PainterSurface::render_type_t render_type,
   header.m_deferred_coverage_max = deferred_params.m_deferred_coverage_max;
   header.pack_data(dst);
 
-  if (current.m_item_group != m_prev_state.m_item_group
-      || current.m_blend_mode != m_prev_state.m_blend_mode
-      || (render_type == PainterSurface::color_buffer_type &&
-          (current.m_blend_group != m_prev_state.m_blend_group
-           || current.m_blend_shader_type != m_prev_state.m_blend_shader_type
-           || current.m_brush_group != m_prev_state.m_brush_group) != 0u))
+  if (p->m_reorder_active)
     {
-      return_value = m_draw_command->draw_break(render_type,
-                                                m_prev_state, current,
-                                                m_indices_written);
+      /* the draw break is added by emit_staged_indices() */
+      std::vector<shader_group_segment> &segments(p->m_work_room.m_segments);
+      if (segments.empty() || shader_group_changed(render_type, segments.back().m_group, current))
+        {
+          segments.push_back(shader_group_segment());
+          segments.back().m_group = current;
+          segments.back().m_index_begin = m_indices_written;
+          segments.back().m_commutable = shader_group_commutable(render_type, current);
+        }
+    }
+  else
+    {
+      if (shader_group_changed(render_type, m_prev_state, current))
+        {
+          return_value = m_draw_command->draw_break(render_type,
+                                                    m_prev_state, current,
+                                                    m_indices_written);
+        }
+      m_prev_state = current;
     }
-
-  m_prev_state = current;
 
   for (const auto &call_back: call_backs)
     {
@@ -611,6 +553,257 @@ pack_header(enum PainterSurface::render_type_t render_type,
   return return_value;
 }
 
+void
+fastuidraw::PainterPacker::per_draw_command::
+emit_staged_indices(enum PainterSurface::render_type_t render_type,
+                    PainterPacker *p)
+{
+  std::vector<shader_group_segment> &segments(p->m_work_room.m_segments);
+  std::vector<unsigned int> &order(p->m_work_room.m_segment_order);
+  std::vector<unsigned int> &groups(p->m_work_room.m_segment_groups);
+  std::vector<unsigned int> &group_of(p->m_work_room.m_segment_group_of);
+  c_array<const PainterIndex> staged(make_c_array(p->m_work_room.m_staged_indices));
+  unsigned int num_segments(segments.size());
+  unsigned int breaks_before(0), breaks_after(0), dst;
+
+  if (segments.empty())
+    {
+      return;
+    }
+
+  /* Within each run of commutable segments, gather the segments
+   * by shader group, keeping the order of the first appearance
+   * of each group and the order within each group. Segments that
+   * are not commutable stay where they are. To bound the cost,
+   * a run is cut when it has more than max_groups_per_run
+   * different groups. For color buffers, the depth test realizes
+   * the order of the segments of a run only if each segment is
+   * strictly above the segments before it, so a segment that
+   * shares a depth value with the run also cuts the run.
+   */
+  const unsigned int max_groups_per_run(16);
+
+  auto flush_run = [&](unsigned int run_end)
+    {
+      for (unsigned int b = 0, endb = groups.size(); b < endb; ++b)
+        {
+          for (unsigned int k = groups[b]; k < run_end; ++k)
+            {
+              if (group_of[k] == b)
+                {
+                  order.push_back(k);
+                }
+            }
+        }
+      groups.clear();
+    };
+
+  order.clear();
+  groups.clear();
+  group_of.resize(num_segments);
+  int run_z_max(std::numeric_limits<int>::min());
+  for (unsigned int i = 0; i < num_segments; ++i)
+    {
+      unsigned int b, endb;
+
+      if (!segments[i].m_commutable)
+        {
+          flush_run(i);
+          order.push_back(i);
+          run_z_max = std::numeric_limits<int>::min();
+          continue;
+        }
+
+      if (render_type == PainterSurface::color_buffer_type
+          && segments[i].m_z_min <= run_z_max)
+        {
+          flush_run(i);
+          run_z_max = std::numeric_limits<int>::min();
+        }
+      run_z_max = t_max(run_z_max, segments[i].m_z_max);
+
+      for (b = 0, endb = groups.size();
+           b < endb && shader_group_changed(render_type, segments[groups[b]].m_group, segments[i].m_group);
+           ++b)
+        {}
+
+      if (b == endb)
+        {
+          if (groups.size() == max_groups_per_run)
+            {
+              flush_run(i);
+              run_z_max = segments[i].m_z_max;
+            }
+          b = groups.size();
+          groups.push_back(i);
+        }
+      group_of[i] = b;
+    }
+  flush_run(num_segments);
+  FASTUIDRAWassert(order.size() == num_segments);
+
+  auto segment_end = [&](unsigned int i)
+    {
+      return (i + 1 < num_segments) ? segments[i + 1].m_index_begin : m_indices_written;
+    };
+
+  const PainterShaderGroupValues *prev(&m_prev_state);
+  for (unsigned int i = 0; i < num_segments; ++i)
+    {
+      const shader_group_segment &S(segments[i]);
+      if (segment_end(i) != S.m_index_begin)
+        {
+          if (shader_group_changed(render_type, *prev, S.m_group))
+            {
+              ++breaks_before;
+            }
+          prev = &S.m_group;
+        }
+    }
+
+  dst = segments.front().m_index_begin;
+  for (unsigned int i : order)
+    {
+      const shader_group_segment &S(segments[i]);
+      unsigned int end(segment_end(i));
+
+      if (end == S.m_index_begin)
+        {
+          continue;
+        }
+
+      if (shader_group_changed(render_type, m_prev_state, S.m_group))
+        {
+          ++breaks_after;
+          if (m_draw_command->draw_break(render_type, m_prev_state, S.m_group, dst))
+            {
+              ++p->m_stats[PainterEnums::num_draws];
+            }
+        }
+      m_prev_state = S.m_group;
+
+      std::copy(staged.begin() + S.m_index_begin, staged.begin() + end,
+                m_draw_command->m_indices.begin() + dst);
+      dst += end - S.m_index_begin;
+    }
+  FASTUIDRAWassert(dst == m_indices_written);
+
+  if (breaks_before > breaks_after)
+    {
+      p->m_stats[PainterEnums::num_draw_breaks_avoided] += breaks_before - breaks_after;
+    }
+
+  /* indices written after this without a new header are of
+   * the header of the last segment before reordering, which is
+   * not necessarily of the shader group emitted last.
+   */
+  shader_group_segment last(segments.back());
+
+  segments.clear();
+  segments.push_back(shader_group_segment());
+  segments.back().m_group = last.m_group;
+  segments.back().m_index_begin = m_indices_written;
+  segments.back().m_commutable = last.m_commutable;
+  segments.back().m_z_min = last.m_z_min;
+  segments.back().m_z_max = last.m_z_max;
+}
+
+//////////////////////////////////////////////////
+// fastuidraw::PainterPacker::packed_state_cache methods
+fastuidraw::PainterPacker::packed_state_cache::
+packed_state_cache(void):
+  m_count(0)
+{
+  entry empty_entry;
+
+  empty_entry.m_size = 0;
+  m_entries.resize(256, empty_entry);
+}
+
+void
+fastuidraw::PainterPacker::packed_state_cache::
+clear(void)
+{
+  if (m_count > 0)
+    {
+      for (entry &e : m_entries)
+        {
+          e.m_size = 0;
+        }
+      m_values.clear();
+      m_count = 0;
+    }
+}
+
+bool
+fastuidraw::PainterPacker::packed_state_cache::
+find(uint32_t hash, c_array<const uvec4> data, uint32_t *location) const
+{
+  unsigned int mask(m_entries.size() - 1);
+
+  for (unsigned int i = hash & mask; m_entries[i].m_size != 0; i = (i + 1) & mask)
+    {
+      const entry &e(m_entries[i]);
+      if (e.m_hash == hash
+          && e.m_size == data.size()
+          && std::equal(data.begin(), data.end(), m_values.begin() + e.m_begin))
+        {
+          *location = e.m_location;
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+fastuidraw::PainterPacker::packed_state_cache::
+insert(const entry &e)
+{
+  unsigned int mask(m_entries.size() - 1), i;
+
+  for (i = e.m_hash & mask; m_entries[i].m_size != 0; i = (i + 1) & mask)
+    {}
+  m_entries[i] = e;
+}
+
+void
+fastuidraw::PainterPacker::packed_state_cache::
+add(uint32_t hash, c_array<const uvec4> data, uint32_t location)
+{
+  entry e;
+
+  if (data.empty())
+    {
+      return;
+    }
+
+  /* keep the load factor at no more than one half */
+  if (2 * (m_count + 1) > m_entries.size())
+    {
+      std::vector<entry> old_entries;
+      entry empty_entry;
+
+      empty_entry.m_size = 0;
+      old_entries.swap(m_entries);
+      m_entries.resize(2 * old_entries.size(), empty_entry);
+      for (const entry &v : old_entries)
+        {
+          if (v.m_size != 0)
+            {
+              insert(v);
+            }
+        }
+    }
+
+  e.m_hash = hash;
+  e.m_location = location;
+  e.m_begin = m_values.size();
+  e.m_size = data.size();
+  m_values.insert(m_values.end(), data.begin(), data.end());
+  insert(e);
+  ++m_count;
+}
+
 //////////////////////////////////////////////////
 // fastuidraw::PainterPacker::DataCallBack methods
 fastuidraw::PainterPacker::DataCallBack::
@@ -644,6 +837,7 @@ active(void) const
 fastuidraw::PainterPacker::
 PainterPacker(PainterBrushShader *default_brush_shader,
               vecN<unsigned int, num_stats> &stats,
+              detail::PainterPhaseTimings &timings,
               reference_counted_ptr<PainterBackend> backend,
               PainterShaderRegistrar &registrar,
               const PainterEngine::ConfigurationBase &config):
@@ -653,7 +847,10 @@ PainterPacker(PainterBrushShader *default_brush_shader,
   m_blend_shader(nullptr),
   m_number_commands(0),
   m_clear_color_buffer(false),
-  m_stats(stats)
+  m_reorder_shader_groups(false),
+  m_reorder_active(false),
+  m_stats(stats),
+  m_timings(timings)
 {
   m_header_size = PainterHeader::data_size();
   m_binded_images.resize(config.number_context_textures());
@@ -671,7 +868,9 @@ start_new_command(void)
   if (!m_accumulated_draws.empty())
     {
       per_draw_command &c(m_accumulated_draws.back());
+      detail::PainterPhaseTimer timer(m_timings, PainterEnums::time_submission);
 
+      emit_staged_indices();
       m_stats[PainterEnums::num_attributes] += c.m_attributes_written;
       m_stats[PainterEnums::num_indices] += c.m_indices_written;
       m_stats[PainterEnums::num_datas] += c.store_written();
@@ -683,6 +882,22 @@ start_new_command(void)
   r = m_backend->map_draw();
   ++m_number_commands;
   m_accumulated_draws.push_back(per_draw_command(m_registrar, r));
+  m_state_cache.clear();
+  m_work_room.m_segments.clear();
+  if (m_reorder_active && m_work_room.m_staged_indices.size() < r->m_indices.size())
+    {
+      m_work_room.m_staged_indices.resize(r->m_indices.size());
+    }
+}
+
+void
+fastuidraw::PainterPacker::
+emit_staged_indices(void)
+{
+  if (m_reorder_active && !m_accumulated_draws.empty())
+    {
+      m_accumulated_draws.back().emit_staged_indices(m_render_type, this);
+    }
 }
 
 template<typename T>
@@ -694,14 +909,7 @@ compute_room_needed_for_packing(const PainterDataValue<T> &obj)
     {
       detail::PackedValuePoolBase::ElementBase *d;
       d = static_cast<detail::PackedValuePoolBase::ElementBase*>(obj.m_packed_value.opaque_data());
-      if (d->m_painter[m_render_type] == this && d->m_draw_command_id[m_render_type] == m_number_commands)
-        {
-          return 0;
-        }
-      else
-        {
-          return d->m_data.size();
-        }
+      return compute_room_needed_for_packing(d);
     }
   else if (obj.m_value != nullptr)
     {
@@ -717,7 +925,17 @@ unsigned int
 fastuidraw::PainterPacker::
 compute_room_needed_for_packing(const detail::PackedValuePoolBase::ElementBase* d)
 {
-  return (d) ? d->m_data.size() : 0;
+  return (d && !packed_in_current_draw(d)) ? d->m_data.size() : 0;
+}
+
+bool
+fastuidraw::PainterPacker::
+packed_in_current_draw(const detail::PackedValuePoolBase::ElementBase* d) const
+{
+  uint32_t location;
+
+  return (d->m_painter[m_render_type] == this && d->m_draw_command_id[m_render_type] == m_number_commands)
+    || m_state_cache.find(d->m_hash, make_c_array(d->m_data), &location);
 }
 
 unsigned int
@@ -733,6 +951,7 @@ compute_room_needed_for_packing(const PainterPackerData &draw_state)
     {
       R += compute_room_needed_for_packing(draw_state.m_brush.brush_shader_data());
       R += compute_room_needed_for_packing(draw_state.m_blend_shader_data);
+      R += compute_room_needed_for_packing(draw_state.m_brush_adjust);
     }
   return R;
 }
@@ -769,6 +988,7 @@ upload_draw_state(const PainterPackerData &draw_state)
 
               m_binded_images[i] = images[i].get();
               action = m_backend->bind_image(i, images[i]);
+              emit_staged_indices();
               if (m_accumulated_draws.back().draw_break(action))
                 {
                   ++m_stats[PainterEnums::num_draws];
@@ -862,11 +1082,14 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
 
           ++m_stats[PainterEnums::num_headers];
           allocate_header = false;
+          cmd.m_draw_command->use_attribute_slots(number_attribute_slots(shader));
           brush_shader = draw.m_brush.brush_shader();
           if (!brush_shader)
             {
               brush_shader = m_default_brush_shader;
             }
+
+          detail::PainterPhaseTimer timer(m_timings, PainterEnums::time_state_packing);
           draw_break_added = cmd.pack_header(m_render_type, m_header_size,
                                              deferred_params,
                                              brush_shader,
@@ -875,7 +1098,13 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
                                              z + write_state.m_z_range.m_begin,
                                              m_painter_state_location,
                                              m_callback_list,
+                                             this,
                                              &header_loc);
+          if (m_reorder_active)
+            {
+              m_work_room.m_segments.back().add_z_range(z + write_state.m_z_range.m_begin,
+                                                        z + write_state.m_z_range.m_end);
+            }
           last_z_begin = write_state.m_z_range.m_begin;
           max_z_end = t_max(max_z_end, write_state.m_z_range.m_end);
           if (draw_break_added)
@@ -894,13 +1123,24 @@ draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
       c_array<uint32_t> dst_indices, dst_header;
 
       dst_attribs = cmd.m_draw_command->m_attributes.sub_array(cmd.m_attributes_written);
-      dst_indices = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written);
+      if (m_reorder_active)
+        {
+          dst_indices = make_c_array(m_work_room.m_staged_indices).sub_array(cmd.m_indices_written,
+                                                                           cmd.index_room());
+        }
+      else
+        {
+          dst_indices = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written);
+        }
 
-      data_to_write = src.write_data(dst_attribs, dst_indices,
-                                     cmd.m_attributes_written,
-                                     &write_state,
-                                     &num_attribs_written,
-                                     &num_indices_written);
+      {
+        detail::PainterPhaseTimer timer(m_timings, PainterEnums::time_attribute_write);
+        data_to_write = src.write_data(dst_attribs, dst_indices,
+                                       cmd.m_attributes_written,
+                                       &write_state,
+                                       &num_attribs_written,
+                                       &num_indices_written);
+      }
 
       /* Write the header location only to the attributes that src.write_data() wrote to */
       dst_header = cmd.m_draw_command->m_header_attributes.sub_array(cmd.m_attributes_written, num_attribs_written);
@@ -978,6 +1218,7 @@ begin(const reference_counted_ptr<PainterSurface> &surface,
   m_render_type = m_surface->render_type();
   m_clear_color_buffer = clear_color_buffer;
   m_begin_new_target = true;
+  m_reorder_active = m_reorder_shader_groups;
   start_new_command();
   m_last_binded_cvg_image = nullptr;
 }
@@ -986,9 +1227,13 @@ void
 fastuidraw::PainterPacker::
 flush_implement(void)
 {
+  detail::PainterPhaseTimer timer(m_timings, PainterEnums::time_submission);
+
   if (!m_accumulated_draws.empty())
     {
       per_draw_command &c(m_accumulated_draws.back());
+
+      emit_staged_indices();
       m_stats[PainterEnums::num_attributes] += c.m_attributes_written;
       m_stats[PainterEnums::num_indices] += c.m_indices_written;
       m_stats[PainterEnums::num_datas] += c.store_written();
@@ -1044,6 +1289,10 @@ void
 fastuidraw::PainterPacker::
 draw_break(const reference_counted_ptr<const PainterDrawBreakAction> &action)
 {
+  if (action)
+    {
+      emit_staged_indices();
+    }
   if (m_accumulated_draws.back().draw_break(action))
     {
       ++m_stats[PainterEnums::num_draws];
@@ -1059,6 +1308,10 @@ set_coverage_surface(const reference_counted_ptr<PainterSurface> &surface)
       reference_counted_ptr<PainterDrawBreakAction> action;
 
       action = m_backend->bind_coverage_surface(surface);
+      if (action)
+        {
+          emit_staged_indices();
+        }
       if (m_accumulated_draws.back().draw_break(action))
         {
           ++m_stats[PainterEnums::num_draws];
@@ -1078,7 +1331,7 @@ draw_generic(const DeferredCoverageReadParams &deferred_params,
              c_array<const unsigned int> attrib_chunk_selector,
              int z)
 {
-  AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector);
+  detail::AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector);
   draw_generic_implement(deferred_params, shader, draw, src, z);
 }
 
@@ -1102,7 +1355,7 @@ draw_generic(PainterItemCoverageShader *shader,
              c_array<const int> index_adjusts,
              c_array<const unsigned int> attrib_chunk_selector)
 {
-  AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector);
+  detail::AttributeIndexSrcFromArray src(attrib_chunks, index_chunks, index_adjusts, attrib_chunk_selector);
   draw_generic_implement(DeferredCoverageReadParams(), shader, draw, src, 0);
 }
 
@@ -43,6 +43,7 @@
 #include <fastuidraw/painter/backend/painter_header.hpp>
 
 #include <private/painter_backend/painter_packer_data.hpp>
+#include <private/painter_backend/painter_phase_timer.hpp>
 
 namespace fastuidraw
 {
@@ -65,7 +66,7 @@ namespace fastuidraw
          * supported. Sync this with the last enumeration
          * in PainterEnums::query_stats_t
          */
-        num_stats = PainterEnums::num_deferred_coverages + 1
+        num_stats = PainterEnums::time_submission + 1
       };
 
     /*!
@@ -131,12 +132,15 @@ namespace fastuidraw
     /*!
      * Ctor.
      * \param stats location to which to update stat values
+     * \param timings location to which to add the time spent
+     *                in the phases of packing
      * \param backend handle to PainterBackend for the constructed PainterPacker
      * \param config configuration from PainterEngine
      */
     explicit
     PainterPacker(PainterBrushShader *default_brush_shader,
                   vecN<unsigned int, num_stats> &stats,
+                  detail::PainterPhaseTimings &timings,
                   reference_counted_ptr<PainterBackend> backend,
                   PainterShaderRegistrar &registrar,
                   const PainterEngine::ConfigurationBase &config);
@@ -174,6 +178,27 @@ namespace fastuidraw
       m_blend_mode = blend_mode;
     }
 
+    /*!
+     * Set if draws within each PainterDraw are to be reordered
+     * by shader group to reduce the number of draw breaks. Only
+     * draws whose result does not depend on the draw order are
+     * moved. The value takes effect on the next call to begin().
+     */
+    void
+    reorder_shader_groups(bool v)
+    {
+      m_reorder_shader_groups = v;
+    }
+
+    /*!
+     * Returns the value set by reorder_shader_groups(bool).
+     */
+    bool
+    reorder_shader_groups(void) const
+    {
+      return m_reorder_shader_groups;
+    }
+
     /*!
      * Add a \ref DataCallBack to this PainterPacker. A fixed DataCallBack
      * can only be active on one PainterPacker, but a single PainterPacker
@@ -396,6 +421,7 @@ namespace fastuidraw
 
   private:
     class per_draw_command;
+    class shader_group_segment;
     class painter_state_location
     {
     public:
@@ -407,15 +433,68 @@ namespace fastuidraw
       uint32_t m_brush_adjust_data_loc;
     };
 
+    /* A packed_state_cache tracks, by value, the state data
+     * placed onto the store of the current PainterDraw so that
+     * equal state values coming from different objects share
+     * the same location in the store.
+     */
+    class packed_state_cache
+    {
+    public:
+      packed_state_cache(void);
+
+      void
+      clear(void);
+
+      bool
+      find(uint32_t hash, c_array<const uvec4> data, uint32_t *location) const;
+
+      void
+      add(uint32_t hash, c_array<const uvec4> data, uint32_t location);
+
+    private:
+      class entry
+      {
+      public:
+        uint32_t m_hash, m_location;
+        unsigned int m_begin, m_size;
+      };
+
+      void
+      insert(const entry &e);
+
+      /* open addressing hash table whose size is a power of
+       * 2; an entry with m_size as 0 is an empty slot.
+       */
+      std::vector<entry> m_entries;
+      std::vector<uvec4> m_values;
+      unsigned int m_count;
+    };
+
     class Workroom
     {
     public:
       std::vector<unsigned int> m_state_values;
+      std::vector<uvec4> m_packed_state;
+
+      /* when reordering by shader group, the indices of the
+       * current PainterDraw are written here first together
+       * with the ranges of each shader group and copied in
+       * their new order to PainterDraw::m_indices by
+       * emit_staged_indices().
+       */
+      std::vector<PainterIndex> m_staged_indices;
+      std::vector<shader_group_segment> m_segments;
+      std::vector<unsigned int> m_segment_order;
+      std::vector<unsigned int> m_segment_groups, m_segment_group_of;
     };
 
     void
     start_new_command(void);
 
+    void
+    emit_staged_indices(void);
+
     bool //return true if it started a new command
     upload_draw_state(const PainterPackerData &draw_state);
 
@@ -429,6 +508,9 @@ namespace fastuidraw
     unsigned int
     compute_room_needed_for_packing(const detail::PackedValuePoolBase::ElementBase* d);
 
+    bool
+    packed_in_current_draw(const detail::PackedValuePoolBase::ElementBase* d) const;
+
     template<typename T, typename ShaderType>
     int
     draw_generic_implement(const DeferredCoverageReadParams &deferred_params,
@@ -455,11 +537,14 @@ namespace fastuidraw
     enum PainterSurface::render_type_t m_render_type;
     bool m_clear_color_buffer;
     bool m_begin_new_target;
+    bool m_reorder_shader_groups, m_reorder_active;
     std::vector<per_draw_command> m_accumulated_draws;
     reference_counted_ptr<PainterSurface> m_last_binded_cvg_image;
 
     Workroom m_work_room;
+    packed_state_cache m_state_cache;
     vecN<unsigned int, num_stats> &m_stats;
+    detail::PainterPhaseTimings &m_timings;
 
     std::list<reference_counted_ptr<PainterPacker::DataCallBack> > m_callback_list;
   };
@@ -0,0 +1,117 @@
+/*!
+ * \file painter_phase_timer.hpp
+ * \brief file painter_phase_timer.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/painter/painter_enums.hpp>
+
+#ifdef FASTUIDRAW_PAINTER_PHASE_TIMING
+#include <chrono>
+#endif
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A PainterPhaseTimings accumulates the time, in nanoseconds,
+     * spent in the phases of drawing reported by the stats from
+     * PainterEnums::time_subset_selection to
+     * PainterEnums::time_submission. The time is only measured
+     * if FASTUIDRAW_PAINTER_PHASE_TIMING is defined; otherwise
+     * PainterPhaseTimer does nothing and the stats are zero.
+     */
+    class PainterPhaseTimings
+    {
+    public:
+      enum
+        {
+          first_phase = PainterEnums::time_subset_selection,
+          number_phases = PainterEnums::time_submission - first_phase + 1
+        };
+
+      PainterPhaseTimings(void):
+        m_nanoseconds(0)
+      {}
+
+      void
+      clear(void)
+      {
+        m_nanoseconds = vecN<uint64_t, number_phases>(0);
+      }
+
+      /* writes the accumulated times, in micro-seconds,
+       * to the stats.
+       */
+      template<size_t N>
+      void
+      write_stats(vecN<unsigned int, N> &stats) const
+      {
+        for (unsigned int i = 0; i < number_phases; ++i)
+          {
+            stats[first_phase + i] = static_cast<unsigned int>(m_nanoseconds[i] / 1000u);
+          }
+      }
+
+      uint64_t&
+      nanoseconds(enum PainterEnums::query_stats_t phase)
+      {
+        unsigned int p(phase - first_phase);
+
+        FASTUIDRAWassert(p < number_phases);
+        return m_nanoseconds[p];
+      }
+
+    private:
+      vecN<uint64_t, number_phases> m_nanoseconds;
+    };
+
+    /* A PainterPhaseTimer adds the time between its ctor
+     * and dtor to a phase of a PainterPhaseTimings.
+     */
+    class PainterPhaseTimer:fastuidraw::noncopyable
+    {
+    public:
+#ifdef FASTUIDRAW_PAINTER_PHASE_TIMING
+      PainterPhaseTimer(PainterPhaseTimings &timings,
+                        enum PainterEnums::query_stats_t phase):
+        m_dst(timings.nanoseconds(phase)),
+        m_start(std::chrono::steady_clock::now())
+      {}
+
+      ~PainterPhaseTimer()
+      {
+        std::chrono::steady_clock::duration d;
+
+        d = std::chrono::steady_clock::now() - m_start;
+        m_dst += std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+      }
+
+    private:
+      uint64_t &m_dst;
+      std::chrono::steady_clock::time_point m_start;
+#else
+      PainterPhaseTimer(PainterPhaseTimings&,
+                        enum PainterEnums::query_stats_t)
+      {}
+#endif
+    };
+  }
+}
@@ -0,0 +1,93 @@
+/*!
+ * \file painter_picture_private.hpp
+ * \brief file painter_picture_private.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <fastuidraw/util/matrix.hpp>
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/painter/painter_picture.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A PainterPicturePrivate is a PainterCommandListPrivate
+     * together with what is needed to replay it with a different
+     * transformation:
+     *  - the projection used when recording so that the recorded
+     *    item matrices can be mapped to the coordinates of the
+     *    picture
+     *  - the clip equations of the viewport of the recording so
+     *    that draws that were not clipped by the content of the
+     *    picture take the clipping of the Painter that replays
+     *    the picture
+     *  - the number of times the GlyphCache cleared its atlas
+     *    when the picture was recorded; glyphs store their atlas
+     *    location in the attribute data, so clearing the atlas
+     *    invalidates the picture.
+     */
+    class PainterPicturePrivate
+    {
+    public:
+      typedef PackedValuePool<PainterClipEquations>::ElementHandle PackedClipEquations;
+
+      PainterPicturePrivate(void):
+        m_dimensions(0, 0),
+        m_has_clipped_draws(false),
+        m_number_times_atlas_cleared(0)
+      {}
+
+      void
+      clear(void)
+      {
+        m_list.clear();
+        m_base_clip.reset();
+        m_has_clipped_draws = false;
+        m_glyph_cache.clear();
+      }
+
+      bool
+      valid(void) const
+      {
+        return !m_list.m_recording
+          && m_glyph_cache
+          && m_glyph_cache->number_times_atlas_cleared() == m_number_times_atlas_cleared;
+      }
+
+      void
+      end_recording(int z)
+      {
+        m_list.end_recording(z);
+        m_has_clipped_draws = false;
+        for (const PainterPackerData &data : m_list.m_data)
+          {
+            m_has_clipped_draws = m_has_clipped_draws || data.m_clip != m_base_clip;
+          }
+      }
+
+      PainterCommandListPrivate m_list;
+      ivec2 m_dimensions;
+      float3x3 m_inverse_projection;
+      PackedClipEquations m_base_clip;
+      bool m_has_clipped_draws;
+      reference_counted_ptr<GlyphCache> m_glyph_cache;
+      unsigned int m_number_times_atlas_cleared;
+    };
+  }
+}
@@ -0,0 +1,161 @@
+/*!
+ * \file tessellated_path_levels.hpp
+ * \brief file tessellated_path_levels.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/tessellated_path.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A TessellatedPathLevels is a list of TessellatedPath objects
+     * where no element has a larger max_distance() than the element
+     * before it. Elements are only appended and the list
+     * is only modified by one thread at a time (the owner of the
+     * TessellatedPathLevels serializes the modifications with its
+     * own lock). Other threads can search the elements with find()
+     * and front() without locking while elements are appended; to
+     * allow that, the first max_lock_free_levels elements are also
+     * stored in a fixed size array whose used size is published
+     * atomically after an element is written to it.
+     */
+    class TessellatedPathLevels:fastuidraw::noncopyable
+    {
+    public:
+      typedef reference_counted_ptr<const TessellatedPath> TessellatedPathRef;
+
+      enum
+        {
+          max_lock_free_levels = 32
+        };
+
+      TessellatedPathLevels(void):
+        m_lock_free(nullptr),
+        m_number_published(0u),
+        m_complete(false)
+      {}
+
+      /* Returns the first element or nullptr if there
+       * are no elements; does not lock.
+       */
+      const TessellatedPath*
+      front(void) const
+      {
+        return (m_number_published.load(std::memory_order_acquire) > 0u) ?
+          m_lock_free[0] :
+          nullptr;
+      }
+
+      /* Returns the element with the largest max_distance() that
+       * is no more than max_distance. If no such element exists
+       * and set_complete() was called, returns the last element.
+       * Otherwise returns nullptr; does not lock.
+       */
+      const TessellatedPath*
+      find(float max_distance) const
+      {
+        unsigned int n;
+
+        n = m_number_published.load(std::memory_order_acquire);
+        if (n == 0u)
+          {
+            return nullptr;
+          }
+
+        if (m_lock_free[n - 1u]->max_distance() <= max_distance)
+          {
+            const TessellatedPath *const *iter;
+
+            iter = std::lower_bound(m_lock_free.c_ptr(),
+                                    m_lock_free.c_ptr() + n,
+                                    max_distance,
+                                    compare_max_distance);
+            FASTUIDRAWassert(iter != m_lock_free.c_ptr() + n);
+            return *iter;
+          }
+
+        return (m_complete.load(std::memory_order_acquire)) ?
+          m_lock_free[n - 1u] :
+          nullptr;
+      }
+
+      /* The methods below must only be called by the thread
+       * currently allowed to modify the TessellatedPathLevels.
+       */
+      const std::vector<TessellatedPathRef>&
+      elements(void) const
+      {
+        return m_elements;
+      }
+
+      void
+      push_back(const TessellatedPathRef &p)
+      {
+        FASTUIDRAWassert(p);
+        FASTUIDRAWassert(m_elements.empty() || m_elements.back()->max_distance() >= p->max_distance());
+
+        m_elements.push_back(p);
+        if (m_elements.size() <= max_lock_free_levels)
+          {
+            m_lock_free[m_elements.size() - 1u] = p.get();
+            m_number_published.store(m_elements.size(), std::memory_order_release);
+          }
+      }
+
+      /* Indicates that no more elements will be added, so that find()
+       * returns the last element if no element is fine enough.
+       */
+      void
+      set_complete(void)
+      {
+        if (m_elements.size() <= max_lock_free_levels)
+          {
+            m_complete.store(true, std::memory_order_release);
+          }
+      }
+
+      /* must not be called while another thread is in find() or front() */
+      void
+      clear(void)
+      {
+        m_number_published.store(0u, std::memory_order_relaxed);
+        m_complete.store(false, std::memory_order_relaxed);
+        m_elements.clear();
+      }
+
+    private:
+      static
+      bool
+      compare_max_distance(const TessellatedPath *lhs, float rhs)
+      {
+        return lhs->max_distance() > rhs;
+      }
+
+      std::vector<TessellatedPathRef> m_elements;
+      vecN<const TessellatedPath*, max_lock_free_levels> m_lock_free;
+      std::atomic<unsigned int> m_number_published;
+      std::atomic<bool> m_complete;
+    };
+  }
+}
@@ -19,9 +19,12 @@ include $(dir)/Rules.mk
 dir := $(d)/effects
 include $(dir)/Rules.mk
 
-FASTUIDRAW_SOURCES += $(call filelist, fill_rule.cpp \
+FASTUIDRAW_SOURCES += $(call filelist, clip_culling_params.cpp \
+	fill_rule.cpp \
 	painter_brush.cpp \
-	painter.cpp painter_enums.cpp \
+	painter.cpp painter_command_list.cpp \
+	painter_picture.cpp \
+	painter_enums.cpp \
 	shader_filled_path.cpp)
 
 # Begin standard footer
@@ -36,6 +36,7 @@ namespace
   {
   public:
     std::vector<fastuidraw::vec3> m_adjusted_clip_eqs;
+    fastuidraw::detail::PackedClipPlanes m_packed_clip_eqs;
     fastuidraw::c_array<const fastuidraw::vec2> m_clipped_rect;
 
     fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
@@ -696,6 +697,7 @@ select(ScratchSpacePrivate &scratch,
        */
       scratch.m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
     }
+  scratch.m_packed_clip_eqs.set(make_c_array(scratch.m_adjusted_clip_eqs));
 
   select_implement(scratch, dst, return_value);
   return return_value;
@@ -711,19 +713,39 @@ select_implement(ScratchSpacePrivate &scratch,
   using namespace fastuidraw::detail;
 
   vecN<vec2, 4> bb;
-  bool unclipped;
+  enum PackedClipPlanes::box_classification_t box_class;
 
   m_bounding_box.inflated_polygon(bb, 0.0f);
-  unclipped = clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
-                                  bb, &scratch.m_clipped_rect,
-                                  scratch.m_clip_scratch_vec2s);
+  box_class = scratch.m_packed_clip_eqs.classify_box(bb);
 
   //completely clipped
-  if (scratch.m_clipped_rect.empty())
+  if (box_class == PackedClipPlanes::box_culled)
     {
       return;
     }
 
+  /* not culled by any single plane, clip the box to check
+   * if any of it survives all the planes.
+   */
+  if (box_class == PackedClipPlanes::box_partially_clipped)
+    {
+      bool unclipped;
+
+      unclipped = clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
+                                      bb, &scratch.m_clipped_rect,
+                                      scratch.m_clip_scratch_vec2s);
+      if (scratch.m_clipped_rect.empty())
+        {
+          return;
+        }
+
+      /* only when classify_box() is not using the packed tests */
+      if (unclipped)
+        {
+          box_class = PackedClipPlanes::box_unclipped;
+        }
+    }
+
   /* TODO: compute and check the bounding box of the elements
    * of m_glyph_list against the clip equations.
    */
@@ -737,7 +759,7 @@ select_implement(ScratchSpacePrivate &scratch,
       return;
     }
 
-  if (unclipped)
+  if (box_class == PackedClipPlanes::box_unclipped)
     {
       m_child[0]->select_all(dst, current);
       m_child[1]->select_all(dst, current);
@@ -8,6 +8,7 @@ FASTUIDRAW_SOURCES += $(call filelist, \
 	painter_shader_group.cpp \
 	painter_surface.cpp \
 	painter_engine.cpp \
+	painter_engine_null.cpp \
 	painter_header.cpp \
 	painter_clip_equations.cpp \
 	painter_item_matrix.cpp \
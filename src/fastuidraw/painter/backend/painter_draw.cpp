@@ -18,6 +18,7 @@
 
 
 #include <vector>
+#include <fastuidraw/util/math.hpp>
 #include <fastuidraw/painter/backend/painter_draw.hpp>
 
 namespace
@@ -40,6 +41,7 @@ namespace
       m_attribs_written(0),
       m_indices_written(0),
       m_data_store_written(0),
+      m_attribute_slots_used(0),
       m_p(p)
     {}
 
@@ -47,6 +49,7 @@ namespace
     unsigned int m_action_count;
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_actions;
     unsigned int m_attribs_written, m_indices_written, m_data_store_written;
+    unsigned int m_attribute_slots_used;
     fastuidraw::PainterDraw *m_p;
   };
 
@@ -143,6 +146,26 @@ add_action(const reference_counted_ptr<DelayedAction> &h) const
   d->m_actions.push_back(h);
 }
 
+void
+fastuidraw::PainterDraw::
+use_attribute_slots(unsigned int N)
+{
+  PainterDrawPrivate *d;
+  d = static_cast<PainterDrawPrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_map_status == status_mapped);
+  d->m_attribute_slots_used = t_max(d->m_attribute_slots_used, N);
+}
+
+unsigned int
+fastuidraw::PainterDraw::
+number_attribute_slots_used(void) const
+{
+  PainterDrawPrivate *d;
+  d = static_cast<PainterDrawPrivate*>(m_d);
+  return d->m_attribute_slots_used;
+}
+
 void
 fastuidraw::PainterDraw::
 unmap(unsigned int attributes_written,
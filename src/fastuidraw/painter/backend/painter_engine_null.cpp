@@ -0,0 +1,844 @@
+/*!
+ * \file painter_engine_null.cpp
+ * \brief file painter_engine_null.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <fastuidraw/painter/backend/painter_engine_null.hpp>
+#include <fastuidraw/painter/backend/painter_backend.hpp>
+#include <fastuidraw/painter/backend/painter_draw.hpp>
+#include <fastuidraw/glsl/painter_shader_registrar_glsl.hpp>
+#include <private/util_private.hpp>
+
+namespace
+{
+  class NullStats:
+    public fastuidraw::reference_counted<NullStats>::concurrent
+  {
+  public:
+    NullStats(void)
+    {
+      reset();
+    }
+
+    void
+    add(enum fastuidraw::PainterEngineNull::stat_t st, uint64_t v)
+    {
+      m_values[st].fetch_add(v, std::memory_order_relaxed);
+    }
+
+    void
+    reset(void)
+    {
+      for (unsigned int i = 0; i < fastuidraw::PainterEngineNull::number_stats; ++i)
+        {
+          m_values[i].store(0u, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t
+    value(enum fastuidraw::PainterEngineNull::stat_t st) const
+    {
+      return m_values[st].load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint64_t> m_values[fastuidraw::PainterEngineNull::number_stats];
+  };
+
+  class NullGlyphAtlasBackingStore:public fastuidraw::GlyphAtlasBackingStoreBase
+  {
+  public:
+    explicit
+    NullGlyphAtlasBackingStore(unsigned int psize):
+      fastuidraw::GlyphAtlasBackingStoreBase(psize),
+      m_data(psize, 0u)
+    {}
+
+    virtual
+    void
+    set_values(unsigned int location,
+               fastuidraw::c_array<const uint32_t> pdata) override
+    {
+      FASTUIDRAWassert(location + pdata.size() <= m_data.size());
+      std::copy(pdata.begin(), pdata.end(), m_data.begin() + location);
+    }
+
+    virtual
+    void
+    flush(void) override
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(unsigned int new_size) override
+    {
+      m_data.resize(new_size, 0u);
+    }
+
+  private:
+    std::vector<uint32_t> m_data;
+  };
+
+  class NullColorBackingStore:public fastuidraw::AtlasColorBackingStoreBase
+  {
+  public:
+    NullColorBackingStore(int log2_tile_size, int log2_num_tiles_per_row_per_col,
+                          int num_layers):
+      fastuidraw::AtlasColorBackingStoreBase(store_size(log2_tile_size,
+                                                        log2_num_tiles_per_row_per_col,
+                                                        num_layers)),
+      m_levels(log2_tile_size + 1)
+    {
+      resize_levels(dimensions());
+    }
+
+    virtual
+    void
+    set_data(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l,
+             fastuidraw::ivec2 src_xy, unsigned int size,
+             const fastuidraw::ImageSourceBase &image_data) override
+    {
+      using namespace fastuidraw;
+
+      if (mipmap_level >= static_cast<int>(m_levels.size()))
+        {
+          return;
+        }
+
+      m_scratch.resize(size * size);
+      image_data.fetch_texels(mipmap_level, src_xy, size, size,
+                              make_c_array(m_scratch));
+      write_texels(mipmap_level, dst_xy, dst_l, size);
+    }
+
+    virtual
+    void
+    set_data(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l,
+             unsigned int size, fastuidraw::u8vec4 color_value) override
+    {
+      if (mipmap_level >= static_cast<int>(m_levels.size()))
+        {
+          return;
+        }
+
+      m_scratch.clear();
+      m_scratch.resize(size * size, color_value);
+      write_texels(mipmap_level, dst_xy, dst_l, size);
+    }
+
+    virtual
+    void
+    flush(void) override
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers) override
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      dims.z() = new_num_layers;
+      resize_levels(dims);
+    }
+
+  private:
+    static
+    fastuidraw::ivec3
+    store_size(int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layers)
+    {
+      int v(1 << (log2_num_tiles_per_row_per_col + log2_tile_size));
+      return fastuidraw::ivec3(v, v, num_layers);
+    }
+
+    void
+    resize_levels(fastuidraw::ivec3 dims)
+    {
+      for (unsigned int L = 0; L < m_levels.size(); ++L)
+        {
+          int w(dims.x() >> L), h(dims.y() >> L);
+          m_levels[L].resize(w * h * dims.z());
+        }
+    }
+
+    void
+    write_texels(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l,
+                 unsigned int size)
+    {
+      std::vector<fastuidraw::u8vec4> &level(m_levels[mipmap_level]);
+      int w(dimensions().x() >> mipmap_level);
+      int h(dimensions().y() >> mipmap_level);
+
+      for (int y = 0, endy = std::min(static_cast<int>(size), h - dst_xy.y()); y < endy; ++y)
+        {
+          int cnt(std::min(static_cast<int>(size), w - dst_xy.x()));
+          unsigned int dst_offset;
+
+          dst_offset = dst_xy.x() + w * (dst_xy.y() + y + h * dst_l);
+          std::copy(m_scratch.begin() + y * size,
+                    m_scratch.begin() + y * size + cnt,
+                    level.begin() + dst_offset);
+        }
+    }
+
+    std::vector<std::vector<fastuidraw::u8vec4> > m_levels;
+    std::vector<fastuidraw::u8vec4> m_scratch;
+  };
+
+  class NullIndexBackingStore:public fastuidraw::AtlasIndexBackingStoreBase
+  {
+  public:
+    NullIndexBackingStore(int log2_tile_size,
+                          int log2_num_index_tiles_per_row_per_col,
+                          int num_layers):
+      fastuidraw::AtlasIndexBackingStoreBase(store_size(log2_tile_size,
+                                                        log2_num_index_tiles_per_row_per_col,
+                                                        num_layers))
+    {
+      resize_implement(num_layers);
+    }
+
+    virtual
+    void
+    set_data(int x, int y, int l, int w, int h,
+             fastuidraw::c_array<const fastuidraw::ivec3> data) override
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      for (int idx = 0, b = 0; b < h; ++b)
+        {
+          for (int a = 0; a < w; ++a, ++idx)
+            {
+              m_data[x + a + dims.x() * (y + b + dims.y() * l)] = data[idx];
+            }
+        }
+    }
+
+    virtual
+    void
+    flush(void) override
+    {}
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers) override
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      m_data.resize(dims.x() * dims.y() * new_num_layers);
+    }
+
+  private:
+    static
+    fastuidraw::ivec3
+    store_size(int log2_tile_size, int log2_num_index_tiles_per_row_per_col, int num_layers)
+    {
+      int v(1 << (log2_num_index_tiles_per_row_per_col + log2_tile_size));
+      return fastuidraw::ivec3(v, v, num_layers);
+    }
+
+    std::vector<fastuidraw::ivec3> m_data;
+  };
+
+  /* An Image that is not on the atlas; the texels of
+   * the base level are kept in CPU memory.
+   */
+  class NullImage:public fastuidraw::Image
+  {
+  public:
+    NullImage(fastuidraw::ImageAtlas &atlas, int w, int h,
+              enum format_t fmt):
+      fastuidraw::Image(atlas, w, h, 1, context_texture2d, 0u, fmt)
+    {}
+
+    NullImage(fastuidraw::ImageAtlas &atlas, int w, int h,
+              const fastuidraw::ImageSourceBase &image_data):
+      fastuidraw::Image(atlas, w, h, 1, context_texture2d, 0u, image_data.format()),
+      m_texels(w * h)
+    {
+      image_data.fetch_texels(0, fastuidraw::ivec2(0, 0), w, h,
+                              fastuidraw::make_c_array(m_texels));
+    }
+
+  private:
+    std::vector<fastuidraw::u8vec4> m_texels;
+  };
+
+  class NullImageAtlas:public fastuidraw::ImageAtlas
+  {
+  public:
+    enum
+      {
+        log2_color_tile_size = 5,
+        log2_num_color_tiles_per_row_per_col = 4,
+        num_color_layers = 1,
+        log2_index_tile_size = 2,
+        log2_num_index_tiles_per_row_per_col = 6,
+        num_index_layers = 1,
+      };
+
+    NullImageAtlas(void):
+      fastuidraw::ImageAtlas(1 << log2_color_tile_size,
+                             1 << log2_index_tile_size,
+                             FASTUIDRAWnew NullColorBackingStore(log2_color_tile_size,
+                                                                 log2_num_color_tiles_per_row_per_col,
+                                                                 num_color_layers),
+                             FASTUIDRAWnew NullIndexBackingStore(log2_index_tile_size,
+                                                                 log2_num_index_tiles_per_row_per_col,
+                                                                 num_index_layers))
+    {}
+
+  private:
+    virtual
+    fastuidraw::reference_counted_ptr<fastuidraw::Image>
+    create_image_bindless(int, int, const fastuidraw::ImageSourceBase&) override
+    {
+      return nullptr;
+    }
+
+    virtual
+    fastuidraw::reference_counted_ptr<fastuidraw::Image>
+    create_image_context_texture2d(int w, int h,
+                                   const fastuidraw::ImageSourceBase &image_data) override
+    {
+      return FASTUIDRAWnew NullImage(*this, w, h, image_data);
+    }
+  };
+
+  class NullColorStopBackingStore:public fastuidraw::ColorStopBackingStore
+  {
+  public:
+    NullColorStopBackingStore(int w, int num_layers):
+      fastuidraw::ColorStopBackingStore(w, num_layers),
+      m_data(w * num_layers)
+    {}
+
+    virtual
+    void
+    set_data(int x, int l, int w,
+             fastuidraw::c_array<const fastuidraw::u8vec4> data) override
+    {
+      std::copy(data.begin(), data.begin() + w,
+                m_data.begin() + x + dimensions().x() * l);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers) override
+    {
+      m_data.resize(dimensions().x() * new_num_layers);
+    }
+
+  private:
+    std::vector<fastuidraw::u8vec4> m_data;
+  };
+
+  class NullShaderRegistrar:public fastuidraw::glsl::PainterShaderRegistrarGLSL
+  {
+  public:
+    explicit
+    NullShaderRegistrar(const UberShaderParams &params):
+      m_params(params)
+    {}
+
+    virtual
+    bool
+    blend_type_supported(enum fastuidraw::PainterBlendShader::shader_type tp) const override
+    {
+      switch (tp)
+        {
+        case fastuidraw::PainterBlendShader::single_src:
+        case fastuidraw::PainterBlendShader::dual_src:
+          return true;
+
+        case fastuidraw::PainterBlendShader::framebuffer_fetch:
+          return m_params.fbf_blending_type() != fbf_blending_not_supported;
+
+        default:
+          FASTUIDRAWassert(!"Bad blending_type_t");
+          return false;
+        }
+    }
+
+  private:
+    UberShaderParams m_params;
+  };
+
+  /* The memory backing a NullDraw is recycled through a
+   * NullDrawPool to avoid allocating and freeing the (large)
+   * arrays on each call to PainterBackend::map_draw(). The
+   * memory is left uninitialized, as it would be with a mapped
+   * buffer of a 3D API, so that only the pages written to by
+   * PainterPacker are ever touched.
+   */
+  class NullDrawBuffers:fastuidraw::noncopyable
+  {
+  public:
+    NullDrawBuffers(unsigned int attribs, unsigned int indices,
+                    unsigned int data_blocks)
+    {
+      m_attributes = allocate<fastuidraw::PainterAttribute>(attribs);
+      m_header_attributes = allocate<uint32_t>(attribs);
+      m_indices = allocate<fastuidraw::PainterIndex>(indices);
+      m_store = allocate<fastuidraw::uvec4>(data_blocks);
+    }
+
+    ~NullDrawBuffers()
+    {
+      FASTUIDRAWfree(m_attributes.c_ptr());
+      FASTUIDRAWfree(m_header_attributes.c_ptr());
+      FASTUIDRAWfree(m_indices.c_ptr());
+      FASTUIDRAWfree(m_store.c_ptr());
+    }
+
+    fastuidraw::c_array<fastuidraw::PainterAttribute> m_attributes;
+    fastuidraw::c_array<uint32_t> m_header_attributes;
+    fastuidraw::c_array<fastuidraw::PainterIndex> m_indices;
+    fastuidraw::c_array<fastuidraw::uvec4> m_store;
+
+  private:
+    template<typename T>
+    static
+    fastuidraw::c_array<T>
+    allocate(unsigned int cnt)
+    {
+      void *p;
+
+      p = FASTUIDRAWmalloc(sizeof(T) * cnt);
+      return fastuidraw::c_array<T>(static_cast<T*>(p), cnt);
+    }
+  };
+
+  class NullDrawPool:
+    public fastuidraw::reference_counted<NullDrawPool>::non_concurrent
+  {
+  public:
+    NullDrawPool(unsigned int attribs, unsigned int indices,
+                 unsigned int data_blocks):
+      m_attribs(attribs),
+      m_indices(indices),
+      m_data_blocks(data_blocks)
+    {}
+
+    ~NullDrawPool()
+    {
+      for (NullDrawBuffers *p : m_free)
+        {
+          FASTUIDRAWdelete(p);
+        }
+    }
+
+    NullDrawBuffers*
+    acquire(void)
+    {
+      NullDrawBuffers *p;
+      if (m_free.empty())
+        {
+          p = FASTUIDRAWnew NullDrawBuffers(m_attribs, m_indices, m_data_blocks);
+        }
+      else
+        {
+          p = m_free.back();
+          m_free.pop_back();
+        }
+      return p;
+    }
+
+    void
+    release(NullDrawBuffers *p)
+    {
+      m_free.push_back(p);
+    }
+
+  private:
+    unsigned int m_attribs, m_indices, m_data_blocks;
+    std::vector<NullDrawBuffers*> m_free;
+  };
+
+  class NullDraw:public fastuidraw::PainterDraw
+  {
+  public:
+    NullDraw(fastuidraw::PainterBackend *backend,
+             const fastuidraw::reference_counted_ptr<NullDrawPool> &pool,
+             const fastuidraw::reference_counted_ptr<NullStats> &stats):
+      m_backend(backend),
+      m_pool(pool),
+      m_stats(stats)
+    {
+      m_buffers = m_pool->acquire();
+      m_attributes = m_buffers->m_attributes;
+      m_header_attributes = m_buffers->m_header_attributes;
+      m_indices = m_buffers->m_indices;
+      m_store = m_buffers->m_store;
+    }
+
+    ~NullDraw()
+    {
+      m_pool->release(m_buffers);
+    }
+
+    virtual
+    bool
+    draw_break(enum fastuidraw::PainterSurface::render_type_t,
+               const fastuidraw::PainterShaderGroup &old_shaders,
+               const fastuidraw::PainterShaderGroup &new_shaders,
+               unsigned int) override
+    {
+      /* mirror the GL backend: a change of blending requires
+       * a change of 3D API state and thus a draw break.
+       */
+      if (old_shaders.blend_mode() != new_shaders.blend_mode()
+          || old_shaders.blend_shader_type() != new_shaders.blend_shader_type())
+        {
+          m_stats->add(fastuidraw::PainterEngineNull::num_draw_breaks, 1);
+          return true;
+        }
+      return false;
+    }
+
+    virtual
+    bool
+    draw_break(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDrawBreakAction> &action,
+               unsigned int) override
+    {
+      FASTUIDRAWassert(action);
+      m_actions.push_back(action);
+      m_stats->add(fastuidraw::PainterEngineNull::num_actions, 1);
+      m_stats->add(fastuidraw::PainterEngineNull::num_draw_breaks, 1);
+      return true;
+    }
+
+    virtual
+    void
+    draw(void) const override
+    {
+      for (const auto &action : m_actions)
+        {
+          action->execute(m_backend);
+        }
+      m_stats->add(fastuidraw::PainterEngineNull::num_draws, 1);
+    }
+
+  protected:
+    virtual
+    void
+    unmap_implement(unsigned int attributes_written,
+                    unsigned int indices_written,
+                    unsigned int data_store_written) override
+    {
+      m_stats->add(fastuidraw::PainterEngineNull::num_attributes, attributes_written);
+      m_stats->add(fastuidraw::PainterEngineNull::num_indices, indices_written);
+      m_stats->add(fastuidraw::PainterEngineNull::num_data_store_blocks, data_store_written);
+    }
+
+  private:
+    fastuidraw::PainterBackend *m_backend;
+    fastuidraw::reference_counted_ptr<NullDrawPool> m_pool;
+    fastuidraw::reference_counted_ptr<NullStats> m_stats;
+    NullDrawBuffers *m_buffers;
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::PainterDrawBreakAction> > m_actions;
+  };
+
+  class NullSurface:public fastuidraw::PainterSurface
+  {
+  public:
+    NullSurface(fastuidraw::ivec2 dims, enum render_type_t render_type):
+      m_dimensions(dims),
+      m_render_type(render_type),
+      m_viewport(0, 0, dims.x(), dims.y()),
+      m_clear_color(0.0f, 0.0f, 0.0f, 0.0f)
+    {}
+
+    virtual
+    fastuidraw::reference_counted_ptr<const fastuidraw::Image>
+    image(fastuidraw::ImageAtlas &atlas) const override
+    {
+      if (!m_image)
+        {
+          m_image = FASTUIDRAWnew NullImage(atlas, m_dimensions.x(), m_dimensions.y(),
+                                            fastuidraw::Image::premultipied_rgba_format);
+        }
+      return m_image;
+    }
+
+    virtual
+    const Viewport&
+    viewport(void) const override
+    {
+      return m_viewport;
+    }
+
+    virtual
+    void
+    viewport(const Viewport &vwp) override
+    {
+      m_viewport = vwp;
+    }
+
+    virtual
+    const fastuidraw::vec4&
+    clear_color(void) const override
+    {
+      return m_clear_color;
+    }
+
+    virtual
+    void
+    clear_color(const fastuidraw::vec4 &c) override
+    {
+      m_clear_color = c;
+    }
+
+    virtual
+    fastuidraw::ivec2
+    dimensions(void) const override
+    {
+      return m_dimensions;
+    }
+
+    virtual
+    enum render_type_t
+    render_type(void) const override
+    {
+      return m_render_type;
+    }
+
+  private:
+    fastuidraw::ivec2 m_dimensions;
+    enum render_type_t m_render_type;
+    Viewport m_viewport;
+    fastuidraw::vec4 m_clear_color;
+    mutable fastuidraw::reference_counted_ptr<const fastuidraw::Image> m_image;
+  };
+
+  class PainterBackendNull:public fastuidraw::PainterBackend
+  {
+  public:
+    PainterBackendNull(unsigned int attribs_per_mapping,
+                       unsigned int indices_per_mapping,
+                       unsigned int data_blocks_per_mapping,
+                       const fastuidraw::reference_counted_ptr<NullStats> &stats):
+      m_attribs_per_mapping(attribs_per_mapping),
+      m_indices_per_mapping(indices_per_mapping),
+      m_stats(stats)
+    {
+      m_pool = FASTUIDRAWnew NullDrawPool(attribs_per_mapping,
+                                          indices_per_mapping,
+                                          data_blocks_per_mapping);
+    }
+
+    virtual
+    unsigned int
+    attribs_per_mapping(void) const override
+    {
+      return m_attribs_per_mapping;
+    }
+
+    virtual
+    unsigned int
+    indices_per_mapping(void) const override
+    {
+      return m_indices_per_mapping;
+    }
+
+    virtual
+    void
+    on_pre_draw(const fastuidraw::reference_counted_ptr<fastuidraw::PainterSurface>&,
+                bool, bool) override
+    {
+      m_stats->add(fastuidraw::PainterEngineNull::num_pre_draws, 1);
+    }
+
+    virtual
+    void
+    on_post_draw(void) override
+    {}
+
+    virtual
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+    bind_image(unsigned int,
+               const fastuidraw::reference_counted_ptr<const fastuidraw::Image>&) override
+    {
+      return nullptr;
+    }
+
+    virtual
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterDrawBreakAction>
+    bind_coverage_surface(const fastuidraw::reference_counted_ptr<fastuidraw::PainterSurface>&) override
+    {
+      return nullptr;
+    }
+
+    virtual
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw>
+    map_draw(void) override
+    {
+      m_stats->add(fastuidraw::PainterEngineNull::num_map_draws, 1);
+      return FASTUIDRAWnew NullDraw(this, m_pool, m_stats);
+    }
+
+    virtual
+    void
+    on_painter_begin(void) override
+    {}
+
+  private:
+    unsigned int m_attribs_per_mapping, m_indices_per_mapping;
+    fastuidraw::reference_counted_ptr<NullDrawPool> m_pool;
+    fastuidraw::reference_counted_ptr<NullStats> m_stats;
+  };
+
+  class PainterEngineNullPrivate
+  {
+  public:
+    enum
+      {
+        glyph_atlas_size = 1024 * 1024,
+        colorstop_atlas_width = 1024,
+        colorstop_atlas_layers = 32,
+      };
+
+    PainterEngineNullPrivate(unsigned int attribs_per_mapping,
+                             unsigned int indices_per_mapping,
+                             unsigned int data_blocks_per_mapping):
+      m_attribs_per_mapping(attribs_per_mapping),
+      m_indices_per_mapping(indices_per_mapping),
+      m_data_blocks_per_mapping(data_blocks_per_mapping)
+    {
+      m_stats = FASTUIDRAWnew NullStats();
+    }
+
+    static
+    fastuidraw::glsl::PainterShaderRegistrarGLSL::UberShaderParams
+    uber_params(void)
+    {
+      fastuidraw::glsl::PainterShaderRegistrarGLSL::UberShaderParams P;
+
+      P.preferred_blend_type(fastuidraw::PainterBlendShader::dual_src);
+      return P;
+    }
+
+    unsigned int m_attribs_per_mapping;
+    unsigned int m_indices_per_mapping;
+    unsigned int m_data_blocks_per_mapping;
+    fastuidraw::reference_counted_ptr<NullStats> m_stats;
+  };
+}
+
+////////////////////////////////////////////
+// fastuidraw::PainterEngineNull methods
+fastuidraw::reference_counted_ptr<fastuidraw::PainterEngineNull>
+fastuidraw::PainterEngineNull::
+create(unsigned int attribs_per_mapping,
+       unsigned int indices_per_mapping,
+       unsigned int data_blocks_per_mapping)
+{
+  return FASTUIDRAWnew PainterEngineNull(attribs_per_mapping,
+                                         indices_per_mapping,
+                                         data_blocks_per_mapping);
+}
+
+fastuidraw::PainterEngineNull::
+PainterEngineNull(unsigned int attribs_per_mapping,
+                  unsigned int indices_per_mapping,
+                  unsigned int data_blocks_per_mapping):
+  PainterEngine(FASTUIDRAWnew GlyphAtlas(FASTUIDRAWnew NullGlyphAtlasBackingStore(PainterEngineNullPrivate::glyph_atlas_size)),
+                FASTUIDRAWnew NullImageAtlas(),
+                FASTUIDRAWnew ColorStopAtlas(FASTUIDRAWnew NullColorStopBackingStore(PainterEngineNullPrivate::colorstop_atlas_width,
+                                                                                     PainterEngineNullPrivate::colorstop_atlas_layers)),
+                FASTUIDRAWnew NullShaderRegistrar(PainterEngineNullPrivate::uber_params()),
+                ConfigurationBase()
+                .number_context_textures(1)
+                .supports_bindless_texturing(false),
+                PainterEngineNullPrivate::uber_params().default_shaders())
+{
+  m_d = FASTUIDRAWnew PainterEngineNullPrivate(attribs_per_mapping,
+                                               indices_per_mapping,
+                                               data_blocks_per_mapping);
+}
+
+fastuidraw::PainterEngineNull::
+~PainterEngineNull()
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+}
+
+uint64_t
+fastuidraw::PainterEngineNull::
+stat(enum stat_t st) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  FASTUIDRAWassert(st < number_stats);
+  return d->m_stats->value(st);
+}
+
+void
+fastuidraw::PainterEngineNull::
+reset_stats(void)
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  d->m_stats->reset();
+}
+
+fastuidraw::c_string
+fastuidraw::PainterEngineNull::
+label(enum stat_t st)
+{
+#define EASY(X) case X: return #X
+
+  switch(st)
+    {
+      EASY(num_map_draws);
+      EASY(num_draws);
+      EASY(num_draw_breaks);
+      EASY(num_actions);
+      EASY(num_attributes);
+      EASY(num_indices);
+      EASY(num_data_store_blocks);
+      EASY(num_pre_draws);
+    default:
+      return "InvalidEnum";
+    }
+
+#undef EASY
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend>
+fastuidraw::PainterEngineNull::
+create_backend(void) const
+{
+  PainterEngineNullPrivate *d;
+  d = static_cast<PainterEngineNullPrivate*>(m_d);
+  return FASTUIDRAWnew PainterBackendNull(d->m_attribs_per_mapping,
+                                          d->m_indices_per_mapping,
+                                          d->m_data_blocks_per_mapping,
+                                          d->m_stats);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterSurface>
+fastuidraw::PainterEngineNull::
+create_surface(ivec2 dims,
+               enum PainterSurface::render_type_t render_type)
+{
+  return FASTUIDRAWnew NullSurface(dims, render_type);
+}
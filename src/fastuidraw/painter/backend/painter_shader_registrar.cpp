@@ -111,6 +111,13 @@ register_shader(PainterItemShader *shader)
        * otherwise we would attempt to double-lock the mutex
        */
       Mutex::Guard m(mutex());
+      if (shader->registered_to(*this))
+        {
+          /* another thread registered the shader
+           * while the lock was not held.
+           */
+          return;
+        }
       shader->set_group_of_sub_shader(*this, compute_item_sub_shader_group(shader));
     }
   else
@@ -118,6 +125,10 @@ register_shader(PainterItemShader *shader)
       Mutex::Guard m(mutex());
       PainterShader::Tag tag;
 
+      if (shader->registered_to(*this))
+        {
+          return;
+        }
       tag = absorb_item_shader(shader);
       shader->register_shader(tag, *this);
     }
@@ -140,6 +151,13 @@ register_shader(PainterItemCoverageShader *shader)
        * otherwise we would attempt to double-lock the mutex
        */
       Mutex::Guard m(mutex());
+      if (shader->registered_to(*this))
+        {
+          /* another thread registered the shader
+           * while the lock was not held.
+           */
+          return;
+        }
       shader->set_group_of_sub_shader(*this, compute_item_coverage_sub_shader_group(shader));
     }
   else
@@ -147,6 +165,10 @@ register_shader(PainterItemCoverageShader *shader)
       Mutex::Guard m(mutex());
       PainterShader::Tag tag;
 
+      if (shader->registered_to(*this))
+        {
+          return;
+        }
       tag = absorb_item_coverage_shader(shader);
       shader->register_shader(tag, *this);
     }
@@ -175,6 +197,13 @@ register_shader(PainterBlendShader *shader)
        * otherwise we would attempt to double-lock the mutex
        */
       Mutex::Guard m(mutex());
+      if (shader->registered_to(*this))
+        {
+          /* another thread registered the shader
+           * while the lock was not held.
+           */
+          return;
+        }
       shader->set_group_of_sub_shader(*this, compute_blend_sub_shader_group(shader));
     }
   else
@@ -182,6 +211,10 @@ register_shader(PainterBlendShader *shader)
       Mutex::Guard m(mutex());
       PainterShader::Tag tag;
 
+      if (shader->registered_to(*this))
+        {
+          return;
+        }
       tag = absorb_blend_shader(shader);
       shader->register_shader(tag, *this);
     }
@@ -204,6 +237,13 @@ register_shader(PainterBrushShader *shader)
        * otherwise we would attempt to double-lock the mutex
        */
       Mutex::Guard m(mutex());
+      if (shader->registered_to(*this))
+        {
+          /* another thread registered the shader
+           * while the lock was not held.
+           */
+          return;
+        }
       shader->set_group_of_sub_shader(*this, compute_custom_brush_sub_shader_group(shader));
     }
   else
@@ -211,6 +251,10 @@ register_shader(PainterBrushShader *shader)
       Mutex::Guard m(mutex());
       PainterShader::Tag tag;
 
+      if (shader->registered_to(*this))
+        {
+          return;
+        }
       tag = absorb_custom_brush_shader(shader);
       shader->register_shader(tag, *this);
     }
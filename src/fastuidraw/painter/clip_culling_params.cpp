@@ -0,0 +1,43 @@
+/*!
+ * \file clip_culling_params.cpp
+ * \brief file clip_culling_params.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/painter/clip_culling_params.hpp>
+#include <private/clip.hpp>
+
+////////////////////////////////////
+// fastuidraw::ClipCullingParams methods
+bool
+fastuidraw::ClipCullingParams::
+packed_culling(void)
+{
+  return detail::packed_clip_planes_enabled();
+}
+
+void
+fastuidraw::ClipCullingParams::
+packed_culling(bool v)
+{
+  detail::packed_clip_planes_enabled(v);
+}
+
+fastuidraw::c_string
+fastuidraw::ClipCullingParams::
+packed_culling_instruction_set(void)
+{
+  return detail::packed_clip_planes_instruction_set();
+}
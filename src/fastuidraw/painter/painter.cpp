@@ -18,6 +18,8 @@
 
 
 #include <vector>
+#include <list>
+#include <map>
 #include <bitset>
 #include <algorithm>
 #include <iterator>
@@ -36,6 +38,9 @@
 #include <private/bounding_box.hpp>
 #include <private/rect_atlas.hpp>
 #include <private/painter_backend/painter_packer.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+#include <private/painter_backend/painter_picture_private.hpp>
+#include <private/painter_backend/attribute_index_src_from_array.hpp>
 
 namespace
 {
@@ -164,6 +169,10 @@ namespace
   class ZDataCallBack:public fastuidraw::PainterPacker::DataCallBack
   {
   public:
+    ZDataCallBack(void):
+      m_occluder_id(0)
+    {}
+
     virtual
     void
     header_added(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &h,
@@ -184,39 +193,23 @@ namespace
 
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_actions;
 
+    /* when recording to a PainterCommandList, the ID of the
+     * occluder within the PainterCommandList
+     */
+    unsigned int m_occluder_id;
+
   private:
     fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_cmd;
     fastuidraw::reference_counted_ptr<ZDelayedAction> m_current;
   };
 
-  inline
-  bool
-  all_pts_culled_by_half_plane(fastuidraw::c_array<const fastuidraw::vec3> pts,
-                               const fastuidraw::vec3 &eq)
-  {
-    for (const fastuidraw::vec3 &pt : pts)
-      {
-        if (fastuidraw::dot(pt, eq) >= 0.0f)
-          {
-            return false;
-          }
-      }
-    return true;
-  }
-
   inline
   bool
   all_pts_culled_by_one_half_plane(fastuidraw::c_array<const fastuidraw::vec3> pts,
                                    const fastuidraw::PainterClipEquations &eq)
   {
-    for(int i = 0; i < 4; ++i)
-      {
-        if (all_pts_culled_by_half_plane(pts, eq.m_clip_equations[i]))
-          {
-            return true;
-          }
-      }
-    return false;
+    /* tests the points against all 4 clip equations at once */
+    return fastuidraw::detail::all_pts_culled_by_one_half_plane(eq.m_clip_equations, pts);
   }
 
   inline
@@ -341,6 +334,58 @@ namespace
       || fastuidraw::t_abs(matrix(2, 1)) > tol;
   }
 
+  /* Classification of the structure of the item matrix;
+   * unlike matrix_type_t which classifies how a matrix
+   * changes lengths, matrix_form_t only looks at which
+   * entries of the matrix are zero and is computed each
+   * time the item matrix changes so that the hot paths
+   * can take shortcuts for the common matrix forms.
+   */
+  enum matrix_form_t
+    {
+      identity_matrix_form,
+
+      /* translation only, i.e. the upper 2x2 is the
+       * identity scaled by m(2, 2)
+       */
+      translate_matrix_form,
+
+      /* m(0, 1) and m(1, 0) are zero and no perspective */
+      scale_translate_matrix_form,
+
+      /* no perspective */
+      affine_matrix_form,
+
+      /* m(2, 0) or m(2, 1) is not zero */
+      perspective_matrix_form,
+    };
+
+  enum matrix_form_t
+  compute_matrix_form(const fastuidraw::float3x3 &m)
+  {
+    /* the shortcuts drop the perspective row, so unlike
+     * matrix_has_perspective() the test must be exact.
+     */
+    if (m(2, 0) != 0.0f || m(2, 1) != 0.0f)
+      {
+        return perspective_matrix_form;
+      }
+
+    if (m(0, 1) != 0.0f || m(1, 0) != 0.0f)
+      {
+        return affine_matrix_form;
+      }
+
+    if (m(0, 0) != m(2, 2) || m(1, 1) != m(2, 2))
+      {
+        return scale_translate_matrix_form;
+      }
+
+    return (m(0, 2) != 0.0f || m(1, 2) != 0.0f || m(2, 2) != 1.0f) ?
+      translate_matrix_form :
+      identity_matrix_form;
+  }
+
   class DefaultGlyphRendererChooser:public fastuidraw::Painter::GlyphRendererChooser
   {
   public:
@@ -385,6 +430,7 @@ namespace
 
     ClipRectState(void):
       m_all_content_culled(false),
+      m_matrix_form(identity_matrix_form),
       m_item_matrix_transition_tricky(false),
       m_inverse_transpose_ready(true),
       m_item_matrix_singular_values_ready(false)
@@ -397,6 +443,20 @@ namespace
       const fastuidraw::float3x3 &m(item_matrix());
 
       FASTUIDRAWassert(in_pts.size() == out_pts.size());
+      if (!m_override_matrix_state && m_matrix_form <= scale_translate_matrix_form)
+        {
+          /* the terms dropped are zero, so this gives the
+           * same values as the full matrix-vector product.
+           */
+          for (unsigned int i = 0; i < in_pts.size(); ++i)
+            {
+              out_pts[i] = fastuidraw::vec3(m(0, 0) * in_pts[i].x() + m(0, 2),
+                                            m(1, 1) * in_pts[i].y() + m(1, 2),
+                                            m(2, 2));
+            }
+          return;
+        }
+
       for (unsigned int i = 0; i < in_pts.size(); ++i)
         {
           out_pts[i] = m * fastuidraw::vec3(in_pts[i].x(), in_pts[i].y(), 1.0f);
@@ -454,6 +514,13 @@ namespace
     enum matrix_type_t
     matrix_type(void) const;
 
+    enum matrix_form_t
+    matrix_form(void) const
+    {
+      FASTUIDRAWassert(!m_override_matrix_state);
+      return m_matrix_form;
+    }
+
     void //a negative value for singular_value_scaled indicates to recompute singular values
     item_matrix(const fastuidraw::float3x3 &v,
                 bool trick_transition, enum matrix_type_t M,
@@ -543,6 +610,19 @@ namespace
       m_clip_equations = v.unpacked_value();
     }
 
+    /* set the clipping rect and clip equations to the values
+     * a previous clip_in_rect() produced, see ClipCache.
+     */
+    void
+    clip_rect_and_equations(const clip_rect &R,
+                            const ExtendedPool::PackedClipEquations &v)
+    {
+      m_clip_rect = R;
+      m_all_content_culled = false;
+      m_item_matrix_transition_tricky = false;
+      clip_equations_state(v);
+    }
+
     bool
     item_matrix_transition_tricky(void) const
     {
@@ -587,6 +667,7 @@ namespace
 
   private:
     mutable enum matrix_type_t m_matrix_type;
+    enum matrix_form_t m_matrix_form;
     bool m_item_matrix_transition_tricky;
     fastuidraw::PainterItemMatrix m_item_matrix;
     mutable ExtendedPool::PackedItemMatrix m_item_matrix_state;
@@ -609,9 +690,10 @@ namespace
     /* steals the data it does.
      */
     explicit
-    occluder_stack_entry(std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > &pz)
+    occluder_stack_entry(ZDataCallBack &pz):
+      m_occluder_id(pz.m_occluder_id)
     {
-      m_set_occluder_z.swap(pz);
+      m_set_occluder_z.swap(pz.m_actions);
     }
 
     void
@@ -621,13 +703,20 @@ namespace
     /* action to execute on popping.
      */
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_set_occluder_z;
+
+    /* ID of occluder when recording to a PainterCommandList */
+    unsigned int m_occluder_id;
   };
 
   class state_stack_entry
   {
   public:
     state_stack_entry(void):
-      m_blend(nullptr)
+      m_occluder_stack_position(0),
+      m_blend(nullptr),
+      m_clip_rect_state_saved(false),
+      m_curve_flatness(0.0f),
+      m_deferred_coverage_buffer_depth(0)
     {}
 
     unsigned int m_occluder_stack_position;
@@ -635,13 +724,57 @@ namespace
     fastuidraw::BlendMode m_blend_mode;
     fastuidraw::range_type<unsigned int> m_clip_equation_series;
 
+    /* only holds a value if m_clip_rect_state_saved is
+     * true, see PainterPrivate::writeable_clip_rect_state()
+     */
     ClipRectState m_clip_rect_state;
+    bool m_clip_rect_state_saved;
     float m_curve_flatness;
 
     // checking
     unsigned int m_deferred_coverage_buffer_depth;
   };
 
+  /* The surfaces of EffectsBuffer and DeferredCoverageBuffer
+   * are pooled across frames. Their size is the useable size
+   * rounded up to a multiple of backing_size_granularity so
+   * that small changes of the size of the surface drawn to
+   * keep using the pooled surfaces.
+   */
+  fastuidraw::ivec2
+  backing_size_class(fastuidraw::ivec2 useable_size)
+  {
+    const int backing_size_granularity = 256;
+    fastuidraw::ivec2 return_value;
+
+    for (unsigned int c = 0; c < 2; ++c)
+      {
+        int v(fastuidraw::t_max(1, useable_size[c]));
+        return_value[c] = backing_size_granularity * ((v + backing_size_granularity - 1) / backing_size_granularity);
+      }
+    return return_value;
+  }
+
+  /* Returns true if the pooled surfaces of size backing_size
+   * cannot hold useable_size or are more than twice as large
+   * as needed. The shrink test compares against the size class
+   * of twice the useable size; comparing against twice the
+   * useable size directly would always fail for a useable size
+   * smaller than half of backing_size_granularity and drop the
+   * pool on every frame.
+   */
+  bool
+  backing_size_needs_reset(fastuidraw::ivec2 backing_size,
+                           fastuidraw::ivec2 useable_size)
+  {
+    fastuidraw::ivec2 max_size(backing_size_class(2 * useable_size));
+
+    return useable_size.x() > backing_size.x()
+      || useable_size.y() > backing_size.y()
+      || backing_size.x() > max_size.x()
+      || backing_size.y() > max_size.y();
+  }
+
   class BufferRect
   {
   public:
@@ -679,7 +812,8 @@ namespace
       m_packer(packer),
       m_surface(surface),
       m_image(image),
-      m_rect_atlas(useable_size)
+      m_rect_atlas(useable_size),
+      m_cached(false)
     {}
 
     /* the PainterPacker used */
@@ -696,6 +830,12 @@ namespace
 
     /* the atlas to track what regions are free */
     fastuidraw::detail::RectAtlas m_rect_atlas;
+
+    /* true if the EffectsBuffer is the surface of a cached
+     * layer, in which case it is not returned to the pool
+     * by EffectsLayerFactory::begin().
+     */
+    bool m_cached;
   };
 
   class EffectsLayer
@@ -740,12 +880,14 @@ namespace
   public:
     EffectsLayerFactory(void):
       m_current_backing_size(0, 0),
-      m_current_backing_useable_size(0, 0)
+      m_current_backing_useable_size(0, 0),
+      m_frame(0)
     {}
 
     /* clears each of the m_rect_atlas within the pool;
      * if the surface_sz changes then also clears the
-     * pool entirely.
+     * pool entirely. Drops the cached layers that were
+     * not used in the previous frame.
      */
     void
     begin(fastuidraw::PainterSurface &surface);
@@ -758,6 +900,44 @@ namespace
           const fastuidraw::Rect &normalized_rect,
           PainterPrivate *d);
 
+    /* creates a EffectsLayer value for the cached layer
+     * named by ID. If the content of the cached layer can
+     * be used, *use_cached is set to true and the returned
+     * value is only good for blitting the cached content.
+     * Otherwise, the cached layer gets a surface of its own
+     * which is rendered to this frame and kept for later
+     * frames.
+     */
+    EffectsLayer
+    fetch_cached(unsigned int ID, unsigned int depth,
+                 const fastuidraw::Rect &normalized_rect,
+                 PainterPrivate *d, bool *use_cached);
+
+    /* returns true if fetch_cached() was already called
+     * for ID since the last call to begin().
+     */
+    bool
+    cached_fetched_this_frame(unsigned int ID) const
+    {
+      std::map<unsigned int, CachedLayer>::const_iterator iter;
+
+      iter = m_cached_layers.find(ID);
+      return iter != m_cached_layers.end()
+        && iter->second.m_last_used_frame == m_frame;
+    }
+
+    void
+    invalidate_cached(unsigned int ID)
+    {
+      m_cached_layers.erase(ID);
+    }
+
+    void
+    invalidate_all_cached(void)
+    {
+      m_cached_layers.clear();
+    }
+
     /* issues PainterPacker::end() in the correct order
      * on all elements that were fetched within the
      * begin/end pair.
@@ -768,10 +948,39 @@ namespace
   private:
     typedef std::vector<fastuidraw::reference_counted_ptr<EffectsBuffer> > PerActiveDepth;
 
+    class CachedLayer
+    {
+    public:
+      CachedLayer(void):
+        m_last_used_frame(0)
+      {}
+
+      fastuidraw::reference_counted_ptr<EffectsBuffer> m_buffer;
+      fastuidraw::RectT<int> m_pixel_rect;
+      fastuidraw::ivec2 m_viewport_dimensions;
+      unsigned int m_last_used_frame;
+    };
+
+    fastuidraw::reference_counted_ptr<EffectsBuffer>
+    create_buffer(fastuidraw::ivec2 backing_size,
+                  fastuidraw::ivec2 useable_size,
+                  PainterPrivate *d);
+
+    void
+    begin_buffer(unsigned int depth, EffectsBuffer *TB, PainterPrivate *d);
+
+    EffectsLayer
+    make_layer(const EffectsBuffer &TB, fastuidraw::ivec2 rect,
+               const BufferRect &buffer_rect, PainterPrivate *d);
+
     fastuidraw::PainterSurface::Viewport m_effects_buffer_viewport;
     fastuidraw::ivec2 m_current_backing_size, m_current_backing_useable_size;
     std::vector<fastuidraw::reference_counted_ptr<EffectsBuffer> > m_unused_buffers;
     std::vector<PerActiveDepth> m_per_active_depth;
+    std::map<unsigned int, CachedLayer> m_cached_layers;
+
+    /* incremented by begin(), starts at 1 for the first frame */
+    unsigned int m_frame;
   };
 
   class DeferredCoverageBuffer:
@@ -1010,26 +1219,38 @@ namespace
   class ClipEquationStore
   {
   public:
-    ClipEquationStore(void)
+    ClipEquationStore(void):
+      m_revision(0),
+      m_revision_counter(0)
     {}
 
+    /* push() does not copy the current clipping; the copy
+     * is made by prepare_write() only when the clipping is
+     * changed before the matching pop(). Thus save/restore
+     * pairs that do not change the clipping do not copy it.
+     */
     void
     push(void)
     {
-      m_clip.push();
-      m_poly.push();
-
-      m_bb_stack.push_back(m_current_bb);
+      m_saved.push_back(false);
     }
 
     void
     pop(void)
     {
-      m_clip.pop();
-      m_poly.pop();
+      FASTUIDRAWassert(!m_saved.empty());
+      if (m_saved.back())
+        {
+          m_clip.pop();
+          m_poly.pop();
 
-      m_current_bb = m_bb_stack.back();
-      m_bb_stack.pop_back();
+          m_current_bb = m_bb_stack.back();
+          m_bb_stack.pop_back();
+
+          m_revision = m_revision_stack.back();
+          m_revision_stack.pop_back();
+        }
+      m_saved.pop_back();
     }
 
     void
@@ -1041,6 +1262,17 @@ namespace
     void
     reset_current_to_rect(const fastuidraw::Rect &rect_normalized_device_coords);
 
+    void
+    set_current(fastuidraw::c_array<const fastuidraw::vec3> clip,
+                fastuidraw::c_array<const fastuidraw::vec3> poly,
+                const fastuidraw::BoundingBox<float> &bb)
+    {
+      prepare_write();
+      m_clip.set_current(clip);
+      m_poly.set_current(poly);
+      m_current_bb = bb;
+    }
+
     void
     clear(void)
     {
@@ -1048,7 +1280,10 @@ namespace
       m_poly.clear();
 
       m_bb_stack.clear();
+      m_revision_stack.clear();
+      m_saved.clear();
       m_current_bb = fastuidraw::BoundingBox<float>();
+      m_revision = ++m_revision_counter;
     }
 
     fastuidraw::c_array<const fastuidraw::vec3>
@@ -1069,7 +1304,38 @@ namespace
       return m_current_bb;
     }
 
+    /* returns true if the current clipping region is
+     * exactly the rect of current_bb().
+     */
+    bool
+    current_is_bb(void) const;
+
+    /* Returns a value that changes whenever the current
+     * clipping changes; the value is restored by pop()
+     * and a value is never reused by a different clipping
+     * within the lifetime of the ClipEquationStore.
+     */
+    unsigned int
+    revision(void) const
+    {
+      return m_revision;
+    }
+
   private:
+    void
+    prepare_write(void)
+    {
+      if (!m_saved.empty() && !m_saved.back())
+        {
+          m_clip.push();
+          m_poly.push();
+          m_bb_stack.push_back(m_current_bb);
+          m_revision_stack.push_back(m_revision);
+          m_saved.back() = true;
+        }
+      m_revision = ++m_revision_counter;
+    }
+
     class Vec3Stack
     {
     public:
@@ -1130,6 +1396,169 @@ namespace
 
     fastuidraw::BoundingBox<float> m_current_bb;
     std::vector<fastuidraw::BoundingBox<float> > m_bb_stack;
+
+    unsigned int m_revision, m_revision_counter;
+    std::vector<unsigned int> m_revision_stack;
+
+    /* one entry per push(), true if the clipping at the
+     * time of the push() was copied to m_clip, m_poly
+     * and m_bb_stack.
+     */
+    std::vector<bool> m_saved;
+  };
+
+  /* A ClipCache holds the results of Painter::clip_in_rect()
+   * (and thus of the clip_in_rounded_rect() and clip_in_path()
+   * which use it) so that entering the same clipping again,
+   * within a frame or in a later frame, reuses the clip
+   * polygon, clip equations and the packed PainterClipEquations
+   * instead of computing them again. An entry is keyed by
+   * the rect, the item matrix and the clipping in place
+   * before the call; the key is made from the bit patterns
+   * of the floats so that only exact matches hit. Only those
+   * results that do not cull all content are cached. An entry
+   * not used in the current or previous frame is removed by
+   * begin_frame().
+   */
+  class ClipCache:fastuidraw::noncopyable
+  {
+  public:
+    class Entry
+    {
+    public:
+      std::vector<fastuidraw::vec3> m_clip, m_poly;
+      fastuidraw::BoundingBox<float> m_bb;
+      clip_rect m_clip_rect;
+      ExtendedPool::PackedClipEquations m_clip_equations;
+
+      /* if not all true, the complement of the half planes
+       * of the clip equations before the clip_in_rect() that
+       * are not marked are drawn as occluders.
+       */
+      std::bitset<4> m_skip_occluder;
+      unsigned int m_last_used_frame;
+    };
+
+    ClipCache(void):
+      m_frame(0)
+    {}
+
+    void
+    begin_frame(void);
+
+    /* Returns the entry for clipping against rect with the
+     * given current clipping state or nullptr if there is no
+     * such entry; in that case the key is kept so that the
+     * next call to add() adds the entry for it.
+     */
+    const Entry*
+    fetch(const fastuidraw::Rect &rect,
+          const ClipRectState &clip_rect_state,
+          const ClipEquationStore &clip_store);
+
+    /* Adds an entry for the key of the last call to
+     * fetch() whose values are the clipping state after
+     * the clip_in_rect() computed them.
+     */
+    void
+    add(const ClipRectState &clip_rect_state,
+        const ClipEquationStore &clip_store,
+        ExtendedPool &pool,
+        std::bitset<4> skip_occluder);
+
+  private:
+    typedef std::vector<uint32_t> Key;
+
+    void
+    add_to_key(float f)
+    {
+      uint32_t v;
+
+      std::memcpy(&v, &f, sizeof(v));
+      m_key.push_back(v);
+    }
+
+    void
+    add_to_key(const fastuidraw::vec3 &v)
+    {
+      add_to_key(v.x());
+      add_to_key(v.y());
+      add_to_key(v.z());
+    }
+
+    unsigned int m_frame;
+    Key m_key;
+    std::map<Key, Entry> m_entries;
+  };
+
+  /* A BrushInternCache maps the packed data (and bound images)
+   * of brush values to PainterPackedValue objects so that when
+   * a Painter needs to pack an unpacked brush value, an equal
+   * brush value packed before is reused instead of allocating
+   * and packing a new PainterPackedValue. At most max_entries
+   * values are kept; when full, the least recently used value
+   * is released. Note that the cache holds references to the
+   * images of the brushes it holds, so an entry not used in
+   * the current or previous frame is removed by begin_frame().
+   */
+  class BrushInternCache:fastuidraw::noncopyable
+  {
+  public:
+    typedef fastuidraw::PainterBrushShaderData BrushData;
+    typedef fastuidraw::PainterPackedValue<BrushData> PackedBrush;
+
+    enum
+      {
+        max_entries = 256
+      };
+
+    BrushInternCache(void):
+      m_frame(0)
+    {}
+
+    void
+    begin_frame(void);
+
+    /* If brush has an unpacked value, set it to the interned
+     * packed value equal to it, creating it from pool if it is
+     * not present in the cache. Increments the stats for
+     * hits and misses.
+     */
+    void
+    intern(fastuidraw::PainterData::brush_value &brush,
+           fastuidraw::PainterPackedValuePool &pool,
+           fastuidraw::c_array<unsigned int> stats);
+
+  private:
+    class Entry
+    {
+    public:
+      Entry(uint32_t hash, const PackedBrush &value, unsigned int frame):
+        m_hash(hash),
+        m_value(value),
+        m_last_used_frame(frame)
+      {}
+
+      uint32_t m_hash;
+      PackedBrush m_value;
+      unsigned int m_last_used_frame;
+    };
+
+    typedef std::list<Entry> EntryList;
+    typedef std::multimap<uint32_t, EntryList::iterator> EntryMap;
+
+    bool
+    matches(const Entry &entry,
+            fastuidraw::c_array<const fastuidraw::reference_counted_ptr<const fastuidraw::Image> > images) const;
+
+    void
+    remove_from_map(EntryList::iterator entry);
+
+    /* most recently used entry is at the front */
+    EntryList m_entries;
+    EntryMap m_map;
+    std::vector<fastuidraw::uvec4> m_packed;
+    unsigned int m_frame;
   };
 
   class RoundedRectTransformations
@@ -1332,11 +1761,124 @@ namespace
     int m_fuzz_increment_z;
   };
 
+  /* Attribute and index data of many convex polygons packed
+   * into chunks so that they can be sent in a single call to
+   * draw_generic(); the chunks are kept small enough that each
+   * fits within a single PainterDraw.
+   */
+  class ChunkedPolygonData:fastuidraw::noncopyable
+  {
+  public:
+    enum
+      {
+        max_attribs_per_chunk = 1024
+      };
+
+    void
+    clear(void)
+    {
+      m_attribs.clear();
+      m_indices.clear();
+      m_chunk_ranges.clear();
+      m_attrib_chunks.clear();
+      m_index_chunks.clear();
+    }
+
+    void
+    add(fastuidraw::c_array<const fastuidraw::PainterAttribute> attribs,
+        fastuidraw::c_array<const fastuidraw::PainterIndex> indices)
+    {
+      unsigned int offset;
+
+      if (m_chunk_ranges.empty()
+          || m_attribs.size() - m_chunk_ranges.back().first.m_begin + attribs.size() > max_attribs_per_chunk)
+        {
+          begin_chunk();
+        }
+
+      offset = m_attribs.size() - m_chunk_ranges.back().first.m_begin;
+      m_attribs.insert(m_attribs.end(), attribs.begin(), attribs.end());
+      for (fastuidraw::PainterIndex idx : indices)
+        {
+          m_indices.push_back(idx + offset);
+        }
+      m_chunk_ranges.back().first.m_end = m_attribs.size();
+      m_chunk_ranges.back().second.m_end = m_indices.size();
+    }
+
+    bool
+    empty(void) const
+    {
+      return m_attribs.empty();
+    }
+
+    /* Must be called after the last add() and before
+     * attrib_chunks() or index_chunks() are used.
+     */
+    void
+    finalize(void)
+    {
+      using namespace fastuidraw;
+
+      c_array<const PainterAttribute> attribs(make_c_array(m_attribs));
+      c_array<const PainterIndex> indices(make_c_array(m_indices));
+
+      m_attrib_chunks.clear();
+      m_index_chunks.clear();
+      for (const auto &R : m_chunk_ranges)
+        {
+          m_attrib_chunks.push_back(attribs.sub_array(R.first));
+          m_index_chunks.push_back(indices.sub_array(R.second));
+        }
+    }
+
+    fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterAttribute> >
+    attrib_chunks(void) const
+    {
+      return fastuidraw::make_c_array(m_attrib_chunks);
+    }
+
+    fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterIndex> >
+    index_chunks(void) const
+    {
+      return fastuidraw::make_c_array(m_index_chunks);
+    }
+
+  private:
+    void
+    begin_chunk(void)
+    {
+      fastuidraw::range_type<unsigned int> a(m_attribs.size(), m_attribs.size());
+      fastuidraw::range_type<unsigned int> i(m_indices.size(), m_indices.size());
+      m_chunk_ranges.push_back(std::make_pair(a, i));
+    }
+
+    std::vector<fastuidraw::PainterAttribute> m_attribs;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<std::pair<fastuidraw::range_type<unsigned int>,
+                          fastuidraw::range_type<unsigned int> > > m_chunk_ranges;
+    std::vector<fastuidraw::c_array<const fastuidraw::PainterAttribute> > m_attrib_chunks;
+    std::vector<fastuidraw::c_array<const fastuidraw::PainterIndex> > m_index_chunks;
+  };
+
+  class RectBatchWorkRoom:fastuidraw::noncopyable
+  {
+  public:
+    /* the convex polygons, in logical coordinates, to draw;
+     * polygon P is m_pts[m_polygons[P].m_begin, m_polygons[P].m_end)
+     */
+    std::vector<fastuidraw::vec2> m_pts;
+    std::vector<fastuidraw::range_type<unsigned int> > m_polygons;
+
+    ChunkedPolygonData m_fill;
+    ChunkedPolygonData m_aa_fuzz;
+  };
+
   class EffectStrokerWorkRoom:public fastuidraw::StrokingAttributeWriter
   {
   public:
     fastuidraw::PathEffect::Storage m_storage;
-    fastuidraw::PartitionedTessellatedPath::SubsetSelection m_selection;
+    fastuidraw::PartitionedTessellatedPath::SubsetSelection m_scratch_selection;
   };
 
   class NonEffectStroker:public fastuidraw::PainterAttributeWriter
@@ -1422,7 +1964,12 @@ namespace
     fastuidraw::vecN<fastuidraw::PainterItemShader*, number_drawing_types> m_shader;
     bool m_requires_coverage_buffer;
 
-    fastuidraw::StrokedPath::SubsetSelection m_selection;
+    /* m_selection points to the selection, m_scratch_selection is
+     * used only when PainterPrivate::cached_select_subsets() does
+     * not return a cached selection.
+     */
+    const fastuidraw::StrokedPath::SubsetSelection *m_selection;
+    fastuidraw::StrokedPath::SubsetSelection m_scratch_selection;
     const fastuidraw::PainterAttributeData *m_join_attribute_data;
     std::vector<unsigned int> m_join_chunks;
     const fastuidraw::PainterAttributeData *m_cap_attribute_data;
@@ -1498,27 +2045,154 @@ namespace
     std::vector<int> m_empty_adjusts;
   };
 
-  class ComputeClipIntersectRectWorkRoom:fastuidraw::noncopyable
+  /* An OpaqueRegion is a rect, in normalized device coordinates,
+   * covered by opaque content of depth value at least m_z.
+   */
+  class OpaqueRegion
   {
   public:
-    fastuidraw::vecN<std::vector<fastuidraw::vec3>, 2> m_scratch;
+    fastuidraw::Rect m_rect;
+    int m_z;
   };
 
-  class PainterWorkRoom:fastuidraw::noncopyable
+  class CommandListWorkRoom:fastuidraw::noncopyable
   {
   public:
-    ClipperWorkRoom m_clipper;
-    PolygonWorkRoom m_polygon;
-    NonEffectStroker m_non_effect_stroker;
-    EffectStrokerWorkRoom m_effect_stroker;
-    FillSubsetWorkRoom m_fill_subset;
-    OpaqueFillWorkRoom m_fill_opaque;
+    std::vector<fastuidraw::reference_counted_ptr<ZDataCallBack> > m_occluders;
+    std::vector<bool> m_culled;
+    std::vector<OpaqueRegion> m_opaque_regions;
+  };
+
+  /* While recording, the drawing methods of Painter that know
+   * more about what their draws affect than the clipping set an
+   * OcclusionHint for the duration of the draws; the values are
+   * in normalized device coordinates.
+   */
+  class OcclusionHint:fastuidraw::noncopyable
+  {
+  public:
+    OcclusionHint(void):
+      m_opaque_candidate(false)
+    {}
+
+    /* if non-empty, contains what the draws affect */
+    fastuidraw::BoundingBox<float> m_bounds;
+
+    /* if m_opaque_candidate is true, the draws with the
+     * default fill shader cover m_opaque_rect, thus they
+     * are opaque if the brush and blending are.
+     */
+    bool m_opaque_candidate;
+    fastuidraw::Rect m_opaque_rect;
+  };
+
+  class OcclusionHintScope:fastuidraw::noncopyable
+  {
+  public:
+    OcclusionHintScope(const OcclusionHint *&dst, const OcclusionHint &hint):
+      m_dst(dst),
+      m_prev(dst)
+    {
+      m_dst = &hint;
+    }
+
+    ~OcclusionHintScope()
+    {
+      m_dst = m_prev;
+    }
+
+  private:
+    const OcclusionHint *&m_dst;
+    const OcclusionHint *m_prev;
+  };
+
+  /* A PictureTransform maps the item matrices and clip equations
+   * recorded in a PainterPicture to those of the Painter that
+   * draws the picture. The transformation is applied in clip
+   * coordinates: a recorded item matrix R becomes m_transform * R
+   * and recorded clip equations are multiplied by the inverse
+   * transpose of m_transform. Recorded draws whose clip equations
+   * are those of the recording viewport take the current clipping
+   * of the Painter instead.
+   */
+  class PictureTransform:fastuidraw::noncopyable
+  {
+  public:
+    fastuidraw::float3x3 m_transform;
+    fastuidraw::float3x3 m_transform_inverse_transpose;
+    const fastuidraw::detail::PackedValuePoolBase::ElementBase *m_base_clip;
+    ExtendedPool::PackedClipEquations m_current_clip;
+  };
+
+  /* Returns the bounding box, clamped to [-1, 1]x[-1, 1], of
+   * the image of a rect in normalized coordinates under a
+   * transformation in clip coordinates.
+   */
+  fastuidraw::Rect
+  transform_normalized_rect(const fastuidraw::float3x3 &M,
+                            const fastuidraw::Rect &rect)
+  {
+    using namespace fastuidraw;
+
+    Rect return_value;
+    vecN<vec3, 4> pts;
+
+    pts[0] = M * vec3(rect.m_min_point.x(), rect.m_min_point.y(), 1.0f);
+    pts[1] = M * vec3(rect.m_min_point.x(), rect.m_max_point.y(), 1.0f);
+    pts[2] = M * vec3(rect.m_max_point.x(), rect.m_max_point.y(), 1.0f);
+    pts[3] = M * vec3(rect.m_max_point.x(), rect.m_min_point.y(), 1.0f);
+
+    return_value.m_min_point = vec2(1.0f, 1.0f);
+    return_value.m_max_point = vec2(-1.0f, -1.0f);
+    for (const vec3 &q : pts)
+      {
+        vec2 v;
+
+        if (q.z() <= 0.0f)
+          {
+            return Rect()
+              .min_point(vec2(-1.0f, -1.0f))
+              .max_point(vec2(1.0f, 1.0f));
+          }
+        v = vec2(q.x(), q.y()) / q.z();
+        return_value.m_min_point.x() = t_min(return_value.m_min_point.x(), v.x());
+        return_value.m_min_point.y() = t_min(return_value.m_min_point.y(), v.y());
+        return_value.m_max_point.x() = t_max(return_value.m_max_point.x(), v.x());
+        return_value.m_max_point.y() = t_max(return_value.m_max_point.y(), v.y());
+      }
+
+    for (int i = 0; i < 2; ++i)
+      {
+        return_value.m_min_point[i] = t_max(-1.0f, return_value.m_min_point[i]);
+        return_value.m_max_point[i] = t_min(1.0f, return_value.m_max_point[i]);
+      }
+    return return_value;
+  }
+
+  class ComputeClipIntersectRectWorkRoom:fastuidraw::noncopyable
+  {
+  public:
+    fastuidraw::vecN<std::vector<fastuidraw::vec3>, 2> m_scratch;
+  };
+
+  class PainterWorkRoom:fastuidraw::noncopyable
+  {
+  public:
+    ClipperWorkRoom m_clipper;
+    PolygonWorkRoom m_polygon;
+    RectBatchWorkRoom m_rect_batch;
+    NonEffectStroker m_non_effect_stroker;
+    EffectStrokerWorkRoom m_effect_stroker;
+    FillSubsetWorkRoom m_fill_subset;
+    OpaqueFillWorkRoom m_fill_opaque;
     AntiAliasFillWorkRoom m_fill_aa_fuzz;
     GlyphSequenceWorkRoom m_glyph;
     RoundedRectWorkRoom m_rounded_rect;
     GenericLayeredWorkRoom m_generic_layered;
+    CommandListWorkRoom m_command_list;
     ComputeClipIntersectRectWorkRoom m_compute_clip_intersect_rect;
     fastuidraw::PainterEffectBrushParams m_fx_brush_params;
+    std::vector<float> m_selection_params;
   };
 
   class EffectsStackEntry
@@ -1528,6 +2202,131 @@ namespace
     unsigned int m_state_stack_size;
   };
 
+  /* The cached subset selection of a FilledPath; in addition to
+   * the selected subsets, holds the chunks computed from them by
+   * PainterPrivate::fill_path_compute_opaque_chunks() for the
+   * fill rule m_chunks_fill_rule.
+   */
+  class FilledPathSelection:fastuidraw::noncopyable
+  {
+  public:
+    std::vector<unsigned int> m_subsets;
+    enum fastuidraw::Painter::fill_rule_t m_chunks_fill_rule;
+    OpaqueFillWorkRoom m_chunks;
+    bool m_volatile;
+  };
+
+  /* A SubsetSelectionCache holds, for each path of type T drawn
+   * by the Painter, the last subset selection of type S made for
+   * it. When a path is drawn again with the same clipping, item
+   * matrix and selection parameters (typically every frame of a
+   * static view), the selection is reused instead of walking the
+   * hierarchy of the path again. Validating an entry compares the
+   * revision of the ClipEquationStore first and only compares the
+   * clip equations themselves when the revision is different, for
+   * example in the next frame. An entry holds a reference to its
+   * path so that the path's address cannot be reused while the
+   * entry exists; entries not used in the current or previous
+   * frame are removed by begin_frame().
+   */
+  template<typename T, typename S>
+  class SubsetSelectionCache:fastuidraw::noncopyable
+  {
+  public:
+    class Entry:fastuidraw::noncopyable
+    {
+    public:
+      fastuidraw::reference_counted_ptr<const T> m_path;
+      unsigned int m_clip_revision;
+      std::vector<fastuidraw::vec3> m_clip;
+      std::vector<float> m_params;
+      unsigned int m_last_used_frame;
+
+      /* true if the selection was recomputed for a path
+       * already drawn in the same frame, i.e. the path is
+       * drawn several times per frame with different
+       * clipping or transformation. For such a path, the
+       * derived values are not worth caching.
+       */
+      bool m_volatile;
+
+      S m_selection;
+
+      /* the bounding box in normalized device coordinates of
+       * the selection, only valid if m_bb_ready is true.
+       */
+      fastuidraw::BoundingBox<float> m_bb;
+      bool m_bb_ready;
+    };
+
+    SubsetSelectionCache(void):
+      m_frame(0)
+    {}
+
+    void
+    begin_frame(void)
+    {
+      ++m_frame;
+      for (auto iter = m_entries.begin(); iter != m_entries.end();)
+        {
+          if (iter->second.m_last_used_frame + 1u < m_frame)
+            {
+              iter = m_entries.erase(iter);
+            }
+          else
+            {
+              ++iter;
+            }
+        }
+    }
+
+    /* Returns the entry for path. If the entry holds the selection
+     * for the current clipping and the passed parameters (which
+     * include the item matrix) returns true; otherwise the entry
+     * is updated to the current values and returns false, in which
+     * case the caller must recompute Entry::m_selection.
+     */
+    bool
+    fetch(const T &path, const ClipEquationStore &clip_store,
+          fastuidraw::c_array<const float> params, Entry **out_entry)
+    {
+      using namespace fastuidraw;
+
+      Entry &E(m_entries[&path]);
+      c_array<const vec3> clip(clip_store.current());
+      bool params_match, clip_match, used_this_frame;
+
+      *out_entry = &E;
+      used_this_frame = E.m_path && E.m_last_used_frame == m_frame;
+      E.m_last_used_frame = m_frame;
+      params_match = E.m_path
+        && E.m_params.size() == params.size()
+        && std::equal(params.begin(), params.end(), E.m_params.begin());
+
+      clip_match = params_match
+        && (E.m_clip_revision == clip_store.revision()
+            || (E.m_clip.size() == clip.size()
+                && std::equal(clip.begin(), clip.end(), E.m_clip.begin())));
+
+      E.m_clip_revision = clip_store.revision();
+      if (clip_match)
+        {
+          return true;
+        }
+
+      E.m_path = &path;
+      E.m_clip.assign(clip.begin(), clip.end());
+      E.m_params.assign(params.begin(), params.end());
+      E.m_bb_ready = false;
+      E.m_volatile = used_this_frame;
+      return false;
+    }
+
+  private:
+    unsigned int m_frame;
+    std::map<const T*, Entry> m_entries;
+  };
+
   class PainterPrivate
   {
   public:
@@ -1612,6 +2411,117 @@ namespace
       m_current_z += draw_generic(shader, draw, src, m_current_z);
     }
 
+    int
+    record_generic(fastuidraw::PainterItemShader *shader,
+                   const fastuidraw::PainterData &draw,
+                   const fastuidraw::PainterAttributeWriter &src,
+                   int z);
+
+    /* make the values of draw packed, using the interned
+     * packed value for the brush.
+     */
+    void
+    make_packed(fastuidraw::PainterData &draw)
+    {
+      m_brush_intern_cache.intern(draw.m_brush, m_pool, m_stats);
+      draw.make_packed(m_pool);
+    }
+
+    /* if picture is non-null, the recorded item matrices and clip
+     * equations are mapped by it.
+     */
+    /* computes the occlusion information of a draw being recorded */
+    void
+    compute_occlusion(fastuidraw::PainterItemShader *shader,
+                      const fastuidraw::PainterData &draw,
+                      fastuidraw::detail::PainterCommandListPrivate::Occlusion *out);
+
+    /* if the logical polygon pts is a rect and the current
+     * transformation maps it to a rect, sets *out to that
+     * rect in normalized device coordinates and returns true.
+     */
+    bool
+    compute_opaque_rect(fastuidraw::c_array<const fastuidraw::vec2> pts,
+                        fastuidraw::Rect *out) const;
+
+    /* sets m_work_room.m_command_list.m_culled[i] to true if
+     * the i'th command of list is a draw hidden by opaque draws
+     * after it or outside of the damage rects.
+     */
+    void
+    compute_occlusion_culled(const fastuidraw::detail::PainterCommandListPrivate &list,
+                             const PictureTransform *picture);
+
+    void
+    draw_command_list(const fastuidraw::detail::PainterCommandListPrivate &list,
+                      const PictureTransform *picture = nullptr);
+
+    /* sets the damage rects, clips to their union
+     * and clears them if clear_color is non-null.
+     */
+    void
+    begin_damage(fastuidraw::Painter *p,
+                 fastuidraw::c_array<const fastuidraw::Rect> damage_rects,
+                 const fastuidraw::vec4 *clear_color);
+
+    /* clips out the region of bb not covered by m_damage_rects
+     * with a single occluder.
+     */
+    void
+    clip_out_damage_gaps(fastuidraw::Painter *p,
+                         const fastuidraw::BoundingBox<float> &bb);
+
+    /* returns true, and increments the stat, if a draw with the
+     * given bounds in normalized device coordinates misses all of
+     * the damage rects. An empty box is taken as unknown bounds.
+     */
+    bool
+    damage_culled(const fastuidraw::BoundingBox<float> &bb);
+
+    /* the drawing methods compute the bounds of their draws
+     * only if something consumes them.
+     */
+    bool
+    needs_draw_bounds(void) const
+    {
+      return m_recording || !m_damage_rects.empty();
+    }
+
+    /* Returns m_clip_rect_state for changing it. The first
+     * change after a save() copies the value to the top of
+     * m_state_stack so that restore() only needs to copy
+     * the value back if it was changed.
+     */
+    ClipRectState&
+    writeable_clip_rect_state(void)
+    {
+      if (!m_state_stack.empty() && !m_state_stack.back().m_clip_rect_state_saved)
+        {
+          m_state_stack.back().m_clip_rect_state = m_clip_rect_state;
+          m_state_stack.back().m_clip_rect_state_saved = true;
+        }
+      return m_clip_rect_state;
+    }
+
+    bool
+    draw_picture(fastuidraw::Painter *p,
+                 const fastuidraw::detail::PainterPicturePrivate &picture,
+                 const fastuidraw::float3x3 &matrix);
+
+    void
+    add_occluder_callback(const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback);
+
+    void
+    remove_occluder_callback(const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback);
+
+    void
+    begin_implement(fastuidraw::Painter *p,
+                    const fastuidraw::PainterSurface::Viewport &vwp,
+                    fastuidraw::ivec2 surface_dimensions,
+                    const fastuidraw::float3x3 &initial_transformation,
+                    const fastuidraw::c_array<const fastuidraw::Rect> *damage_rects = nullptr,
+                    const fastuidraw::vec4 *damage_clear_color = nullptr);
+
     void
     draw_generic_z_layered(fastuidraw::PainterItemShader *shader,
                            const fastuidraw::PainterData &draw,
@@ -1751,6 +2661,46 @@ namespace
       return fill_convex_polygon(shader, draw, pts, apply_anti_aliasing, z);
     }
 
+    /* fills those rects of rects which are not culled with
+     * a single call to draw_generic() (and for anti-aliasing,
+     * a single coverage buffer), returning the z-increment
+     */
+    int
+    fill_rects(const fastuidraw::PainterFillShader &shader,
+               const fastuidraw::PainterData &draw,
+               fastuidraw::c_array<const fastuidraw::Rect> rects,
+               bool apply_anti_aliasing, int z);
+
+    /* as fill_rects(), but for rounded rects; the corners are
+     * approximated by line segments according to m_curve_flatness.
+     */
+    int
+    fill_rounded_rects(const fastuidraw::PainterFillShader &shader,
+                       const fastuidraw::PainterData &draw,
+                       fastuidraw::c_array<const fastuidraw::RoundedRect> rects,
+                       bool apply_anti_aliasing, int z);
+
+    /* returns true if a rect, or the bounding rect of a rounded
+     * rect, is culled by the clipping or the damage rects.
+     */
+    bool
+    rect_batch_culled(const fastuidraw::Rect &rect, bool apply_anti_aliasing);
+
+    /* adds the outline of a rounded rect as a polygon to
+     * m_work_room.m_rect_batch
+     */
+    void
+    add_rounded_rect_outline(const fastuidraw::RoundedRect &R);
+
+    /* draws the convex polygons of m_work_room.m_rect_batch with a
+     * single call to draw_generic() (and for anti-aliasing, a single
+     * coverage buffer), returning the z-increment
+     */
+    int
+    fill_convex_polygon_batch(const fastuidraw::PainterFillShader &shader,
+                              const fastuidraw::PainterData &draw,
+                              bool apply_anti_aliasing, int z);
+
     void
     fill_rect_with_side_points(const fastuidraw::PainterFillShader &shader,
                                const fastuidraw::PainterData &draw,
@@ -1796,6 +2746,26 @@ namespace
                                const fastuidraw::PainterData &draw,
                                const fastuidraw::vec3 &plane);
 
+    /* draws the complement of those half planes of half_planes
+     * not marked in skip_occluder as occluders that are clipped
+     * against occluder_clip and adds them to the occluder stack.
+     */
+    void
+    draw_half_plane_complement_occluders(fastuidraw::Painter *p,
+                                         const fastuidraw::PainterClipEquations &occluder_clip,
+                                         const fastuidraw::PainterClipEquations &half_planes,
+                                         std::bitset<4> skip_occluder);
+
+    /* adds R to the top of m_effects_layer_stack and sets
+     * the clipping to clip_region_rect, the region of R.
+     */
+    void
+    push_effects_layer(const EffectsLayer &R, const fastuidraw::Rect &clip_region_rect);
+
+    /* applies the result of a previous clip_in_rect() taken from m_clip_cache */
+    void
+    apply_clip_cache_entry(fastuidraw::Painter *p, const ClipCache::Entry &entry);
+
     float
     compute_magnification(const fastuidraw::Rect &rect);
 
@@ -1818,6 +2788,13 @@ namespace
     select_subsets(const fastuidraw::FilledPath &path,
                    fastuidraw::c_array<unsigned int> dst);
 
+    /* returns the selection of the path from m_filled_selection_cache,
+     * recomputing it if necessary; returns nullptr if all content
+     * is culled.
+     */
+    FilledPathSelection*
+    cached_select_subsets(const fastuidraw::FilledPath &path);
+
     /* T can be StrokedPath of PartitionedTessellatedPath.
      * Returns a normalized rect.
      */
@@ -1842,6 +2819,32 @@ namespace
                    fastuidraw::PartitionedTessellatedPath::SubsetSelection &dst,
                    fastuidraw::BoundingBox<float> *nrect);
 
+    /* Same as select_subsets(), but the selection returned is from
+     * m_stroked_selection_cache or m_partitioned_selection_cache
+     * and stays valid until the next selection of the same path;
+     * scratch is used only if all content is culled.
+     */
+    const fastuidraw::StrokedPath::SubsetSelection&
+    cached_select_subsets(const fastuidraw::StrokedPath &path,
+                          fastuidraw::c_array<const float> geometry_inflation,
+                          bool select_miter_joins,
+                          fastuidraw::StrokedPath::SubsetSelection &scratch,
+                          fastuidraw::BoundingBox<float> *nrect);
+
+    const fastuidraw::PartitionedTessellatedPath::SubsetSelection&
+    cached_select_subsets(const fastuidraw::PartitionedTessellatedPath &path,
+                          fastuidraw::c_array<const float> geometry_inflation,
+                          bool select_miter_joins,
+                          fastuidraw::PartitionedTessellatedPath::SubsetSelection &scratch,
+                          fastuidraw::BoundingBox<float> *nrect);
+
+    /* the parameters of a stroking subset selection other than the
+     * clipping, as used by the keys of the SubsetSelectionCache.
+     */
+    fastuidraw::c_array<const float>
+    stroking_selection_params(fastuidraw::c_array<const float> geometry_inflation,
+                              bool select_miter_joins);
+
     const fastuidraw::TessellatedPath*
     select_path_for_stroking(const fastuidraw::Path &path,
                              const fastuidraw::PainterStrokeShader &shader,
@@ -1885,10 +2888,12 @@ namespace
     fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker> m_root_packer;
     ExtendedPool::PackedItemMatrix m_root_identity_matrix;
     fastuidraw::vecN<unsigned int, fastuidraw::PainterPacker::num_stats> m_stats;
+    fastuidraw::detail::PainterPhaseTimings m_timings;
     fastuidraw::PainterSurface::Viewport m_viewport;
     fastuidraw::vec2 m_viewport_dimensions;
     fastuidraw::vec2 m_one_pixel_width;
     float m_curve_flatness;
+    bool m_reorder_shader_groups;
     int m_current_z, m_draw_data_added_count;
     ClipRectState m_clip_rect_state;
     std::vector<occluder_stack_entry> m_occluder_stack;
@@ -1910,12 +2915,36 @@ namespace
     fastuidraw::PainterData::brush_value m_black_brush;
     const ExtendedPool::PackedBrushAdjust *m_current_brush_adjust;
     ClipEquationStore m_clip_store;
+    ClipCache m_clip_cache;
+    BrushInternCache m_brush_intern_cache;
+    SubsetSelectionCache<fastuidraw::FilledPath, FilledPathSelection> m_filled_selection_cache;
+    SubsetSelectionCache<fastuidraw::StrokedPath, fastuidraw::StrokedPath::SubsetSelection> m_stroked_selection_cache;
+    SubsetSelectionCache<fastuidraw::PartitionedTessellatedPath,
+                         fastuidraw::PartitionedTessellatedPath::SubsetSelection> m_partitioned_selection_cache;
     PainterWorkRoom m_work_room;
     unsigned int m_max_attribs_per_block, m_max_indices_per_block;
     float m_coverage_text_cut_off, m_distance_text_cut_off;
     fastuidraw::Path m_rounded_corner_path;
     fastuidraw::Path m_rounded_corner_path_complement;
     fastuidraw::Path m_square_path;
+
+    /* non-null when recording to a PainterCommandList */
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterCommandList> m_recording_list;
+    fastuidraw::detail::PainterCommandListPrivate *m_recording;
+
+    /* non-null when recording to a PainterPicture, in which case
+     * m_recording is the command list of the picture.
+     */
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterPicture> m_recording_picture_ref;
+    fastuidraw::detail::PainterPicturePrivate *m_recording_picture;
+
+    /* non-null while a drawing method gives an OcclusionHint */
+    const OcclusionHint *m_occlusion_hint;
+
+    /* damage rects, in normalized device coordinates, of the
+     * current begin(); empty if drawing is not restricted.
+     */
+    std::vector<fastuidraw::Rect> m_damage_rects;
   };
 }
 
@@ -2011,7 +3040,7 @@ get_src(WriteState *state, unsigned int *chunk) const
   switch (drawing_mode)
     {
     case drawing_edges:
-      src = &m_selection.source()->subset(m_selection.subset_ids()[idx]).painter_data();
+      src = &m_selection->source()->subset(m_selection->subset_ids()[idx]).painter_data();
       *chunk = 0;
       break;
 
@@ -2046,7 +3075,7 @@ set_join_chunks(fastuidraw::c_array<const unsigned int> subset_ids)
 
   for (unsigned int I : subset_ids)
     {
-      StrokedPath::Subset S(m_selection.source()->subset(I));
+      StrokedPath::Subset S(m_selection->source()->subset(I));
       int J(S.join_chunk());
 
       if (J >= 0)
@@ -2069,7 +3098,7 @@ set_cap_chunks(fastuidraw::c_array<const unsigned int> subset_ids)
     }
   for (unsigned int I : subset_ids)
     {
-      StrokedPath::Subset S(m_selection.source()->subset(I));
+      StrokedPath::Subset S(m_selection->source()->subset(I));
       int K(S.cap_chunk());
 
       if (K >= 0)
@@ -2168,20 +3197,25 @@ init_for_stroking(PainterPrivate &painter,
   m_shader[drawing_joins] = stroke_shader(shader, join_arc_shader, apply_anti_aliasing);
   m_shader[drawing_caps] = stroke_shader(shader, cap_arc_shader, apply_anti_aliasing);
 
+  /* the bounding box is also needed when recording, to
+   * give the bounds of the draws to the command list, and
+   * when drawing to damage rects, to cull the draw.
+   */
   if ((!m_join_attribute_data || m_shader[drawing_joins]->coverage_shader())
       && (!m_cap_attribute_data || m_shader[drawing_caps]->coverage_shader())
-      && !m_shader[drawing_joins]->coverage_shader())
+      && !m_shader[drawing_joins]->coverage_shader()
+      && !painter.needs_draw_bounds())
     {
       cvg_normalized_rect = nullptr;
     }
 
-  painter.select_subsets(path, additional_room,
-                         PainterEnums::is_miter_join(js),
-                         m_selection,
-                         cvg_normalized_rect);
+  m_selection = &painter.cached_select_subsets(path, additional_room,
+                                               PainterEnums::is_miter_join(js),
+                                               m_scratch_selection,
+                                               cvg_normalized_rect);
 
-  set_join_chunks(m_selection.join_subset_ids());
-  set_cap_chunks(m_selection.subset_ids());
+  set_join_chunks(m_selection->join_subset_ids());
+  set_cap_chunks(m_selection->subset_ids());
 
   if (m_join_chunks.empty())
     {
@@ -2195,7 +3229,7 @@ init_for_stroking(PainterPrivate &painter,
 
   m_requires_coverage_buffer = (m_join_attribute_data && m_shader[drawing_joins]->coverage_shader())
     || (m_cap_attribute_data && m_shader[drawing_caps]->coverage_shader())
-    || (!m_selection.subset_ids().empty() && m_shader[drawing_edges]->coverage_shader());
+    || (!m_selection->subset_ids().empty() && m_shader[drawing_edges]->coverage_shader());
 
   int tmp(0);
 
@@ -2223,7 +3257,7 @@ init_for_stroking(PainterPrivate &painter,
       tmp += R.difference();
     }
 
-  c_array<const unsigned int> subsets(m_selection.subset_ids());
+  c_array<const unsigned int> subsets(m_selection->subset_ids());
   m_z_increments[drawing_edges].resize(subsets.size());
   for (int i = subsets.size() - 1; i >= 0; --i)
     {
@@ -2388,6 +3422,12 @@ on_pop(PainterPrivate *p)
    * is drawn below them.
    */
   p->m_current_z += 1;
+  if (p->m_recording)
+    {
+      p->m_recording->record_finalize_occluder(m_occluder_id, p->m_current_z);
+      return;
+    }
+
   for(const auto &s : m_set_occluder_z)
     {
       ZDelayedAction *ptr;
@@ -2429,7 +3469,21 @@ ClipRectState::
 item_matrix_singular_values(void) const
 {
   FASTUIDRAWassert(!m_override_matrix_state);
-  if (!m_item_matrix_singular_values_ready)
+  if (!m_item_matrix_singular_values_ready
+      && m_matrix_form <= scale_translate_matrix_form)
+    {
+      float sx, sy;
+
+      /* the upper 2x2 is diagonal, the singular values are
+       * the absolute values of the diagonal entries.
+       */
+      sx = fastuidraw::t_abs(0.5f * m_viewport_dimensions.x() * m_item_matrix.m_item_matrix(0, 0));
+      sy = fastuidraw::t_abs(0.5f * m_viewport_dimensions.y() * m_item_matrix.m_item_matrix(1, 1));
+      m_item_matrix_singular_values = fastuidraw::vec2(fastuidraw::t_max(sx, sy),
+                                                       fastuidraw::t_min(sx, sy));
+      m_item_matrix_singular_values_ready = true;
+    }
+  else if (!m_item_matrix_singular_values_ready)
     {
       fastuidraw::float2x2 M;
 
@@ -2454,6 +3508,7 @@ item_matrix(const fastuidraw::float3x3 &v,
   m_item_matrix_transition_tricky = m_item_matrix_transition_tricky || trick_transition;
   m_inverse_transpose_ready = false;
   m_item_matrix.m_item_matrix = v;
+  m_matrix_form = compute_matrix_form(v);
   m_item_matrix_state.reset();
   m_item_matrix_coverage_buffer_state.reset();
   if (singular_value_scaled < 0.0f)
@@ -2681,6 +3736,62 @@ reset(fastuidraw::c_array<const fastuidraw::vec3> clip)
   m_current_bb.union_point(fastuidraw::vec2(+1.0f, +1.0f));
 }
 
+bool
+ClipEquationStore::
+current_is_bb(void) const
+{
+  using namespace fastuidraw;
+
+  const std::vector<vec3> &poly(m_poly.current());
+  std::bitset<4> corners;
+
+  if (m_current_bb.empty())
+    {
+      return false;
+    }
+
+  /* the clipping region is convex, so it is the rect of
+   * m_current_bb exactly when each of its points is a corner
+   * of that rect and all four corners are hit.
+   */
+  const vec2 &pmin(m_current_bb.min_point());
+  const vec2 &pmax(m_current_bb.max_point());
+  const float tol(1e-5f);
+  for (const vec3 &q : poly)
+    {
+      vec2 v(q.x() / q.z(), q.y() / q.z());
+      int cx, cy;
+
+      if (t_abs(v.x() - pmin.x()) <= tol)
+        {
+          cx = 0;
+        }
+      else if (t_abs(v.x() - pmax.x()) <= tol)
+        {
+          cx = 1;
+        }
+      else
+        {
+          return false;
+        }
+
+      if (t_abs(v.y() - pmin.y()) <= tol)
+        {
+          cy = 0;
+        }
+      else if (t_abs(v.y() - pmax.y()) <= tol)
+        {
+          cy = 1;
+        }
+      else
+        {
+          return false;
+        }
+      corners[cx + 2 * cy] = true;
+    }
+  return corners.all();
+}
+
 void
 ClipEquationStore::
 reset_current_to_rect(const fastuidraw::Rect &R)
@@ -2703,6 +3814,7 @@ reset_current_to_rect(const fastuidraw::Rect &R)
   pts[2] = vec2(R.m_max_point.x(), R.m_max_point.y());
   pts[3] = vec2(R.m_max_point.x(), R.m_min_point.y());
 
+  prepare_write();
   m_poly.current().clear();
   m_clip.current().clear();
 
@@ -2743,6 +3855,7 @@ intersect_current_against_polygon(fastuidraw::c_array<const fastuidraw::vec3> po
   c_array<const vec3> clipped_poly;
   detail::clip_against_planes(current(), poly, &clipped_poly, m_scratch);
 
+  prepare_write();
   m_poly.current().resize(clipped_poly.size());
   m_clip.current().resize(clipped_poly.size());
   m_current_bb = BoundingBox<float>();
@@ -2765,25 +3878,248 @@ intersect_current_against_polygon(fastuidraw::c_array<const fastuidraw::vec3> po
   return clipped_poly.empty();
 }
 
-///////////////////////////////////////
-// BufferRect methods
-BufferRect::
-BufferRect(const fastuidraw::Rect &normalized_rect,
-           fastuidraw::ivec2 useable_size,
-           PainterPrivate *d)
+/////////////////////////////////
+// ClipCache methods
+void
+ClipCache::
+begin_frame(void)
 {
-  using namespace fastuidraw;
+  ++m_frame;
+  for (std::map<Key, Entry>::iterator iter = m_entries.begin(); iter != m_entries.end();)
+    {
+      if (iter->second.m_last_used_frame + 1u < m_frame)
+        {
+          iter = m_entries.erase(iter);
+        }
+      else
+        {
+          ++iter;
+        }
+    }
+}
 
-  /* we need to discretize the rectangle, so that
-   * the size is correct. Using the normalized_rect.size()
-   * scaled is actually WRONG. Rather we need to look
-   * at the range of -sample- points the rect hits.
-   */
-  m_fbl = d->m_viewport.compute_viewport_coordinates(normalized_rect.m_min_point);
-  m_ftr = d->m_viewport.compute_viewport_coordinates(normalized_rect.m_max_point);
+const ClipCache::Entry*
+ClipCache::
+fetch(const fastuidraw::Rect &rect,
+      const ClipRectState &clip_rect_state,
+      const ClipEquationStore &clip_store)
+{
+  using namespace fastuidraw;
 
-  m_bl = fastuidraw::ivec2(m_fbl);
-  m_tr = fastuidraw::ivec2(m_ftr);
+  const float3x3 &m(clip_rect_state.item_matrix());
+  const clip_rect &R(clip_rect_state.m_clip_rect);
+  bool tricky(clip_rect_state.item_matrix_transition_tricky());
+  c_array<const vec3> clip(clip_store.current());
+  std::map<Key, Entry>::iterator iter;
+
+  m_key.clear();
+  add_to_key(rect.m_min_point.x());
+  add_to_key(rect.m_min_point.y());
+  add_to_key(rect.m_max_point.x());
+  add_to_key(rect.m_max_point.y());
+  for (unsigned int i = 0; i < 9; ++i)
+    {
+      add_to_key(m.c_ptr()[i]);
+    }
+
+  /* what clip_in_rect() does with the previous clipping
+   * rect depends on if it is enabled and if the item
+   * matrix transition is tricky.
+   */
+  m_key.push_back(uint32_t(R.m_enabled) | (uint32_t(tricky) << 1u));
+  if (R.m_enabled && !tricky)
+    {
+      add_to_key(R.m_min.x());
+      add_to_key(R.m_min.y());
+      add_to_key(R.m_max.x());
+      add_to_key(R.m_max.y());
+    }
+  else if (R.m_enabled)
+    {
+      const PainterClipEquations &eq(clip_rect_state.clip_equations());
+      for (const vec3 &v : eq.m_clip_equations)
+        {
+          add_to_key(v);
+        }
+    }
+
+  m_key.push_back(clip.size());
+  for (const vec3 &v : clip)
+    {
+      add_to_key(v);
+    }
+
+  iter = m_entries.find(m_key);
+  if (iter == m_entries.end())
+    {
+      return nullptr;
+    }
+
+  iter->second.m_last_used_frame = m_frame;
+  return &iter->second;
+}
+
+void
+ClipCache::
+add(const ClipRectState &clip_rect_state,
+    const ClipEquationStore &clip_store,
+    ExtendedPool &pool,
+    std::bitset<4> skip_occluder)
+{
+  using namespace fastuidraw;
+
+  FASTUIDRAWassert(!m_key.empty());
+  if (clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  Entry &E(m_entries[m_key]);
+  c_array<const vec3> clip(clip_store.current());
+  c_array<const vec3> poly(clip_store.current_poly());
+
+  E.m_clip.assign(clip.begin(), clip.end());
+  E.m_poly.assign(poly.begin(), poly.end());
+  E.m_bb = clip_store.current_bb();
+  E.m_clip_rect = clip_rect_state.m_clip_rect;
+  E.m_clip_equations = clip_rect_state.clip_equations_state(pool);
+  E.m_skip_occluder = skip_occluder;
+  E.m_last_used_frame = m_frame;
+}
+
+///////////////////////////////////////
+// BrushInternCache methods
+void
+BrushInternCache::
+begin_frame(void)
+{
+  ++m_frame;
+
+  /* the least recently used entries are at the back */
+  while (!m_entries.empty() && m_entries.back().m_last_used_frame + 1u < m_frame)
+    {
+      remove_from_map(--m_entries.end());
+      m_entries.pop_back();
+    }
+}
+
+void
+BrushInternCache::
+remove_from_map(EntryList::iterator entry)
+{
+  std::pair<EntryMap::iterator, EntryMap::iterator> range(m_map.equal_range(entry->m_hash));
+  for (EntryMap::iterator iter = range.first; iter != range.second; ++iter)
+    {
+      if (iter->second == entry)
+        {
+          m_map.erase(iter);
+          return;
+        }
+    }
+}
+
+bool
+BrushInternCache::
+matches(const Entry &entry,
+        fastuidraw::c_array<const fastuidraw::reference_counted_ptr<const fastuidraw::Image> > images) const
+{
+  using namespace fastuidraw;
+
+  c_array<const uvec4> data(entry.m_value.packed_data());
+  c_array<const reference_counted_ptr<const Image> > entry_images(entry.m_value.bind_images());
+
+  return data.size() == m_packed.size()
+    && std::equal(data.begin(), data.end(), m_packed.begin())
+    && entry_images.size() == images.size()
+    && std::equal(entry_images.begin(), entry_images.end(), images.begin());
+}
+
+void
+BrushInternCache::
+intern(fastuidraw::PainterData::brush_value &brush,
+       fastuidraw::PainterPackedValuePool &pool,
+       fastuidraw::c_array<unsigned int> stats)
+{
+  using namespace fastuidraw;
+
+  const PainterDataValue<BrushData> &src(brush.brush_shader_data());
+  if (src.m_packed_value || !src.m_value)
+    {
+      return;
+    }
+
+  const BrushData &value(*src.m_value);
+  c_array<const reference_counted_ptr<const Image> > images(value.bind_images());
+  PackedBrush packed;
+  uint32_t hash;
+
+  m_packed.resize(value.data_size());
+  value.pack_data(make_c_array(m_packed));
+
+  /* brushes that pack the same data can still bind different
+   * images, so the images are part of the key.
+   */
+  hash = detail::PackedValuePoolBase::compute_hash(make_c_array(m_packed));
+  for (const reference_counted_ptr<const Image> &im : images)
+    {
+      hash = (hash ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(im.get()))) * 16777619u;
+    }
+
+  std::pair<EntryMap::iterator, EntryMap::iterator> range(m_map.equal_range(hash));
+  for (EntryMap::iterator iter = range.first; iter != range.second && !packed; ++iter)
+    {
+      if (matches(*iter->second, images))
+        {
+          m_entries.splice(m_entries.begin(), m_entries, iter->second);
+          iter->second->m_last_used_frame = m_frame;
+          packed = iter->second->m_value;
+          ++stats[PainterEnums::num_brush_intern_hits];
+        }
+    }
+
+  if (!packed)
+    {
+      packed = pool.create_packed_value(value);
+      m_entries.push_front(Entry(hash, packed, m_frame));
+      m_map.insert(std::make_pair(hash, m_entries.begin()));
+      ++stats[PainterEnums::num_brush_intern_misses];
+
+      if (m_entries.size() > max_entries)
+        {
+          remove_from_map(--m_entries.end());
+          m_entries.pop_back();
+        }
+    }
+
+  if (brush.brush_shader())
+    {
+      brush.set(PainterCustomBrush(brush.brush_shader(), packed));
+    }
+  else
+    {
+      brush.set(PainterDataValue<BrushData>(packed));
+    }
+}
+
+///////////////////////////////////////
+// BufferRect methods
+BufferRect::
+BufferRect(const fastuidraw::Rect &normalized_rect,
+           fastuidraw::ivec2 useable_size,
+           PainterPrivate *d)
+{
+  using namespace fastuidraw;
+
+  /* we need to discretize the rectangle, so that
+   * the size is correct. Using the normalized_rect.size()
+   * scaled is actually WRONG. Rather we need to look
+   * at the range of -sample- points the rect hits.
+   */
+  m_fbl = d->m_viewport.compute_viewport_coordinates(normalized_rect.m_min_point);
+  m_ftr = d->m_viewport.compute_viewport_coordinates(normalized_rect.m_max_point);
+
+  m_bl = fastuidraw::ivec2(m_fbl);
+  m_tr = fastuidraw::ivec2(m_ftr);
 
   m_dims = m_tr - m_bl;
   if (m_ftr.x() > m_tr.x() && m_dims.x() < useable_size.x())
@@ -2861,22 +4197,39 @@ begin(fastuidraw::PainterSurface &surface)
    */
   m_effects_buffer_viewport.m_origin = fastuidraw::ivec2(0, 0);
   m_effects_buffer_viewport.m_dimensions = vwp.m_dimensions;
+  ++m_frame;
+
+  /* as for the other caches, a cached layer not used in the
+   * current or previous frame is dropped, releasing its surface;
+   * otherwise callers that change IDs every frame would keep
+   * allocating surfaces.
+   */
+  for (std::map<unsigned int, CachedLayer>::iterator iter = m_cached_layers.begin();
+       iter != m_cached_layers.end();)
+    {
+      if (iter->second.m_last_used_frame + 1u < m_frame)
+        {
+          iter = m_cached_layers.erase(iter);
+        }
+      else
+        {
+          ++iter;
+        }
+    }
 
   /* We can only use the portions of the backing store
    * that is within m_ransparency_buffer_viewport.
    */
   m_current_backing_useable_size = vwp.compute_visible_dimensions(surface_sz);
 
-  clear_buffers = (m_current_backing_useable_size.x() > m_current_backing_size.x())
-    || (m_current_backing_useable_size.y() > m_current_backing_size.y())
-    || (m_current_backing_size.x() > 2 * m_current_backing_useable_size.x())
-    || (m_current_backing_size.y() > 2 * m_current_backing_useable_size.y());
+  clear_buffers = backing_size_needs_reset(m_current_backing_size,
+                                           m_current_backing_useable_size);
 
   if (clear_buffers)
     {
       m_per_active_depth.clear();
       m_unused_buffers.clear();
-      m_current_backing_size = m_current_backing_useable_size;
+      m_current_backing_size = backing_size_class(m_current_backing_useable_size);
     }
   else
     {
@@ -2884,84 +4237,65 @@ begin(fastuidraw::PainterSurface &surface)
         {
           for (const auto &r : v)
             {
-              r->m_rect_atlas.clear(m_current_backing_useable_size);
-              m_unused_buffers.push_back(r);
+              if (!r->m_cached)
+                {
+                  r->m_rect_atlas.clear(m_current_backing_useable_size);
+                  m_unused_buffers.push_back(r);
+                }
             }
           v.clear();
         }
     }
 }
 
-EffectsLayer
+fastuidraw::reference_counted_ptr<EffectsBuffer>
 EffectsLayerFactory::
-fetch(unsigned int effects_depth,
-      const fastuidraw::Rect &normalized_rect,
-      PainterPrivate *d)
+create_buffer(fastuidraw::ivec2 backing_size,
+              fastuidraw::ivec2 useable_size,
+              PainterPrivate *d)
 {
   using namespace fastuidraw;
 
-  EffectsLayer return_value;
-  BufferRect buffer_rect(normalized_rect, m_current_backing_useable_size, d);
-  ivec2 rect(-1, -1);
-
-  if (effects_depth >= m_per_active_depth.size())
-    {
-      m_per_active_depth.resize(effects_depth + 1);
-    }
-
-  for (unsigned int i = 0, endi = m_per_active_depth[effects_depth].size();
-       (rect.x() < 0 || rect.y() < 0) && i < endi; ++i)
-    {
-      rect = m_per_active_depth[effects_depth][i]->m_rect_atlas.add_rectangle(buffer_rect.m_dims);
-      if (rect.x() >= 0 && rect.y() >= 0)
-        {
-          return_value.m_image = m_per_active_depth[effects_depth][i]->m_image.get();
-          return_value.m_packer = m_per_active_depth[effects_depth][i]->m_packer.get();
-        }
-    }
-
-  if (rect.x() < 0 || rect.y() < 0)
-    {
-      reference_counted_ptr<EffectsBuffer> TB;
+  reference_counted_ptr<PainterPacker> packer;
+  reference_counted_ptr<PainterSurface> surface;
+  reference_counted_ptr<const Image> image;
 
-      if (m_unused_buffers.empty())
-        {
-          reference_counted_ptr<PainterPacker> packer;
-          reference_counted_ptr<PainterSurface> surface;
-          reference_counted_ptr<const Image> image;
+  packer = FASTUIDRAWnew PainterPacker(d->m_default_brush_shader,
+                                       d->m_stats, d->m_timings, d->m_backend,
+                                       d->m_backend_factory->painter_shader_registrar(),
+                                       d->m_backend_factory->configuration_base());
+  surface = d->m_backend_factory->create_surface(backing_size,
+                                                 PainterSurface::color_buffer_type);
+  surface->clear_color(vec4(0.0f, 0.0f, 0.0f, 0.0f));
+  image = surface->image(d->m_backend_factory->image_atlas());
+  return FASTUIDRAWnew EffectsBuffer(packer, surface, image, useable_size);
+}
 
-          packer = FASTUIDRAWnew PainterPacker(d->m_default_brush_shader,
-                                               d->m_stats, d->m_backend,
-                                               d->m_backend_factory->painter_shader_registrar(),
-                                               d->m_backend_factory->configuration_base());
-          surface = d->m_backend_factory->create_surface(m_current_backing_size,
-                                                         PainterSurface::color_buffer_type);
-          surface->clear_color(vec4(0.0f, 0.0f, 0.0f, 0.0f));
-          image = surface->image(d->m_backend_factory->image_atlas());
-          TB = FASTUIDRAWnew EffectsBuffer(packer, surface, image, m_current_backing_useable_size);
-        }
-      else
-        {
-          TB = m_unused_buffers.back();
-          m_unused_buffers.pop_back();
-        }
+void
+EffectsLayerFactory::
+begin_buffer(unsigned int effects_depth, EffectsBuffer *TB, PainterPrivate *d)
+{
+  ++d->m_stats[fastuidraw::Painter::num_render_targets];
+  TB->m_depth = effects_depth;
+  TB->m_surface->viewport(m_effects_buffer_viewport);
+  m_per_active_depth[effects_depth].push_back(TB);
+  d->m_active_surfaces.push_back(TB->m_surface.get());
+  TB->m_packer->reorder_shader_groups(d->m_reorder_shader_groups);
+  TB->m_packer->begin(TB->m_surface, true);
+}
 
-      ++d->m_stats[Painter::num_render_targets];
-      TB->m_depth = effects_depth;
-      TB->m_surface->viewport(m_effects_buffer_viewport);
-      m_per_active_depth[effects_depth].push_back(TB);
-      d->m_active_surfaces.push_back(TB->m_surface.get());
+EffectsLayer
+EffectsLayerFactory::
+make_layer(const EffectsBuffer &TB, fastuidraw::ivec2 rect,
+           const BufferRect &buffer_rect, PainterPrivate *d)
+{
+  using namespace fastuidraw;
 
-      rect = TB->m_rect_atlas.add_rectangle(buffer_rect.m_dims);
-      return_value.m_image = TB->m_image.get();
-      return_value.m_packer = TB->m_packer.get();
-      return_value.m_packer->begin(TB->m_surface, true);
-    }
+  EffectsLayer return_value;
 
-  FASTUIDRAWassert(return_value.m_image);
-  FASTUIDRAWassert(return_value.m_packer);
   FASTUIDRAWassert(rect.x() >= 0 && rect.y() >= 0);
-
+  return_value.m_image = TB.m_image.get();
+  return_value.m_packer = TB.m_packer.get();
   return_value.m_normalized_rect = buffer_rect.m_normalized_rect;
   return_value.m_pixel_rect
     .min_point(buffer_rect.m_bl)
@@ -2993,6 +4327,113 @@ fetch(unsigned int effects_depth,
   return return_value;
 }
 
+EffectsLayer
+EffectsLayerFactory::
+fetch(unsigned int effects_depth,
+      const fastuidraw::Rect &normalized_rect,
+      PainterPrivate *d)
+{
+  using namespace fastuidraw;
+
+  BufferRect buffer_rect(normalized_rect, m_current_backing_useable_size, d);
+  ivec2 rect(-1, -1);
+
+  if (effects_depth >= m_per_active_depth.size())
+    {
+      m_per_active_depth.resize(effects_depth + 1);
+    }
+
+  for (unsigned int i = 0, endi = m_per_active_depth[effects_depth].size(); i < endi; ++i)
+    {
+      EffectsBuffer &TB(*m_per_active_depth[effects_depth][i]);
+
+      if (!TB.m_cached)
+        {
+          rect = TB.m_rect_atlas.add_rectangle(buffer_rect.m_dims);
+          if (rect.x() >= 0 && rect.y() >= 0)
+            {
+              return make_layer(TB, rect, buffer_rect, d);
+            }
+        }
+    }
+
+  reference_counted_ptr<EffectsBuffer> TB;
+  if (m_unused_buffers.empty())
+    {
+      TB = create_buffer(m_current_backing_size, m_current_backing_useable_size, d);
+    }
+  else
+    {
+      TB = m_unused_buffers.back();
+      m_unused_buffers.pop_back();
+    }
+
+  begin_buffer(effects_depth, TB.get(), d);
+  rect = TB->m_rect_atlas.add_rectangle(buffer_rect.m_dims);
+  return make_layer(*TB, rect, buffer_rect, d);
+}
+
+EffectsLayer
+EffectsLayerFactory::
+fetch_cached(unsigned int ID, unsigned int effects_depth,
+             const fastuidraw::Rect &normalized_rect,
+             PainterPrivate *d, bool *use_cached)
+{
+  using namespace fastuidraw;
+
+  BufferRect buffer_rect(normalized_rect, m_current_backing_useable_size, d);
+  CachedLayer &C(m_cached_layers[ID]);
+  RectT<int> pixel_rect;
+
+  FASTUIDRAWassert(C.m_last_used_frame != m_frame);
+  C.m_last_used_frame = m_frame;
+
+  pixel_rect
+    .min_point(buffer_rect.m_bl)
+    .max_point(buffer_rect.m_tr);
+
+  /* The cached content can be used only if it was rendered
+   * to the same pixels with the same viewport size; the
+   * normalized device coordinates of the layer depend on
+   * both.
+   */
+  *use_cached = C.m_buffer
+    && C.m_pixel_rect.m_min_point == pixel_rect.m_min_point
+    && C.m_pixel_rect.m_max_point == pixel_rect.m_max_point
+    && C.m_viewport_dimensions == m_effects_buffer_viewport.m_dimensions;
+
+  if (!*use_cached)
+    {
+      ivec2 sz;
+
+      if (C.m_buffer)
+        {
+          sz = C.m_buffer->m_surface->dimensions();
+        }
+
+      if (!C.m_buffer
+          || sz.x() < buffer_rect.m_dims.x()
+          || sz.y() < buffer_rect.m_dims.y())
+        {
+          ivec2 dims(t_max(1, buffer_rect.m_dims.x()), t_max(1, buffer_rect.m_dims.y()));
+
+          C.m_buffer = create_buffer(dims, dims, d);
+          C.m_buffer->m_cached = true;
+        }
+
+      if (effects_depth >= m_per_active_depth.size())
+        {
+          m_per_active_depth.resize(effects_depth + 1);
+        }
+
+      C.m_pixel_rect = pixel_rect;
+      C.m_viewport_dimensions = m_effects_buffer_viewport.m_dimensions;
+      begin_buffer(effects_depth, C.m_buffer.get(), d);
+    }
+
+  return make_layer(*C.m_buffer, ivec2(0, 0), buffer_rect, d);
+}
+
 void
 EffectsLayerFactory::
 end(void)
@@ -3064,16 +4505,14 @@ begin(fastuidraw::PainterSurface &surface)
 
   m_current_backing_useable_size = surface.compute_visible_dimensions();
 
-  clear_buffers = (m_current_backing_useable_size.x() > m_current_backing_size.x())
-    || (m_current_backing_useable_size.y() > m_current_backing_size.y())
-    || (m_current_backing_size.x() > 2 * m_current_backing_useable_size.x())
-    || (m_current_backing_size.y() > 2 * m_current_backing_useable_size.y());
+  clear_buffers = backing_size_needs_reset(m_current_backing_size,
+                                           m_current_backing_useable_size);
 
   if (clear_buffers)
     {
       m_active_buffers.clear();
       m_unused_buffers.clear();
-      m_current_backing_size = m_current_backing_useable_size;
+      m_current_backing_size = backing_size_class(m_current_backing_useable_size);
     }
   else
     {
@@ -3117,7 +4556,7 @@ fetch(const fastuidraw::Rect &normalized_rect, PainterPrivate *d)
           reference_counted_ptr<PainterSurface> surface;
 
           packer = FASTUIDRAWnew PainterPacker(d->m_default_brush_shader,
-                                               d->m_stats, d->m_backend,
+                                               d->m_stats, d->m_timings, d->m_backend,
                                                d->m_backend_factory->painter_shader_registrar(),
                                                d->m_backend_factory->configuration_base());
           surface = d->m_backend_factory->create_surface(m_current_backing_size,
@@ -3137,6 +4576,7 @@ fetch(const fastuidraw::Rect &normalized_rect, PainterPrivate *d)
 
       rect = TB->m_rect_atlas.add_rectangle(buffer_rect.m_dims);
       return_packer = TB->m_packer.get();
+      return_packer->reorder_shader_groups(d->m_reorder_shader_groups);
       return_packer->begin(TB->m_surface, true);
       d->m_active_surfaces.push_back(TB->m_surface.get());
     }
@@ -3172,10 +4612,14 @@ PainterPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::PainterEngine
   m_viewport_dimensions(1.0f, 1.0f),
   m_one_pixel_width(1.0f, 1.0f),
   m_curve_flatness(0.5f),
+  m_reorder_shader_groups(false),
   m_backend_factory(backend_factory),
   m_backend(backend_factory->create_backend()),
   m_hints(backend_factory->hints()),
-  m_current_brush_adjust(nullptr)
+  m_current_brush_adjust(nullptr),
+  m_recording(nullptr),
+  m_recording_picture(nullptr),
+  m_occlusion_hint(nullptr)
 {
   /* By calling PainterBackend::default_shaders(), we make the shaders
    * registered. By setting m_default_shaders to its return value,
@@ -3186,7 +4630,7 @@ PainterPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::PainterEngine
   m_default_shaders = m_backend_factory->default_shaders();
   m_default_brush_shader = m_default_shaders.brush_shaders().standard_brush().get();
   m_brush_fx = FASTUIDRAWnew fastuidraw::PainterEffectBrush();
-  m_root_packer = FASTUIDRAWnew fastuidraw::PainterPacker(m_default_brush_shader, m_stats, m_backend,
+  m_root_packer = FASTUIDRAWnew fastuidraw::PainterPacker(m_default_brush_shader, m_stats, m_timings, m_backend,
                                                           m_backend_factory->painter_shader_registrar(),
                                                           m_backend_factory->configuration_base());
   m_black_brush = m_pool.create_packed_brush(fastuidraw::PainterBrush()
@@ -3244,12 +4688,12 @@ concat(const fastuidraw::float3x3 &tr)
             || tr(2, 2) != 1.0f);
 
   m = m_clip_rect_state.item_matrix() * tr;
-  m_clip_rect_state.item_matrix(m, tricky, unclassified_matrix);
+  writeable_clip_rect_state().item_matrix(m, tricky, unclassified_matrix);
 
   if (!tricky)
     {
-      m_clip_rect_state.m_clip_rect.translate(vec2(-tr(0, 2), -tr(1, 2)));
-      m_clip_rect_state.m_clip_rect.shear(1.0f / tr(0, 0), 1.0f / tr(1, 1));
+      writeable_clip_rect_state().m_clip_rect.translate(vec2(-tr(0, 2), -tr(1, 2)));
+      writeable_clip_rect_state().m_clip_rect.shear(1.0f / tr(0, 0), 1.0f / tr(1, 1));
     }
 }
 
@@ -3261,8 +4705,8 @@ translate(const fastuidraw::vec2 &p)
 
   float3x3 m(m_clip_rect_state.item_matrix());
   m.translate(p.x(), p.y());
-  m_clip_rect_state.item_matrix(m, false, non_scaling_matrix, 1.0f);
-  m_clip_rect_state.m_clip_rect.translate(-p);
+  writeable_clip_rect_state().item_matrix(m, false, non_scaling_matrix, 1.0f);
+  writeable_clip_rect_state().m_clip_rect.translate(-p);
 }
 
 void
@@ -3273,8 +4717,8 @@ scale(float s)
 
   float3x3 m(m_clip_rect_state.item_matrix());
   m.scale(s);
-  m_clip_rect_state.item_matrix(m, false, scaling_matrix, t_abs(s));
-  m_clip_rect_state.m_clip_rect.scale(1.0f / s);
+  writeable_clip_rect_state().item_matrix(m, false, scaling_matrix, t_abs(s));
+  writeable_clip_rect_state().m_clip_rect.scale(1.0f / s);
 }
 
 void
@@ -3294,8 +4738,8 @@ shear(float sx, float sy)
     -1.0f : t_abs(sx);
 
   m.shear(sx, sy);
-  m_clip_rect_state.item_matrix(m, false, tp, sf);
-  m_clip_rect_state.m_clip_rect.shear(1.0f / sx, 1.0f / sy);
+  writeable_clip_rect_state().item_matrix(m, false, tp, sf);
+  writeable_clip_rect_state().m_clip_rect.shear(1.0f / sx, 1.0f / sy);
 }
 
 void
@@ -3318,7 +4762,7 @@ rotate(float angle)
 
   float3x3 m(m_clip_rect_state.item_matrix());
   m = m * tr;
-  m_clip_rect_state.item_matrix(m, true, non_scaling_matrix, 1.0f);
+  writeable_clip_rect_state().item_matrix(m, true, non_scaling_matrix, 1.0f);
 }
 
 fastuidraw::BoundingBox<float>
@@ -3412,12 +4856,20 @@ PainterPrivate::
 begin_coverage_buffer_normalized_rect(const fastuidraw::Rect &normalized_rect,
                                       bool non_empty)
 {
-  if (non_empty)
+  if (m_recording)
+    {
+      /* the coverage buffer is realized when the
+       * PainterCommandList is drawn.
+       */
+      m_recording->record_begin_coverage_buffer(normalized_rect, non_empty);
+      m_deferred_coverage_stack.push_back(DeferredCoverageBufferStackEntry());
+    }
+  else if (non_empty)
     {
       /* intersect normalized_rect with the current */
       m_deferred_coverage_stack.push_back(m_deferred_coverage_stack_entry_factory.fetch(normalized_rect, this));
       m_deferred_coverage_stack.back().update_coverage_buffer_offset(this);
-      m_clip_rect_state.coverage_buffer_normalized_translate(m_deferred_coverage_stack.back().normalized_translate());
+      writeable_clip_rect_state().coverage_buffer_normalized_translate(m_deferred_coverage_stack.back().normalized_translate());
     }
   else
     {
@@ -3445,11 +4897,15 @@ end_coverage_buffer(void)
   FASTUIDRAWassert(!m_deferred_coverage_stack.empty());
   FASTUIDRAWassert(m_state_stack.empty() || m_state_stack.back().m_deferred_coverage_buffer_depth < m_deferred_coverage_stack.size());
 
+  if (m_recording)
+    {
+      m_recording->record_end_coverage_buffer();
+    }
   m_deferred_coverage_stack.pop_back();
   if (!m_deferred_coverage_stack.empty() && m_deferred_coverage_stack.back().packer())
     {
       m_deferred_coverage_stack.back().update_coverage_buffer_offset(this);
-      m_clip_rect_state.coverage_buffer_normalized_translate(m_deferred_coverage_stack.back().normalized_translate());
+      writeable_clip_rect_state().coverage_buffer_normalized_translate(m_deferred_coverage_stack.back().normalized_translate());
     }
 }
 
@@ -3485,7 +4941,7 @@ compute_magnification(const fastuidraw::Rect &rect)
    * clip-equations
    */
   const float3x3 &m(m_clip_rect_state.item_matrix());
-  if (!matrix_has_perspective(m))
+  if (m_clip_rect_state.matrix_form() != perspective_matrix_form)
     {
       return m_clip_rect_state.item_matrix_operator_norm() / t_abs(m(2, 2));
     }
@@ -3523,7 +4979,7 @@ compute_max_magnification_at_clip_points(fastuidraw::c_array<const fastuidraw::v
   const float3x3 &m(m_clip_rect_state.item_matrix());
 
   op_norm = m_clip_rect_state.item_matrix_operator_norm();
-  if (!matrix_has_perspective(m))
+  if (m_clip_rect_state.matrix_form() != perspective_matrix_form)
     {
       return op_norm / t_abs(m(2, 2));
     }
@@ -3683,7 +5139,13 @@ select_path_for_stroking(const fastuidraw::Path &path,
         shader.fastest_non_anti_aliased_stroking_method();
     }
 
+  /* while a preparation started with Path::prepare_async()
+   * is not done, use the finest tessellation already prepared
+   */
+  t = path.prepared_threshold(t, PathEnums::prepare_stroked);
+
   const TessellatedPath *tess;
+  detail::PainterPhaseTimer timer(m_timings, Painter::time_tessellation_fetch);
   tess = &path.tessellation(t);
 
   if (stroking_method != Painter::stroking_method_arc
@@ -3713,35 +5175,176 @@ select_subsets(const fastuidraw::FilledPath &path,
   FASTUIDRAWmessaged_assert(dst.size() >= path.number_subsets(),
                             "Painter::select_subsets(FilledPath) provided with "
                             "smaller array than number of subsets of FilledPath");
-  if (m_clip_rect_state.m_all_content_culled)
+  FilledPathSelection *selection;
+
+  selection = cached_select_subsets(path);
+  if (!selection)
     {
       return 0u;
     }
 
-  return path.select_subsets(m_work_room.m_fill_subset.m_scratch,
-                             m_clip_store.current(),
-                             m_clip_rect_state.item_matrix(),
-                             m_max_attribs_per_block,
-                             m_max_indices_per_block,
-                             dst);
+  std::copy(selection->m_subsets.begin(), selection->m_subsets.end(), dst.begin());
+  return selection->m_subsets.size();
 }
 
-void
+FilledPathSelection*
 PainterPrivate::
-select_subsets(const fastuidraw::StrokedPath &path,
-               fastuidraw::c_array<const float> geometry_inflation,
-               bool select_miter_joins,
-               fastuidraw::StrokedPath::SubsetSelection &dst,
-               fastuidraw::BoundingBox<float> *nrect)
+cached_select_subsets(const fastuidraw::FilledPath &path)
 {
+  using namespace fastuidraw;
+
   if (m_clip_rect_state.m_all_content_culled)
     {
-      dst.clear(&path);
+      return nullptr;
     }
-  else
+
+  detail::PainterPhaseTimer timer(m_timings, Painter::time_subset_selection);
+  const float3x3 &m(m_clip_rect_state.item_matrix());
+  c_array<const float> params(m.c_ptr(), 9);
+  SubsetSelectionCache<FilledPath, FilledPathSelection>::Entry *entry;
+
+  if (!m_filled_selection_cache.fetch(path, m_clip_store, params, &entry))
     {
-      path.select_subsets(m_clip_store.current(),
-                          m_clip_rect_state.item_matrix(),
+      unsigned int num;
+
+      entry->m_selection.m_subsets.resize(path.number_subsets());
+      num = path.select_subsets(m_work_room.m_fill_subset.m_scratch,
+                                m_clip_store.current(), m,
+                                m_max_attribs_per_block,
+                                m_max_indices_per_block,
+                                make_c_array(entry->m_selection.m_subsets));
+      entry->m_selection.m_subsets.resize(num);
+      entry->m_selection.m_chunks_fill_rule = Painter::number_fill_rule;
+      entry->m_selection.m_volatile = entry->m_volatile;
+    }
+  return &entry->m_selection;
+}
+
+fastuidraw::c_array<const float>
+PainterPrivate::
+stroking_selection_params(fastuidraw::c_array<const float> geometry_inflation,
+                          bool select_miter_joins)
+{
+  using namespace fastuidraw;
+
+  const float3x3 &m(m_clip_rect_state.item_matrix());
+  std::vector<float> &dst(m_work_room.m_selection_params);
+
+  dst.assign(m.c_ptr(), m.c_ptr() + 9);
+  dst.push_back(m_one_pixel_width.x());
+  dst.push_back(m_one_pixel_width.y());
+  dst.push_back(select_miter_joins ? 1.0f : 0.0f);
+  dst.insert(dst.end(), geometry_inflation.begin(), geometry_inflation.end());
+  return make_c_array(dst);
+}
+
+const fastuidraw::StrokedPath::SubsetSelection&
+PainterPrivate::
+cached_select_subsets(const fastuidraw::StrokedPath &path,
+                      fastuidraw::c_array<const float> geometry_inflation,
+                      bool select_miter_joins,
+                      fastuidraw::StrokedPath::SubsetSelection &scratch,
+                      fastuidraw::BoundingBox<float> *nrect)
+{
+  using namespace fastuidraw;
+
+  if (m_clip_rect_state.m_all_content_culled)
+    {
+      select_subsets(path, geometry_inflation, select_miter_joins, scratch, nrect);
+      return scratch;
+    }
+
+  detail::PainterPhaseTimer timer(m_timings, Painter::time_subset_selection);
+  SubsetSelectionCache<StrokedPath, StrokedPath::SubsetSelection>::Entry *entry;
+
+  if (!m_stroked_selection_cache.fetch(path, m_clip_store,
+                                       stroking_selection_params(geometry_inflation, select_miter_joins),
+                                       &entry))
+    {
+      path.select_subsets(m_clip_store.current(),
+                          m_clip_rect_state.item_matrix(),
+                          m_one_pixel_width,
+                          geometry_inflation,
+                          m_max_attribs_per_block,
+                          m_max_indices_per_block,
+                          select_miter_joins,
+                          entry->m_selection);
+    }
+
+  if (nrect)
+    {
+      if (!entry->m_bb_ready)
+        {
+          entry->m_bb = compute_bounding_box_of_path(path, geometry_inflation,
+                                                     select_miter_joins, entry->m_selection);
+          entry->m_bb_ready = true;
+        }
+      *nrect = entry->m_bb;
+    }
+  return entry->m_selection;
+}
+
+const fastuidraw::PartitionedTessellatedPath::SubsetSelection&
+PainterPrivate::
+cached_select_subsets(const fastuidraw::PartitionedTessellatedPath &path,
+                      fastuidraw::c_array<const float> geometry_inflation,
+                      bool select_miter_joins,
+                      fastuidraw::PartitionedTessellatedPath::SubsetSelection &scratch,
+                      fastuidraw::BoundingBox<float> *nrect)
+{
+  using namespace fastuidraw;
+
+  if (m_clip_rect_state.m_all_content_culled)
+    {
+      select_subsets(path, geometry_inflation, select_miter_joins, scratch, nrect);
+      return scratch;
+    }
+
+  detail::PainterPhaseTimer timer(m_timings, Painter::time_subset_selection);
+  SubsetSelectionCache<PartitionedTessellatedPath, PartitionedTessellatedPath::SubsetSelection>::Entry *entry;
+
+  if (!m_partitioned_selection_cache.fetch(path, m_clip_store,
+                                           stroking_selection_params(geometry_inflation, select_miter_joins),
+                                           &entry))
+    {
+      path.select_subsets(m_clip_store.current(),
+                          m_clip_rect_state.item_matrix(),
+                          m_one_pixel_width,
+                          geometry_inflation,
+                          select_miter_joins,
+                          entry->m_selection);
+    }
+
+  if (nrect)
+    {
+      if (!entry->m_bb_ready)
+        {
+          entry->m_bb = compute_bounding_box_of_path(path, geometry_inflation,
+                                                     select_miter_joins, entry->m_selection);
+          entry->m_bb_ready = true;
+        }
+      *nrect = entry->m_bb;
+    }
+  return entry->m_selection;
+}
+
+void
+PainterPrivate::
+select_subsets(const fastuidraw::StrokedPath &path,
+               fastuidraw::c_array<const float> geometry_inflation,
+               bool select_miter_joins,
+               fastuidraw::StrokedPath::SubsetSelection &dst,
+               fastuidraw::BoundingBox<float> *nrect)
+{
+  fastuidraw::detail::PainterPhaseTimer timer(m_timings, fastuidraw::Painter::time_subset_selection);
+  if (m_clip_rect_state.m_all_content_culled)
+    {
+      dst.clear(&path);
+    }
+  else
+    {
+      path.select_subsets(m_clip_store.current(),
+                          m_clip_rect_state.item_matrix(),
                           m_one_pixel_width,
                           geometry_inflation,
                           m_max_attribs_per_block,
@@ -3765,6 +5368,7 @@ select_subsets(const fastuidraw::PartitionedTessellatedPath &path,
                fastuidraw::PartitionedTessellatedPath::SubsetSelection &dst,
                fastuidraw::BoundingBox<float> *nrect)
 {
+  fastuidraw::detail::PainterPhaseTimer timer(m_timings, fastuidraw::Painter::time_subset_selection);
   if (m_clip_rect_state.m_all_content_culled)
     {
       dst.clear(&path);
@@ -3794,6 +5398,9 @@ select_filled_path(const fastuidraw::Path &path)
   float thresh;
 
   thresh = compute_path_thresh(path);
+  thresh = path.prepared_threshold(thresh, PathEnums::prepare_filled);
+
+  detail::PainterPhaseTimer timer(m_timings, Painter::time_tessellation_fetch);
   return path.tessellation(thresh).filled(thresh);
 }
 
@@ -3807,6 +5414,14 @@ draw_generic(fastuidraw::PainterItemShader *shader,
              fastuidraw::c_array<const unsigned int> attrib_chunk_selector,
              int z)
 {
+  if (m_recording)
+    {
+      fastuidraw::detail::AttributeIndexSrcFromArray src(attrib_chunks, index_chunks,
+                                                         index_adjusts, attrib_chunk_selector);
+      record_generic(shader, draw, src, z);
+      return;
+    }
+
   fastuidraw::PainterPackerData p(draw);
   fastuidraw::PainterPacker *cvg_packer(deferred_coverage_packer());
   fastuidraw::PainterPacker::DeferredCoverageReadParams coverage_buffer;
@@ -3829,73 +5444,911 @@ draw_generic(fastuidraw::PainterItemShader *shader,
       FASTUIDRAWwarning(!"Warning: coverage_shader present but no coverage buffer present\n");
     }
 
-  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
-  p.m_matrix = m_clip_rect_state.current_item_matrix_state(m_pool);
-  FASTUIDRAWassert(p.m_clip);
-  FASTUIDRAWassert(p.m_matrix);
-  if (m_current_brush_adjust)
+  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
+  p.m_matrix = m_clip_rect_state.current_item_matrix_state(m_pool);
+  FASTUIDRAWassert(p.m_clip);
+  FASTUIDRAWassert(p.m_matrix);
+  if (m_current_brush_adjust)
+    {
+      p.m_brush_adjust = *m_current_brush_adjust;
+      FASTUIDRAWassert(p.m_brush_adjust);
+    }
+
+  packer()->draw_generic(coverage_buffer, shader, p,
+                         attrib_chunks, index_chunks, index_adjusts,
+                         attrib_chunk_selector, z);
+  ++m_draw_data_added_count;
+}
+
+int
+PainterPrivate::
+draw_generic(fastuidraw::PainterItemShader *shader,
+             const fastuidraw::PainterData &draw,
+             const fastuidraw::PainterAttributeWriter &src,
+             int z)
+{
+  if (m_recording)
+    {
+      return record_generic(shader, draw, src, z);
+    }
+
+  fastuidraw::PainterPackerData p(draw);
+  fastuidraw::PainterPacker *cvg_packer(deferred_coverage_packer());
+  fastuidraw::PainterPacker::DeferredCoverageReadParams coverage_buffer;
+  int return_value;
+  bool requires_coverage_buffer;
+
+  requires_coverage_buffer = src.requires_coverage_buffer()
+    || (shader && shader->coverage_shader());
+
+  if (requires_coverage_buffer && cvg_packer)
+    {
+      FASTUIDRAWassert(!m_deferred_coverage_stack.empty());
+      p.m_clip = m_deferred_coverage_stack.back().clip_eq_state();
+      p.m_matrix = m_clip_rect_state.current_item_matrix_coverage_buffer_state(m_pool);
+      m_deferred_coverage_stack.back().coverage_buffer_params(coverage_buffer);
+
+      FASTUIDRAWassert(p.m_clip);
+      FASTUIDRAWassert(p.m_matrix);
+      fastuidraw::PainterItemCoverageShader *cvg_shader;
+
+      cvg_shader = (shader) ?
+        shader->coverage_shader().get() :
+        nullptr;
+
+      cvg_packer->draw_generic(cvg_shader, p, src);
+      packer()->set_coverage_surface(cvg_packer->surface());
+    }
+  else if (requires_coverage_buffer)
+    {
+      FASTUIDRAWwarning(!"Warning: coverage_shader present but no coverage buffer present\n");
+    }
+
+  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
+  p.m_matrix = m_clip_rect_state.current_item_matrix_state(m_pool);
+  FASTUIDRAWassert(p.m_clip);
+  FASTUIDRAWassert(p.m_matrix);
+  if (m_current_brush_adjust)
+    {
+      p.m_brush_adjust = *m_current_brush_adjust;
+      FASTUIDRAWassert(p.m_brush_adjust);
+    }
+  return_value = packer()->draw_generic(coverage_buffer, shader, p, src, z);
+  ++m_draw_data_added_count;
+  return return_value;
+}
+
+int
+PainterPrivate::
+record_generic(fastuidraw::PainterItemShader *shader,
+               const fastuidraw::PainterData &draw,
+               const fastuidraw::PainterAttributeWriter &src,
+               int z)
+{
+  fastuidraw::PainterPackerData p(draw);
+  int return_value;
+  bool requires_coverage_buffer;
+
+  FASTUIDRAWassert(m_recording);
+
+  /* the values must be packed so that they are owned by
+   * the PainterCommandList.
+   */
+  make_packed(p);
+  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
+  p.m_matrix = m_clip_rect_state.current_item_matrix_state(m_pool);
+  FASTUIDRAWassert(p.m_clip);
+  FASTUIDRAWassert(p.m_matrix);
+  if (m_current_brush_adjust)
+    {
+      p.m_brush_adjust = *m_current_brush_adjust;
+      FASTUIDRAWassert(p.m_brush_adjust);
+    }
+
+  requires_coverage_buffer = src.requires_coverage_buffer()
+    || (shader && shader->coverage_shader());
+
+  if (requires_coverage_buffer && !m_deferred_coverage_stack.empty())
+    {
+      fastuidraw::PainterItemCoverageShader *cvg_shader;
+
+      /* the clip equations and matrix for drawing to the coverage
+       * buffer are taken from the coverage buffer that is active
+       * when the PainterCommandList is drawn.
+       */
+      cvg_shader = (shader) ?
+        shader->coverage_shader().get() :
+        nullptr;
+      m_recording->record_coverage_draw(cvg_shader, p, src);
+    }
+  else if (requires_coverage_buffer)
+    {
+      FASTUIDRAWwarning(!"Warning: coverage_shader present but no coverage buffer present\n");
+    }
+
+  fastuidraw::detail::PainterCommandListPrivate::Occlusion occlusion;
+
+  compute_occlusion(shader, draw, &occlusion);
+  return_value = m_recording->record_draw(shader, packer()->blend_shader(), packer()->blend_mode(),
+                                          requires_coverage_buffer, p, occlusion, src, z);
+  ++m_draw_data_added_count;
+  return return_value;
+}
+
+void
+PainterPrivate::
+compute_occlusion(fastuidraw::PainterItemShader *shader,
+                  const fastuidraw::PainterData &draw,
+                  fastuidraw::detail::PainterCommandListPrivate::Occlusion *out)
+{
+  using namespace fastuidraw;
+
+  BoundingBox<float> bb(m_clip_store.current_bb());
+
+  if (m_occlusion_hint && !m_occlusion_hint->m_bounds.empty())
+    {
+      bb.intersect_against(m_occlusion_hint->m_bounds);
+    }
+
+  if (bb.empty())
+    {
+      /* nothing is drawn, leave the bounds as a point */
+      return;
+    }
+  out->m_bounds = bb.as_rect();
+
+  if (!m_occlusion_hint
+      || !m_occlusion_hint->m_opaque_candidate
+      || !shader
+      || shader != m_default_shaders.fill_shader().item_shader().get()
+      || !m_clip_store.current_is_bb())
+    {
+      return;
+    }
+
+  /* the brush must be a PainterBrush of opaque color only */
+  const PainterBrushShaderData *brush_data(draw.m_brush.brush_shader_data().m_value);
+  const PainterBrush *brush(dynamic_cast<const PainterBrush*>(brush_data));
+
+  if (draw.m_brush.brush_shader()
+      || !brush
+      || brush->color().w() < 1.0f
+      || brush->image()
+      || brush->gradient_type() != PainterEnums::gradient_non)
+    {
+      return;
+    }
+
+  /* and the blending must be to replace what is drawn */
+  const PainterBlendShaderSet &blend_shaders(m_default_shaders.blend_shaders());
+  bool blend_replaces(false);
+
+  for (enum PainterEnums::blend_mode_t m : { PainterEnums::blend_porter_duff_src_over,
+                                             PainterEnums::blend_porter_duff_src })
+    {
+      blend_replaces = blend_replaces
+        || (packer()->blend_shader() == blend_shaders.shader(m).get()
+            && packer()->blend_mode() == blend_shaders.blend_mode(m));
+    }
+
+  if (!blend_replaces)
+    {
+      return;
+    }
+
+  BoundingBox<float> opaque(m_occlusion_hint->m_opaque_rect);
+  opaque.intersect_against(m_clip_store.current_bb());
+  if (!opaque.empty())
+    {
+      out->m_opaque = true;
+      out->m_opaque_rect = opaque.as_rect();
+    }
+}
+
+bool
+PainterPrivate::
+compute_opaque_rect(fastuidraw::c_array<const fastuidraw::vec2> pts,
+                    fastuidraw::Rect *out) const
+{
+  using namespace fastuidraw;
+
+  const float3x3 &m(m_clip_rect_state.item_matrix());
+
+  if (pts.size() != 4
+      || m(0, 1) != 0.0f || m(1, 0) != 0.0f
+      || m(2, 0) != 0.0f || m(2, 1) != 0.0f
+      || m(2, 2) <= 0.0f)
+    {
+      return false;
+    }
+
+  /* the polygon is a rect exactly when each edge is
+   * horizontal or vertical with the two kinds alternating.
+   */
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      const vec2 &a(pts[i]), &b(pts[(i + 1) & 3]), &c(pts[(i + 2) & 3]);
+      bool ab_vertical(a.x() == b.x()), bc_vertical(b.x() == c.x());
+      bool ab_horizontal(a.y() == b.y()), bc_horizontal(b.y() == c.y());
+
+      if (!(ab_vertical && bc_horizontal) && !(ab_horizontal && bc_vertical))
+        {
+          return false;
+        }
+    }
+
+  vec2 p, q;
+  float recip_w(1.0f / m(2, 2));
+
+  p = vec2(m(0, 0) * pts[0].x() + m(0, 2), m(1, 1) * pts[0].y() + m(1, 2)) * recip_w;
+  q = vec2(m(0, 0) * pts[2].x() + m(0, 2), m(1, 1) * pts[2].y() + m(1, 2)) * recip_w;
+  out->m_min_point = vec2(t_min(p.x(), q.x()), t_min(p.y(), q.y()));
+  out->m_max_point = vec2(t_max(p.x(), q.x()), t_max(p.y(), q.y()));
+  return true;
+}
+
+void
+PainterPrivate::
+compute_occlusion_culled(const fastuidraw::detail::PainterCommandListPrivate &list,
+                         const PictureTransform *picture)
+{
+  using namespace fastuidraw;
+  typedef detail::PainterCommandListPrivate CommandList;
+
+  /* The number of regions tracked is bounded; when full,
+   * a new region replaces the smallest one if larger.
+   */
+  const unsigned int max_regions(16);
+  std::vector<bool> &culled(m_work_room.m_command_list.m_culled);
+  std::vector<OpaqueRegion> &regions(m_work_room.m_command_list.m_opaque_regions);
+  bool track_opaque(true);
+  int occluder_depth(0);
+
+  auto area = [](const Rect &R)
+    {
+      return (R.m_max_point.x() - R.m_min_point.x()) * (R.m_max_point.y() - R.m_min_point.y());
+    };
+
+  if (picture)
+    {
+      /* opaque rects stay opaque rects only if the picture
+       * transformation keeps rects as rects and the clipping
+       * of the picture is a rect.
+       */
+      const float3x3 &m(picture->m_transform);
+      track_opaque = m(0, 1) == 0.0f && m(1, 0) == 0.0f
+        && m(2, 0) == 0.0f && m(2, 1) == 0.0f
+        && m_clip_store.current_is_bb();
+    }
+
+  culled.assign(list.m_commands.size(), false);
+  regions.clear();
+
+  /* Walk the commands from last to first. A draw is hidden if its
+   * bounds are within the rect of an opaque draw after it whose
+   * depth is not less than the depth of the draw. Draws made while
+   * an occluder is active have their depth changed by the occluder
+   * mechanism, so they are neither culled nor used to cull.
+   */
+  for (unsigned int i = list.m_commands.size(); i > 0; --i)
+    {
+      const CommandList::Command &cmd(list.m_commands[i - 1]);
+
+      if (cmd.m_type == CommandList::remove_occluder_command)
+        {
+          ++occluder_depth;
+        }
+      else if (cmd.m_type == CommandList::add_occluder_command)
+        {
+          --occluder_depth;
+        }
+
+      if (cmd.m_type != CommandList::draw_command || occluder_depth > 0)
+        {
+          continue;
+        }
+
+      Rect bounds(cmd.m_occlusion.m_bounds);
+      if (picture)
+        {
+          bounds = transform_normalized_rect(picture->m_transform, bounds);
+        }
+
+      if (damage_culled(BoundingBox<float>(bounds)))
+        {
+          culled[i - 1] = true;
+          continue;
+        }
+
+      for (const OpaqueRegion &R : regions)
+        {
+          if (R.m_z >= cmd.m_z_max
+              && R.m_rect.m_min_point.x() <= bounds.m_min_point.x()
+              && R.m_rect.m_min_point.y() <= bounds.m_min_point.y()
+              && R.m_rect.m_max_point.x() >= bounds.m_max_point.x()
+              && R.m_rect.m_max_point.y() >= bounds.m_max_point.y())
+            {
+              culled[i - 1] = true;
+              ++m_stats[Painter::num_occlusion_culled];
+              break;
+            }
+        }
+
+      if (culled[i - 1] || !track_opaque || !cmd.m_occlusion.m_opaque)
+        {
+          continue;
+        }
+
+      OpaqueRegion region;
+
+      region.m_z = cmd.m_z;
+      region.m_rect = cmd.m_occlusion.m_opaque_rect;
+      if (picture)
+        {
+          BoundingBox<float> bb(transform_normalized_rect(picture->m_transform, region.m_rect));
+
+          bb.intersect_against(m_clip_store.current_bb());
+          if (bb.empty())
+            {
+              continue;
+            }
+          region.m_rect = bb.as_rect();
+        }
+
+      if (regions.size() < max_regions)
+        {
+          regions.push_back(region);
+        }
+      else
+        {
+          unsigned int smallest(0);
+          for (unsigned int r = 1; r < regions.size(); ++r)
+            {
+              if (area(regions[r].m_rect) < area(regions[smallest].m_rect))
+                {
+                  smallest = r;
+                }
+            }
+
+          if (area(regions[smallest].m_rect) < area(region.m_rect))
+            {
+              regions[smallest] = region;
+            }
+        }
+    }
+}
+
+void
+PainterPrivate::
+draw_command_list(const fastuidraw::detail::PainterCommandListPrivate &list,
+                  const PictureTransform *picture)
+{
+  using namespace fastuidraw;
+  typedef detail::PainterCommandListPrivate CommandList;
+
+  CommandList::DrawingScope drawing_scope(list);
+  std::vector<reference_counted_ptr<ZDataCallBack> > &occluders(m_work_room.m_command_list.m_occluders);
+  int z_offset(m_current_z - list.m_z_begin);
+  const detail::PackedValuePoolBase::ElementBase *last_matrix_src(nullptr);
+  ExtendedPool::PackedItemMatrix last_matrix;
+  vec2 last_matrix_translate;
+
+  const detail::PackedValuePoolBase::ElementBase *last_clip_src(nullptr);
+  ExtendedPool::PackedClipEquations last_clip;
+
+  /* A recorded matrix has its normalized translate as zero because
+   * layers are not supported in recording; this returns the packed
+   * matrix with the translate set to the passed value (and mapped
+   * by the picture transformation if present), caching the last
+   * value because consecutive draws mostly share the matrix.
+   */
+  auto translated_matrix = [&](const ExtendedPool::PackedItemMatrix &src, vec2 translate)
+    {
+      const detail::PackedValuePoolBase::ElementBase *src_ptr(src);
+      if (src_ptr != last_matrix_src || translate != last_matrix_translate)
+        {
+          PainterItemMatrix M(src.unpacked_value());
+
+          if (picture)
+            {
+              M.m_item_matrix = picture->m_transform * M.m_item_matrix;
+            }
+          M.m_normalized_translate = translate;
+          last_matrix = m_pool.create_packed_value(M);
+          last_matrix_src = src_ptr;
+          last_matrix_translate = translate;
+        }
+      return last_matrix;
+    };
+
+  /* Recorded clip equations that are those of the recording viewport
+   * take the current clipping; others are mapped by the picture
+   * transformation, caching the last value as for the matrix.
+   */
+  auto mapped_clip = [&](const ExtendedPool::PackedClipEquations &src)
+    {
+      const detail::PackedValuePoolBase::ElementBase *src_ptr(src);
+      if (src_ptr == picture->m_base_clip)
+        {
+          return picture->m_current_clip;
+        }
+      if (src_ptr != last_clip_src)
+        {
+          PainterClipEquations C(src.unpacked_value());
+
+          for (vec3 &eq : C.m_clip_equations)
+            {
+              eq = picture->m_transform_inverse_transpose * eq;
+            }
+          last_clip = m_pool.create_packed_value(C);
+          last_clip_src = src_ptr;
+        }
+      return last_clip;
+    };
+
+  compute_occlusion_culled(list, picture);
+
+  occluders.clear();
+  occluders.resize(list.m_number_occluders);
+  for (unsigned int cmd_idx = 0; cmd_idx < list.m_commands.size(); ++cmd_idx)
+    {
+      const CommandList::Command &cmd(list.m_commands[cmd_idx]);
+
+      switch (cmd.m_type)
+        {
+        case CommandList::draw_command:
+          {
+            if (m_work_room.m_command_list.m_culled[cmd_idx])
+              {
+                break;
+              }
+
+            const PainterPackerData &data(list.m_data[cmd.m_data]);
+            CommandList::Writer writer(list, cmd.m_pieces);
+            PainterPacker::DeferredCoverageReadParams coverage_buffer;
+            PainterBlendShader *old_blend(packer()->blend_shader());
+            BlendMode old_blend_mode(packer()->blend_mode());
+
+            if (cmd.m_requires_coverage_buffer && deferred_coverage_packer())
+              {
+                m_deferred_coverage_stack.back().coverage_buffer_params(coverage_buffer);
+              }
+            else if (cmd.m_requires_coverage_buffer && !m_deferred_coverage_stack.empty())
+              {
+                /* the coverage buffer is empty, i.e. the draw is culled */
+                break;
+              }
+
+            packer()->blend_shader(cmd.m_blend_shader, cmd.m_blend_mode);
+            if (picture)
+              {
+                PainterPackerData p(data);
+                vec2 translate(0.0f, 0.0f);
+
+                if (!m_effects_layer_stack.empty())
+                  {
+                    translate = m_effects_layer_stack.back().m_normalized_translate;
+                  }
+                p.m_matrix = translated_matrix(data.m_matrix, translate);
+                p.m_clip = mapped_clip(data.m_clip);
+                packer()->draw_generic(coverage_buffer, cmd.m_shader, p,
+                                       writer, cmd.m_z + z_offset);
+              }
+            else if (m_effects_layer_stack.empty())
+              {
+                packer()->draw_generic(coverage_buffer, cmd.m_shader, data,
+                                       writer, cmd.m_z + z_offset);
+              }
+            else
+              {
+                PainterPackerData p(data);
+
+                p.m_matrix = translated_matrix(data.m_matrix, m_effects_layer_stack.back().m_normalized_translate);
+                packer()->draw_generic(coverage_buffer, cmd.m_shader, p,
+                                       writer, cmd.m_z + z_offset);
+              }
+            packer()->blend_shader(old_blend, old_blend_mode);
+            ++m_draw_data_added_count;
+          }
+          break;
+
+        case CommandList::coverage_draw_command:
+          {
+            PainterPacker *cvg_packer(deferred_coverage_packer());
+            if (cvg_packer)
+              {
+                const DeferredCoverageBufferStackEntry &entry(m_deferred_coverage_stack.back());
+                PainterPackerData p(list.m_data[cmd.m_data]);
+                CommandList::Writer writer(list, cmd.m_pieces);
+
+                p.m_clip = entry.clip_eq_state();
+                p.m_matrix = translated_matrix(p.m_matrix, entry.normalized_translate());
+                cvg_packer->draw_generic(cmd.m_coverage_shader, p, writer);
+                packer()->set_coverage_surface(cvg_packer->surface());
+              }
+            else if (m_deferred_coverage_stack.empty())
+              {
+                FASTUIDRAWwarning(!"Warning: coverage_shader present but no coverage buffer present\n");
+              }
+          }
+          break;
+
+        case CommandList::action_command:
+          packer()->draw_break(cmd.m_action);
+          break;
+
+        case CommandList::begin_coverage_buffer_command:
+          if (picture && cmd.m_non_empty)
+            {
+              Rect R(transform_normalized_rect(picture->m_transform, cmd.m_rect));
+              bool non_empty;
+
+              non_empty = !m_clip_rect_state.m_all_content_culled
+                && R.m_min_point.x() < R.m_max_point.x()
+                && R.m_min_point.y() < R.m_max_point.y();
+              begin_coverage_buffer_normalized_rect(R, non_empty);
+            }
+          else
+            {
+              begin_coverage_buffer_normalized_rect(cmd.m_rect, cmd.m_non_empty);
+            }
+          break;
+
+        case CommandList::end_coverage_buffer_command:
+          end_coverage_buffer();
+          break;
+
+        case CommandList::add_occluder_command:
+          occluders[cmd.m_id] = FASTUIDRAWnew ZDataCallBack();
+          packer()->add_callback(occluders[cmd.m_id]);
+          break;
+
+        case CommandList::remove_occluder_command:
+          packer()->remove_callback(occluders[cmd.m_id]);
+          break;
+
+        case CommandList::finalize_occluder_command:
+          for(const auto &s : occluders[cmd.m_id]->m_actions)
+            {
+              ZDelayedAction *ptr;
+              FASTUIDRAWassert(dynamic_cast<ZDelayedAction*>(s.get()) != nullptr);
+              ptr = static_cast<ZDelayedAction*>(s.get());
+              ptr->finalize_z(cmd.m_z + z_offset);
+            }
+          occluders[cmd.m_id].clear();
+          break;
+        }
+    }
+  occluders.clear();
+  m_current_z += list.m_z_end - list.m_z_begin;
+}
+
+bool
+PainterPrivate::
+draw_picture(fastuidraw::Painter *p,
+             const fastuidraw::detail::PainterPicturePrivate &picture,
+             const fastuidraw::float3x3 &matrix)
+{
+  using namespace fastuidraw;
+
+  PictureTransform tr;
+
+  if (m_clip_rect_state.m_all_content_culled)
+    {
+      return true;
+    }
+
+  /* The recorded item matrices map to the clip coordinates of
+   * the recording; m_inverse_projection maps those back to the
+   * coordinates of the picture, from which matrix and then the
+   * current transformation take them to our clip coordinates.
+   */
+  tr.m_transform = m_clip_rect_state.item_matrix() * matrix * picture.m_inverse_projection;
+  tr.m_transform.inverse_transpose(tr.m_transform_inverse_transpose);
+  tr.m_base_clip = picture.m_base_clip;
+  tr.m_current_clip = m_clip_rect_state.clip_equations_state(m_pool);
+
+  if (!picture.m_has_clipped_draws)
+    {
+      draw_command_list(picture.m_list, &tr);
+      return true;
+    }
+
+  /* The draws that were clipped when recording carry their own
+   * (mapped) clip equations, which are not intersected against
+   * the current clipping. Realize that intersection with the
+   * same occluders used by clip_in_rect(); a half plane of the
+   * current clipping that contains all of the viewport needs
+   * no occluder.
+   */
+  const PainterClipEquations &current_clip(tr.m_current_clip.unpacked_value());
+  PainterClipEquations viewport_clip;
+  std::bitset<4> skip_occluder;
+
+  viewport_clip.m_clip_equations[0] = vec3( 1.0f,  0.0f, 1.0f);
+  viewport_clip.m_clip_equations[1] = vec3(-1.0f,  0.0f, 1.0f);
+  viewport_clip.m_clip_equations[2] = vec3( 0.0f,  1.0f, 1.0f);
+  viewport_clip.m_clip_equations[3] = vec3( 0.0f, -1.0f, 1.0f);
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      const vec3 &eq(current_clip.m_clip_equations[i]);
+
+      skip_occluder[i] = dot(eq, vec3(-1.0f, -1.0f, 1.0f)) >= 0.0f
+        && dot(eq, vec3(-1.0f, 1.0f, 1.0f)) >= 0.0f
+        && dot(eq, vec3(1.0f, -1.0f, 1.0f)) >= 0.0f
+        && dot(eq, vec3(1.0f, 1.0f, 1.0f)) >= 0.0f;
+    }
+
+  p->save();
+  draw_half_plane_complement_occluders(p, viewport_clip, current_clip, skip_occluder);
+  draw_command_list(picture.m_list, &tr);
+  p->restore();
+
+  return true;
+}
+
+void
+PainterPrivate::
+add_occluder_callback(const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback)
+{
+  if (m_recording)
+    {
+      callback->m_occluder_id = m_recording->record_add_occluder();
+    }
+  else
+    {
+      packer()->add_callback(callback);
+    }
+}
+
+void
+PainterPrivate::
+remove_occluder_callback(const fastuidraw::reference_counted_ptr<ZDataCallBack> &callback)
+{
+  if (m_recording)
+    {
+      m_recording->record_remove_occluder(callback->m_occluder_id);
+    }
+  else
+    {
+      packer()->remove_callback(callback);
+    }
+}
+
+void
+PainterPrivate::
+begin_implement(fastuidraw::Painter *p,
+                const fastuidraw::PainterSurface::Viewport &vwp,
+                fastuidraw::ivec2 surface_dimensions,
+                const fastuidraw::float3x3 &initial_transformation,
+                const fastuidraw::c_array<const fastuidraw::Rect> *damage_rects,
+                const fastuidraw::vec4 *damage_clear_color)
+{
+  using namespace fastuidraw;
+
+  m_viewport = vwp;
+  m_damage_rects.clear();
+  m_active_surfaces.clear();
+  std::fill(m_stats.begin(), m_stats.end(), 0u);
+  m_timings.clear();
+  m_stats[Painter::num_render_targets] = (m_recording) ? 0 : 1;
+  m_viewport_dimensions = vec2(m_viewport.m_dimensions);
+  m_viewport_dimensions.x() = t_max(1.0f, m_viewport_dimensions.x());
+  m_viewport_dimensions.y() = t_max(1.0f, m_viewport_dimensions.y());
+  /* m_one_pixel_width holds the size of a pixel in
+   * normalized device coordinates whose range is [-1, 1].
+   * Thus, the value is twice the reciprocal of the viewport
+   * dimensions.
+   */
+  m_one_pixel_width = 2.0f / m_viewport_dimensions;
+  m_restore_guard.resize(1);
+  m_restore_guard[0] = 0;
+
+  m_current_z = 1;
+  m_draw_data_added_count = 0;
+  m_clip_rect_state.reset(m_viewport, surface_dimensions);
+  m_clip_store.reset(m_clip_rect_state.clip_equations().m_clip_equations);
+  m_clip_cache.begin_frame();
+  m_filled_selection_cache.begin_frame();
+  m_stroked_selection_cache.begin_frame();
+  m_partitioned_selection_cache.begin_frame();
+  m_brush_intern_cache.begin_frame();
+  p->blend_shader(Painter::blend_porter_duff_src_over);
+
+  Rect ncR;
+  m_viewport.compute_normalized_clip_rect(surface_dimensions, &ncR);
+  p->clip_in_rect(ncR);
+  if (damage_rects)
+    {
+      begin_damage(p, *damage_rects, damage_clear_color);
+    }
+  p->concat(initial_transformation);
+}
+
+void
+PainterPrivate::
+begin_damage(fastuidraw::Painter *p,
+             fastuidraw::c_array<const fastuidraw::Rect> damage_rects,
+             const fastuidraw::vec4 *clear_color)
+{
+  using namespace fastuidraw;
+
+  /* the transformation is still the identity, so logical
+   * coordinates are normalized device coordinates.
+   */
+  BoundingBox<float> union_bb;
+  for (const Rect &pixel_rect : damage_rects)
+    {
+      vec2 p0, p1;
+
+      p0 = m_viewport.compute_normalized_device_coords(pixel_rect.m_min_point);
+      p1 = m_viewport.compute_normalized_device_coords(pixel_rect.m_max_point);
+
+      BoundingBox<float> bb(vec2(t_min(p0.x(), p1.x()), t_min(p0.y(), p1.y())),
+                            vec2(t_max(p0.x(), p1.x()), t_max(p0.y(), p1.y())));
+      bb.intersect_against(m_clip_store.current_bb());
+      if (!bb.empty())
+        {
+          m_damage_rects.push_back(bb.as_rect());
+          union_bb.union_box(bb);
+        }
+    }
+
+  if (union_bb.empty())
+    {
+      writeable_clip_rect_state().m_all_content_culled = true;
+      return;
+    }
+
+  /* the pixels between disjoint damage rects are not cleared,
+   * so drawing must not reach them either; the clip-in of the
+   * bounding box is thus followed by clipping out the gaps.
+   */
+  p->clip_in_rect(union_bb.as_rect());
+  clip_out_damage_gaps(p, union_bb);
+  if (clear_color)
+    {
+      PainterBlendShader *old_blend(packer()->blend_shader());
+      BlendMode old_blend_mode(packer()->blend_mode());
+      PainterBrush brush;
+
+      brush.color(*clear_color);
+      p->blend_shader(Painter::blend_porter_duff_src);
+      p->fill_rects(PainterData(&brush), make_c_array(m_damage_rects), false);
+      packer()->blend_shader(old_blend, old_blend_mode);
+    }
+}
+
+void
+PainterPrivate::
+clip_out_damage_gaps(fastuidraw::Painter *p,
+                     const fastuidraw::BoundingBox<float> &bb)
+{
+  using namespace fastuidraw;
+
+  if (m_damage_rects.size() < 2)
+    {
+      return;
+    }
+
+  /* split bb into the grid made by the sides of the damage
+   * rects; a cell of the grid is either entirely within a
+   * damage rect or entirely outside of all of them.
+   */
+  std::vector<float> xs, ys;
+
+  xs.push_back(bb.min_point().x());
+  xs.push_back(bb.max_point().x());
+  ys.push_back(bb.min_point().y());
+  ys.push_back(bb.max_point().y());
+  for (const Rect &R : m_damage_rects)
+    {
+      xs.push_back(R.m_min_point.x());
+      xs.push_back(R.m_max_point.x());
+      ys.push_back(R.m_min_point.y());
+      ys.push_back(R.m_max_point.y());
+    }
+  std::sort(xs.begin(), xs.end());
+  xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+  std::sort(ys.begin(), ys.end());
+  ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+  std::vector<PainterAttribute> &attribs(m_work_room.m_polygon.m_attribs);
+  std::vector<PainterIndex> &indices(m_work_room.m_polygon.m_indices);
+
+  attribs.clear();
+  indices.clear();
+  for (unsigned int j = 0; j + 1 < ys.size(); ++j)
+    {
+      float cy(0.5f * (ys[j] + ys[j + 1]));
+
+      /* merge the uncovered cells of a row into runs */
+      for (unsigned int i = 0; i + 1 < xs.size();)
+        {
+          unsigned int end_i;
+
+          for (end_i = i; end_i + 1 < xs.size(); ++end_i)
+            {
+              vec2 c(0.5f * (xs[end_i] + xs[end_i + 1]), cy);
+              bool covered(false);
+
+              for (const Rect &R : m_damage_rects)
+                {
+                  covered = covered || BoundingBox<float>(R).contains(c);
+                }
+
+              if (covered)
+                {
+                  break;
+                }
+            }
+
+          if (end_i != i)
+            {
+              PainterIndex v(attribs.size());
+              vecN<vec2, 4> pts;
+
+              pts[0] = vec2(xs[i], ys[j]);
+              pts[1] = vec2(xs[i], ys[j + 1]);
+              pts[2] = vec2(xs[end_i], ys[j + 1]);
+              pts[3] = vec2(xs[end_i], ys[j]);
+              for (const vec2 &pt : pts)
+                {
+                  PainterAttribute A;
+
+                  A.m_attrib0 = pack_vec4(pt.x(), pt.y(), 0.0f, 0.0f);
+                  A.m_attrib1 = uvec4(0u, 0u, 0u, 0u);
+                  A.m_attrib2 = uvec4(0u, 0u, 0u, 0u);
+                  attribs.push_back(A);
+                }
+              indices.push_back(v);
+              indices.push_back(v + 1);
+              indices.push_back(v + 2);
+              indices.push_back(v);
+              indices.push_back(v + 2);
+              indices.push_back(v + 3);
+              i = end_i;
+            }
+          else
+            {
+              ++i;
+            }
+        }
+    }
+
+  if (!indices.empty())
     {
-      p.m_brush_adjust = *m_current_brush_adjust;
-      FASTUIDRAWassert(p.m_brush_adjust);
+      p->clip_out_custom(m_default_shaders.fill_shader().item_shader().get(),
+                         PainterDataValue<PainterItemShaderData>(),
+                         make_c_array(attribs), make_c_array(indices));
     }
-
-  packer()->draw_generic(coverage_buffer, shader, p,
-                         attrib_chunks, index_chunks, index_adjusts,
-                         attrib_chunk_selector, z);
-  ++m_draw_data_added_count;
 }
 
-int
+bool
 PainterPrivate::
-draw_generic(fastuidraw::PainterItemShader *shader,
-             const fastuidraw::PainterData &draw,
-             const fastuidraw::PainterAttributeWriter &src,
-             int z)
+damage_culled(const fastuidraw::BoundingBox<float> &bb)
 {
-  fastuidraw::PainterPackerData p(draw);
-  fastuidraw::PainterPacker *cvg_packer(deferred_coverage_packer());
-  fastuidraw::PainterPacker::DeferredCoverageReadParams coverage_buffer;
-  int return_value;
-  bool requires_coverage_buffer;
-
-  requires_coverage_buffer = src.requires_coverage_buffer()
-    || (shader && shader->coverage_shader());
-
-  if (requires_coverage_buffer && cvg_packer)
-    {
-      FASTUIDRAWassert(!m_deferred_coverage_stack.empty());
-      p.m_clip = m_deferred_coverage_stack.back().clip_eq_state();
-      p.m_matrix = m_clip_rect_state.current_item_matrix_coverage_buffer_state(m_pool);
-      m_deferred_coverage_stack.back().coverage_buffer_params(coverage_buffer);
-
-      FASTUIDRAWassert(p.m_clip);
-      FASTUIDRAWassert(p.m_matrix);
-      fastuidraw::PainterItemCoverageShader *cvg_shader;
-
-      cvg_shader = (shader) ?
-        shader->coverage_shader().get() :
-        nullptr;
+  using namespace fastuidraw;
 
-      cvg_packer->draw_generic(cvg_shader, p, src);
-      packer()->set_coverage_surface(cvg_packer->surface());
-    }
-  else if (requires_coverage_buffer)
+  /* the damage rects are in the coordinates of the
+   * surface of begin(), which are not the coordinates
+   * of the draws within a layer.
+   */
+  if (m_damage_rects.empty() || bb.empty() || !m_effects_layer_stack.empty())
     {
-      FASTUIDRAWwarning(!"Warning: coverage_shader present but no coverage buffer present\n");
+      return false;
     }
 
-  p.m_clip = m_clip_rect_state.clip_equations_state(m_pool);
-  p.m_matrix = m_clip_rect_state.current_item_matrix_state(m_pool);
-  FASTUIDRAWassert(p.m_clip);
-  FASTUIDRAWassert(p.m_matrix);
-  if (m_current_brush_adjust)
+  for (const Rect &R : m_damage_rects)
     {
-      p.m_brush_adjust = *m_current_brush_adjust;
-      FASTUIDRAWassert(p.m_brush_adjust);
+      if (bb.intersects(BoundingBox<float>(R)))
+        {
+          return false;
+        }
     }
-  return_value = packer()->draw_generic(coverage_buffer, shader, p, src, z);
-  ++m_draw_data_added_count;
-  return return_value;
+
+  ++m_stats[Painter::num_damage_culled];
+  return true;
 }
 
 void
@@ -4114,7 +6567,7 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
   const TessellatedPath *tess;
   float thresh;
 
-  draw.make_packed(m_pool);
+  make_packed(draw);
   tess = select_path_for_stroking(path, shader, draw,
                                   apply_anti_aliasing,
                                   stroking_method, thresh);
@@ -4169,20 +6622,28 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
   c_array<const uvec4> item_shader_packed_data(draw.m_item_shader_data.m_packed_value.packed_data());
 
   shader.stroking_data_selector()->stroking_distances(item_shader_packed_data, additional_room);
-  select_subsets(path.partitioned(),
-                 additional_room,
-                 PainterEnums::is_miter_join(js),
-                 m_work_room.m_effect_stroker.m_selection,
-                 &coverage_buffer_bb);
+  const PartitionedTessellatedPath::SubsetSelection &selection
+    = cached_select_subsets(path.partitioned(),
+                            additional_room,
+                            PainterEnums::is_miter_join(js),
+                            m_work_room.m_effect_stroker.m_scratch_selection,
+                            &coverage_buffer_bb);
 
-  m_work_room.m_effect_stroker.m_storage.clear();
-  m_work_room.m_effect_stroker.m_selection.apply_path_effect(effect,
-                                                             m_work_room.m_effect_stroker.m_storage);
+  {
+    detail::PainterPhaseTimer timer(m_timings, Painter::time_path_effect);
+    m_work_room.m_effect_stroker.m_storage.clear();
+    selection.apply_path_effect(effect, m_work_room.m_effect_stroker.m_storage);
+  }
 
   m_work_room.m_effect_stroker.set_source(m_work_room.m_effect_stroker.m_storage,
                                           shader, method, tp, aa);
 
   requires_coverage_buffer = m_work_room.m_effect_stroker.requires_coverage_buffer();
+  if (damage_culled(coverage_buffer_bb))
+    {
+      return;
+    }
+
   if (requires_coverage_buffer)
     {
       if (coverage_buffer_bb.empty())
@@ -4192,6 +6653,9 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
       begin_coverage_buffer_normalized_rect(coverage_buffer_bb.as_rect(), !coverage_buffer_bb.empty());
     }
 
+  OcclusionHint hint;
+  OcclusionHintScope hint_scope(m_occlusion_hint, hint);
+  hint.m_bounds = coverage_buffer_bb;
   draw_generic(nullptr, draw, m_work_room.m_effect_stroker);
 
   if (requires_coverage_buffer)
@@ -4220,6 +6684,11 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
                                                        path, thresh, cp, js, apply_anti_aliasing,
                                                        &coverage_buffer_bb);
 
+  if (damage_culled(coverage_buffer_bb))
+    {
+      return;
+    }
+
   if (requires_coverage_buffer)
     {
       if (coverage_buffer_bb.empty())
@@ -4229,6 +6698,9 @@ stroke_path(const fastuidraw::PainterStrokeShader &shader,
       begin_coverage_buffer_normalized_rect(coverage_buffer_bb.as_rect(), !coverage_buffer_bb.empty());
     }
 
+  OcclusionHint hint;
+  OcclusionHintScope hint_scope(m_occlusion_hint, hint);
+  hint.m_bounds = coverage_buffer_bb;
   draw_generic(nullptr, draw, m_work_room.m_non_effect_stroker);
 
   if (requires_coverage_buffer)
@@ -4246,20 +6718,34 @@ fill_path_compute_opaque_chunks(const fastuidraw::FilledPath &filled_path,
 {
   using namespace fastuidraw;
 
-  unsigned int idx_chunk, atr_chunk, num_subsets;
-
-  workroom.m_subsets.resize(filled_path.number_subsets());
-  num_subsets = select_subsets(filled_path, make_c_array(workroom.m_subsets));
-  workroom.m_subsets.resize(num_subsets);
+  unsigned int idx_chunk, atr_chunk;
+  FilledPathSelection *selection;
 
-  if (num_subsets == 0)
+  selection = cached_select_subsets(filled_path);
+  if (!selection || selection->m_subsets.empty())
     {
+      workroom.m_subsets.clear();
       return;
     }
 
+  workroom.m_subsets = selection->m_subsets;
   workroom.m_ws.set(filled_path, make_c_array(workroom.m_subsets),
                     CustomFillRuleFunction(fill_rule));
 
+  if (selection->m_chunks_fill_rule == fill_rule)
+    {
+      /* the chunks for the selection were computed
+       * when the path was last drawn.
+       */
+      const OpaqueFillWorkRoom &chunks(selection->m_chunks);
+
+      output->m_attrib_chunks = chunks.m_attrib_chunks;
+      output->m_index_chunks = chunks.m_index_chunks;
+      output->m_index_adjusts = chunks.m_index_adjusts;
+      output->m_chunk_selector = chunks.m_chunk_selector;
+      return;
+    }
+
   output->m_attrib_chunks.clear();
   output->m_index_chunks.clear();
   output->m_index_adjusts.clear();
@@ -4276,6 +6762,17 @@ fill_path_compute_opaque_chunks(const fastuidraw::FilledPath &filled_path,
       output->m_index_chunks.push_back(data.index_data_chunk(idx_chunk));
       output->m_index_adjusts.push_back(data.index_adjust_chunk(idx_chunk));
     }
+
+  if (selection->m_volatile)
+    {
+      return;
+    }
+
+  selection->m_chunks.m_attrib_chunks = output->m_attrib_chunks;
+  selection->m_chunks.m_index_chunks = output->m_index_chunks;
+  selection->m_chunks.m_index_adjusts = output->m_index_adjusts;
+  selection->m_chunks.m_chunk_selector = output->m_chunk_selector;
+  selection->m_chunks_fill_rule = fill_rule;
 }
 
 void
@@ -4287,17 +6784,16 @@ fill_path_compute_opaque_chunks(const fastuidraw::FilledPath &filled_path,
 {
   using namespace fastuidraw;
 
-  unsigned int num_subsets;
-
-  workroom.m_subsets.resize(filled_path.number_subsets());
-  num_subsets = select_subsets(filled_path, make_c_array(workroom.m_subsets));
-  workroom.m_subsets.resize(num_subsets);
+  FilledPathSelection *selection;
 
-  if (num_subsets == 0)
+  selection = cached_select_subsets(filled_path);
+  if (!selection || selection->m_subsets.empty())
     {
+      workroom.m_subsets.clear();
       return;
     }
 
+  workroom.m_subsets = selection->m_subsets;
   workroom.m_ws.set(filled_path, make_c_array(workroom.m_subsets), fill_rule);
 
   output->m_attrib_chunks.clear();
@@ -4361,6 +6857,23 @@ fill_path(const fastuidraw::PainterFillShader &shader,
       return;
     }
 
+  OcclusionHint hint;
+  OcclusionHintScope hint_scope(m_occlusion_hint, hint);
+  if (needs_draw_bounds())
+    {
+      BoundingBox<float> bb;
+
+      for (unsigned int s : m_work_room.m_fill_subset.m_subsets)
+        {
+          bb.union_box(filled_path.subset(s).bounding_box());
+        }
+      hint.m_bounds = compute_clip_intersect_rect(bb.as_rect(), (apply_anti_aliasing) ? 1.0f : 0.0f, 0.0f);
+      if (damage_culled(hint.m_bounds))
+        {
+          return;
+        }
+    }
+
   if (apply_anti_aliasing)
     {
       pre_draw_anti_alias_fuzz(filled_path,
@@ -4396,6 +6909,12 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
 {
   using namespace fastuidraw;
 
+  if (!m_damage_rects.empty()
+      && damage_culled(compute_clip_intersect_rect(R, (apply_anti_aliasing) ? 1.0f : 0.0f, 0.0f)))
+    {
+      return;
+    }
+
   /* Save our transformation and clipping state */
   ClipRectState m(m_clip_rect_state);
   RoundedRectTransformations rect_transforms(R, &m_pool);
@@ -4479,7 +6998,7 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
         {
           m_work_room.m_rounded_rect.m_per_corner[i].m_aa_fuzz.m_total_increment_z = 0;
         }
-      m_clip_rect_state = m;
+      writeable_clip_rect_state() = m;
       m_current_brush_adjust = nullptr;
     }
 
@@ -4550,7 +7069,7 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
                    make_c_array(m_work_room.m_rounded_rect.m_per_corner[i].m_opaque_fill.m_index_adjusts),
                    make_c_array(m_work_room.m_rounded_rect.m_per_corner[i].m_opaque_fill.m_chunk_selector),
                    m_current_z + total_incr_z);
-      m_clip_rect_state = m;
+      writeable_clip_rect_state() = m;
 
       m_current_brush_adjust = nullptr;
     }
@@ -4593,7 +7112,7 @@ fill_rounded_rect(const fastuidraw::PainterFillShader &shader,
           draw_anti_alias_fuzz(shader, draw,
                                m_work_room.m_rounded_rect.m_per_corner[i].m_aa_fuzz,
                                m_current_z + incr_z);
-          m_clip_rect_state = m;
+          writeable_clip_rect_state() = m;
 
           m_current_brush_adjust = nullptr;
         }
@@ -4669,69 +7188,387 @@ ready_aa_polygon_attribs(fastuidraw::c_array<const fastuidraw::vec2> pts,
             {
               PainterAttribute A;
 
-              next_outer = m_work_room.m_polygon.m_aa_fuzz_attribs.size();
-              A = anti_alias_edge_attribute(pts[next_i],
-                                            FilledPath::Subset::aa_fuzz_type_on_boundary,
-                                            -sd * n, m_work_room.m_polygon.m_fuzz_increment_z);
-              m_work_room.m_polygon.m_aa_fuzz_attribs.push_back(A);
-            }
+              next_outer = m_work_room.m_polygon.m_aa_fuzz_attribs.size();
+              A = anti_alias_edge_attribute(pts[next_i],
+                                            FilledPath::Subset::aa_fuzz_type_on_boundary,
+                                            -sd * n, m_work_room.m_polygon.m_fuzz_increment_z);
+              m_work_room.m_polygon.m_aa_fuzz_attribs.push_back(A);
+            }
+
+          if (d < 0.0)
+            {
+              current_outer = current_start + 5u;
+              if (!is_closing_edge)
+                {
+                  next_outer = next_start + 2u;
+                }
+            }
+          else
+            {
+              current_outer = current_start + 3u;
+              if (!is_closing_edge)
+                {
+                  next_outer = next_start + 0u;
+                }
+            }
+
+          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(current_outer);
+          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(next_outer);
+          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(center);
+        }
+    }
+}
+
+int
+PainterPrivate::
+fill_convex_polygon(bool allow_sw_clipping,
+                    const fastuidraw::PainterFillShader &shader,
+                    const fastuidraw::PainterData &draw,
+                    fastuidraw::c_array<const fastuidraw::vec2> pts,
+                    bool apply_anti_aliasing, int z)
+{
+  using namespace fastuidraw;
+
+  if (pts.size() < 3 || m_clip_rect_state.m_all_content_culled)
+    {
+      return 0;
+    }
+
+  OcclusionHint hint;
+  OcclusionHintScope hint_scope(m_occlusion_hint, hint);
+  if (needs_draw_bounds())
+    {
+      BoundingBox<float> in_bb;
+
+      in_bb.union_points(pts.begin(), pts.end());
+      hint.m_bounds = compute_clip_intersect_rect(in_bb.as_rect(), (apply_anti_aliasing) ? 1.0f : 0.0f, 0.0f);
+      if (damage_culled(hint.m_bounds))
+        {
+          return 0;
+        }
+      hint.m_opaque_candidate = m_recording && compute_opaque_rect(pts, &hint.m_opaque_rect);
+    }
+
+  if (allow_sw_clipping && !m_hints.clipping_via_hw_clip_planes())
+    {
+      m_clip_rect_state.clip_polygon(pts, m_work_room.m_polygon.m_pts,
+                                     m_work_room.m_clipper.m_vec2s[0]);
+      pts = make_c_array(m_work_room.m_polygon.m_pts);
+      if (pts.size() < 3)
+        {
+          return 0;
+        }
+    }
+
+  BoundingBox<float> cvg_bb;
+  if (apply_anti_aliasing)
+    {
+      BoundingBox<float> in_bb;
+
+      in_bb.union_points(pts.begin(), pts.end());
+      cvg_bb = compute_clip_intersect_rect(in_bb.as_rect(), 1.0f, 0.0f);
+      if (cvg_bb.empty())
+        {
+          return 0;
+        }
+    }
+
+  ready_aa_polygon_attribs(pts, apply_anti_aliasing);
+  ready_non_aa_polygon_attribs(pts);
+
+  draw_generic(shader.item_shader().get(), draw,
+               make_c_array(m_work_room.m_polygon.m_attribs),
+               make_c_array(m_work_room.m_polygon.m_indices),
+               0,
+               m_work_room.m_polygon.m_fuzz_increment_z + z);
+
+  if (apply_anti_aliasing)
+    {
+      begin_coverage_buffer_normalized_rect(cvg_bb.as_rect(), true);
+      draw_generic(shader.aa_fuzz_shader().get(), draw,
+                   make_c_array(m_work_room.m_polygon.m_aa_fuzz_attribs),
+                   make_c_array(m_work_room.m_polygon.m_aa_fuzz_indices),
+                   0, z);
+      end_coverage_buffer();
+    }
+
+  return m_work_room.m_polygon.m_fuzz_increment_z;
+}
+
+bool
+PainterPrivate::
+rect_batch_culled(const fastuidraw::Rect &rect, bool apply_anti_aliasing)
+{
+  using namespace fastuidraw;
+
+  vecN<vec3, 4> clip_pts;
+
+  m_clip_rect_state.apply_item_matrix(rect, clip_pts);
+  if (m_clip_rect_state.poly_is_culled(clip_pts))
+    {
+      return true;
+    }
+
+  return !m_damage_rects.empty()
+    && damage_culled(compute_clip_intersect_rect(rect, (apply_anti_aliasing) ? 1.0f : 0.0f, 0.0f));
+}
+
+int
+PainterPrivate::
+fill_rects(const fastuidraw::PainterFillShader &shader,
+           const fastuidraw::PainterData &draw,
+           fastuidraw::c_array<const fastuidraw::Rect> rects,
+           bool apply_anti_aliasing, int z)
+{
+  using namespace fastuidraw;
+
+  if (rects.empty() || m_clip_rect_state.m_all_content_culled)
+    {
+      return 0;
+    }
+
+  RectBatchWorkRoom &room(m_work_room.m_rect_batch);
+
+  room.m_pts.clear();
+  room.m_polygons.clear();
+  for (const Rect &rect : rects)
+    {
+      /* cull the rect against the clipping region
+       * before doing anything else with it.
+       */
+      if (rect_batch_culled(rect, apply_anti_aliasing))
+        {
+          continue;
+        }
+
+      range_type<unsigned int> R;
+
+      R.m_begin = room.m_pts.size();
+      room.m_pts.push_back(vec2(rect.m_min_point.x(), rect.m_min_point.y()));
+      room.m_pts.push_back(vec2(rect.m_min_point.x(), rect.m_max_point.y()));
+      room.m_pts.push_back(vec2(rect.m_max_point.x(), rect.m_max_point.y()));
+      room.m_pts.push_back(vec2(rect.m_max_point.x(), rect.m_min_point.y()));
+      R.m_end = room.m_pts.size();
+      room.m_polygons.push_back(R);
+    }
+
+  return fill_convex_polygon_batch(shader, draw, apply_anti_aliasing, z);
+}
+
+void
+PainterPrivate::
+add_rounded_rect_outline(const fastuidraw::RoundedRect &R)
+{
+  using namespace fastuidraw;
+
+  enum
+    {
+      max_segments_per_corner = 32
+    };
+
+  /* The corners in the same order as the points of a rect in
+   * fill_rects(); the angle of corner K, going around the
+   * corner's ellipse, starts at 3 * pi / 2 - K * pi / 2 and
+   * decreases by pi / 2.
+   */
+  const enum Rect::corner_t corners[4] =
+    {
+      Rect::minx_miny_corner,
+      Rect::minx_maxy_corner,
+      Rect::maxx_maxy_corner,
+      Rect::maxx_miny_corner,
+    };
+  RectBatchWorkRoom &room(m_work_room.m_rect_batch);
+  range_type<unsigned int> range;
+  float norm(m_clip_rect_state.item_matrix_operator_norm());
+
+  /* corners with a zero radius and corners whose arcs meet give
+   * repeated points (up to round-off) which the anti-aliasing cannot
+   * handle; points closer than 1/64'th of a pixel are merged.
+   */
+  float merge_distance(1.0f / (64.0f * t_max(norm, 1e-6f)));
+  auto same_point = [merge_distance](const vec2 &a, const vec2 &b)
+    {
+      return t_abs(a.x() - b.x()) <= merge_distance
+        && t_abs(a.y() - b.y()) <= merge_distance;
+    };
+
+  range.m_begin = room.m_pts.size();
+  for (unsigned int K = 0; K < 4; ++K)
+    {
+      vec2 radii(R.m_corner_radii[corners[K]]), center;
+      float start_angle, pixel_radius;
+      unsigned int num_segments(1);
+
+      center.x() = (K < 2) ?
+        R.m_min_point.x() + radii.x() :
+        R.m_max_point.x() - radii.x();
+      center.y() = (K == 0 || K == 3) ?
+        R.m_min_point.y() + radii.y() :
+        R.m_max_point.y() - radii.y();
+      start_angle = 1.5f * FASTUIDRAW_PI - static_cast<float>(K) * 0.5f * FASTUIDRAW_PI;
+
+      /* choose the number of segments so that the distance between
+       * the arc and each segment is no more than m_curve_flatness
+       * pixels.
+       */
+      pixel_radius = norm * t_max(radii.x(), radii.y());
+      if (pixel_radius > m_curve_flatness && radii.x() > 0.0f && radii.y() > 0.0f)
+        {
+          float theta;
+
+          theta = 2.0f * t_acos(1.0f - m_curve_flatness / pixel_radius);
+          num_segments = static_cast<unsigned int>(std::ceil(0.5f * FASTUIDRAW_PI / theta));
+          num_segments = t_min(t_max(num_segments, 1u),
+                               static_cast<unsigned int>(max_segments_per_corner));
+        }
+
+      for (unsigned int i = 0; i <= num_segments; ++i)
+        {
+          float angle;
+          vec2 p;
 
-          if (d < 0.0)
-            {
-              current_outer = current_start + 5u;
-              if (!is_closing_edge)
-                {
-                  next_outer = next_start + 2u;
-                }
-            }
-          else
+          angle = start_angle - 0.5f * FASTUIDRAW_PI * static_cast<float>(i) / static_cast<float>(num_segments);
+          p = center + vec2(radii.x() * t_cos(angle), radii.y() * t_sin(angle));
+          if (room.m_pts.size() == range.m_begin || !same_point(room.m_pts.back(), p))
             {
-              current_outer = current_start + 3u;
-              if (!is_closing_edge)
-                {
-                  next_outer = next_start + 0u;
-                }
+              room.m_pts.push_back(p);
             }
-
-          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(current_outer);
-          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(next_outer);
-          m_work_room.m_polygon.m_aa_fuzz_indices.push_back(center);
         }
     }
+
+  while (room.m_pts.size() > range.m_begin + 1u && same_point(room.m_pts.back(), room.m_pts[range.m_begin]))
+    {
+      room.m_pts.pop_back();
+    }
+
+  range.m_end = room.m_pts.size();
+  if (range.m_end - range.m_begin < 3u)
+    {
+      room.m_pts.resize(range.m_begin);
+      return;
+    }
+  room.m_polygons.push_back(range);
 }
 
 int
 PainterPrivate::
-fill_convex_polygon(bool allow_sw_clipping,
-                    const fastuidraw::PainterFillShader &shader,
-                    const fastuidraw::PainterData &draw,
-                    fastuidraw::c_array<const fastuidraw::vec2> pts,
-                    bool apply_anti_aliasing, int z)
+fill_rounded_rects(const fastuidraw::PainterFillShader &shader,
+                   const fastuidraw::PainterData &draw,
+                   fastuidraw::c_array<const fastuidraw::RoundedRect> rects,
+                   bool apply_anti_aliasing, int z)
 {
   using namespace fastuidraw;
 
-  if (pts.size() < 3 || m_clip_rect_state.m_all_content_culled)
+  if (rects.empty() || m_clip_rect_state.m_all_content_culled)
     {
       return 0;
     }
 
-  if (allow_sw_clipping && !m_hints.clipping_via_hw_clip_planes())
+  RectBatchWorkRoom &room(m_work_room.m_rect_batch);
+
+  room.m_pts.clear();
+  room.m_polygons.clear();
+  for (const RoundedRect &R : rects)
     {
-      m_clip_rect_state.clip_polygon(pts, m_work_room.m_polygon.m_pts,
-                                     m_work_room.m_clipper.m_vec2s[0]);
-      pts = make_c_array(m_work_room.m_polygon.m_pts);
-      if (pts.size() < 3)
+      /* a rounded rect is contained within its bounding
+       * rect; skip those whose bounding rect is culled
+       * without computing any of the outline.
+       */
+      if (!rect_batch_culled(R, apply_anti_aliasing))
         {
-          return 0;
+          add_rounded_rect_outline(R);
         }
     }
 
-  BoundingBox<float> cvg_bb;
-  if (apply_anti_aliasing)
+  return fill_convex_polygon_batch(shader, draw, apply_anti_aliasing, z);
+}
+
+int
+PainterPrivate::
+fill_convex_polygon_batch(const fastuidraw::PainterFillShader &shader,
+                          const fastuidraw::PainterData &draw,
+                          bool apply_anti_aliasing, int z)
+{
+  using namespace fastuidraw;
+
+  RectBatchWorkRoom &room(m_work_room.m_rect_batch);
+  bool sw_clipping(!m_hints.clipping_via_hw_clip_planes());
+  BoundingBox<float> in_bb;
+  int fuzz_increment_z(0);
+  OcclusionHint hint;
+  float opaque_area(0.0f);
+
+  room.m_fill.clear();
+  room.m_aa_fuzz.clear();
+  for (const range_type<unsigned int> &polygon : room.m_polygons)
     {
-      BoundingBox<float> in_bb;
+      std::vector<PainterAttribute> &attribs(m_work_room.m_polygon.m_attribs);
+      std::vector<PainterIndex> &indices(m_work_room.m_polygon.m_indices);
+      c_array<const vec2> pts;
+
+      pts = make_c_array(room.m_pts).sub_array(polygon);
+      if (m_recording)
+        {
+          Rect R;
+          float A;
+
+          /* a single opaque rect is tracked for the batch; take the largest */
+          if (compute_opaque_rect(pts, &R)
+              && (A = (R.m_max_point.x() - R.m_min_point.x()) * (R.m_max_point.y() - R.m_min_point.y())) > opaque_area)
+            {
+              opaque_area = A;
+              hint.m_opaque_candidate = true;
+              hint.m_opaque_rect = R;
+            }
+        }
+
+      if (sw_clipping)
+        {
+          m_clip_rect_state.clip_polygon(pts, m_work_room.m_polygon.m_pts,
+                                         m_work_room.m_clipper.m_vec2s[0]);
+          pts = make_c_array(m_work_room.m_polygon.m_pts);
+          if (pts.size() < 3)
+            {
+              continue;
+            }
+        }
+
+      attribs.resize(pts.size());
+      for (unsigned int i = 0; i < pts.size(); ++i)
+        {
+          attribs[i].m_attrib0 = pack_vec4(pts[i].x(), pts[i].y(), 0.0f, 0.0f);
+          attribs[i].m_attrib1 = uvec4(0u, 0u, 0u, 0u);
+          attribs[i].m_attrib2 = uvec4(0u, 0u, 0u, 0u);
+        }
+
+      indices.clear();
+      for (unsigned int i = 2; i < pts.size(); ++i)
+        {
+          indices.push_back(0);
+          indices.push_back(i - 1);
+          indices.push_back(i);
+        }
+      room.m_fill.add(make_c_array(attribs), make_c_array(indices));
 
       in_bb.union_points(pts.begin(), pts.end());
+      if (apply_anti_aliasing)
+        {
+          ready_aa_polygon_attribs(pts, true);
+          room.m_aa_fuzz.add(make_c_array(m_work_room.m_polygon.m_aa_fuzz_attribs),
+                             make_c_array(m_work_room.m_polygon.m_aa_fuzz_indices));
+          fuzz_increment_z = t_max(fuzz_increment_z, m_work_room.m_polygon.m_fuzz_increment_z);
+        }
+    }
+
+  if (room.m_fill.empty())
+    {
+      return 0;
+    }
+
+  BoundingBox<float> cvg_bb;
+  if (apply_anti_aliasing)
+    {
       cvg_bb = compute_clip_intersect_rect(in_bb.as_rect(), 1.0f, 0.0f);
       if (cvg_bb.empty())
         {
@@ -4739,26 +7576,36 @@ fill_convex_polygon(bool allow_sw_clipping,
         }
     }
 
-  ready_aa_polygon_attribs(pts, apply_anti_aliasing);
-  ready_non_aa_polygon_attribs(pts);
+  OcclusionHintScope hint_scope(m_occlusion_hint, hint);
+  if (m_recording)
+    {
+      hint.m_bounds = (apply_anti_aliasing) ?
+        cvg_bb :
+        compute_clip_intersect_rect(in_bb.as_rect(), 0.0f, 0.0f);
+    }
 
+  room.m_fill.finalize();
   draw_generic(shader.item_shader().get(), draw,
-               make_c_array(m_work_room.m_polygon.m_attribs),
-               make_c_array(m_work_room.m_polygon.m_indices),
-               0,
-               m_work_room.m_polygon.m_fuzz_increment_z + z);
+               room.m_fill.attrib_chunks(),
+               room.m_fill.index_chunks(),
+               c_array<const int>(),
+               c_array<const unsigned int>(),
+               z + fuzz_increment_z);
 
   if (apply_anti_aliasing)
     {
+      room.m_aa_fuzz.finalize();
       begin_coverage_buffer_normalized_rect(cvg_bb.as_rect(), true);
       draw_generic(shader.aa_fuzz_shader().get(), draw,
-                   make_c_array(m_work_room.m_polygon.m_aa_fuzz_attribs),
-                   make_c_array(m_work_room.m_polygon.m_aa_fuzz_indices),
-                   0, z);
+                   room.m_aa_fuzz.attrib_chunks(),
+                   room.m_aa_fuzz.index_chunks(),
+                   c_array<const int>(),
+                   c_array<const unsigned int>(),
+                   z);
       end_coverage_buffer();
     }
 
-  return m_work_room.m_polygon.m_fuzz_increment_z;
+  return fuzz_increment_z;
 }
 
 void
@@ -4852,6 +7699,129 @@ draw_half_plane_complement(const fastuidraw::PainterFillShader &shader,
     }
 }
 
+void
+PainterPrivate::
+draw_half_plane_complement_occluders(fastuidraw::Painter *p,
+                                     const fastuidraw::PainterClipEquations &occluder_clip,
+                                     const fastuidraw::PainterClipEquations &half_planes,
+                                     std::bitset<4> skip_occluder)
+{
+  using namespace fastuidraw;
+
+  ExtendedPool::PackedClipEquations restore_clip;
+  restore_clip = m_clip_rect_state.clip_equations_state(m_pool);
+
+  /* draw the complement of the half planes. The half planes
+   * are in 3D api coordinates, so set the matrix temporarily
+   * to identity. Note that we pass false to item_matrix_state()
+   * to prevent marking the derived values from the matrix
+   * state from being marked as dirty. These changes to
+   * m_clip_rect_state are undone before returning, so they
+   * are not made through writeable_clip_rect_state().
+   */
+  m_clip_rect_state.override_item_matrix_state(identity_matrix());
+
+  reference_counted_ptr<ZDataCallBack> zdatacallback;
+  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+
+  fastuidraw::PainterBlendShader* old_blend;
+  BlendMode old_blend_mode;
+
+  old_blend = packer()->blend_shader();
+  old_blend_mode = packer()->blend_mode();
+
+  p->blend_shader(Painter::blend_porter_duff_dst);
+
+  /* we temporarily set the clipping to a slightly
+   * larger rectangle when drawing the occluders.
+   * We do this because round off error can have us
+   * miss a few pixels when drawing the occluder
+   */
+  PainterClipEquations slightly_bigger(occluder_clip);
+  for(unsigned int i = 0; i < 4; ++i)
+    {
+      float f;
+      vec3 &eq(slightly_bigger.m_clip_equations[i]);
+
+      f = t_abs(eq.x()) * m_one_pixel_width.x() + t_abs(eq.y()) * m_one_pixel_width.y();
+      eq.z() += 0.5 * f;
+    }
+  m_clip_rect_state.clip_equations(slightly_bigger);
+
+  /* draw the half plane occluders */
+  add_occluder_callback(zdatacallback);
+  for(unsigned int i = 0; i < 4; ++i)
+    {
+      if (!skip_occluder[i])
+        {
+          draw_half_plane_complement(p->default_shaders().fill_shader(),
+                                     PainterData(m_black_brush),
+                                     half_planes.m_clip_equations[i]);
+        }
+    }
+  remove_occluder_callback(zdatacallback);
+
+  m_clip_rect_state.clip_equations_state(restore_clip);
+
+  /* add to occluder stack */
+  m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
+
+  m_clip_rect_state.stop_override_item_matrix_state();
+  packer()->blend_shader(old_blend, old_blend_mode);
+}
+
+void
+PainterPrivate::
+push_effects_layer(const EffectsLayer &R, const fastuidraw::Rect &clip_region_rect)
+{
+  m_effects_layer_stack.push_back(R);
+  ++m_stats[fastuidraw::Painter::num_layers];
+
+  /* Set the clipping equations to the equations coming from clip_region_rect */
+  writeable_clip_rect_state().m_clip_rect = clip_rect(clip_region_rect);
+  writeable_clip_rect_state().set_clip_equations_to_clip_rect(ClipRectState::rect_in_normalized_device_coordinates);
+
+  /* update m_clip_rect_state.m_clip_rect to local coordinates */
+  writeable_clip_rect_state().update_rect_to_transformation();
+
+  /* change m_clip_store so that the current value is just from clip_region_rect */
+  m_clip_store.reset_current_to_rect(clip_region_rect);
+
+  /* set the normalized translation of m_clip_rect_state */
+  writeable_clip_rect_state().set_normalized_device_translate(m_effects_layer_stack.back().m_normalized_translate);
+
+  if (!m_deferred_coverage_stack.empty()
+      && m_deferred_coverage_stack.back().packer())
+    {
+      m_deferred_coverage_stack.back().update_coverage_buffer_offset(this);
+    }
+}
+
+void
+PainterPrivate::
+apply_clip_cache_entry(fastuidraw::Painter *p, const ClipCache::Entry &entry)
+{
+  using namespace fastuidraw;
+
+  ExtendedPool::PackedClipEquations prev_clip;
+  if (!entry.m_skip_occluder.all())
+    {
+      prev_clip = m_clip_rect_state.clip_equations_state(m_pool);
+    }
+
+  m_clip_store.set_current(make_c_array(entry.m_clip),
+                           make_c_array(entry.m_poly),
+                           entry.m_bb);
+  writeable_clip_rect_state().clip_rect_and_equations(entry.m_clip_rect,
+                                                      entry.m_clip_equations);
+  if (prev_clip)
+    {
+      draw_half_plane_complement_occluders(p, entry.m_clip_equations.unpacked_value(),
+                                           prev_clip.unpacked_value(),
+                                           entry.m_skip_occluder);
+    }
+}
+
 fastuidraw::GlyphRenderer
 PainterPrivate::
 compute_glyph_renderer(float format_size,
@@ -4926,53 +7896,181 @@ begin(const reference_counted_ptr<PainterSurface> &surface,
   d->m_effects_layer_factory.begin(*surface);
   d->m_deferred_coverage_stack_entry_factory.begin(*surface);
   d->m_root_packer->begin(surface, clear_color_buffer);
-  d->m_active_surfaces.clear();
-  std::fill(d->m_stats.begin(), d->m_stats.end(), 0u);
-  d->m_stats[Painter::num_render_targets] = 1;
-  d->m_viewport_dimensions = vec2(d->m_viewport.m_dimensions);
-  d->m_viewport_dimensions.x() = t_max(1.0f, d->m_viewport_dimensions.x());
-  d->m_viewport_dimensions.y() = t_max(1.0f, d->m_viewport_dimensions.y());
-  /* m_one_pixel_width holds the size of a pixel in
-   * normalized device coordinates whose range is [-1, 1].
-   * Thus, the value is twice the reciprocal of the viewport
-   * dimensions.
+  d->begin_implement(this, surface->viewport(), surface->dimensions(), initial_transformation);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterSurface> &surface,
+      enum screen_orientation orientation, bool clear_color_buffer)
+{
+  float y1, y2;
+  const PainterSurface::Viewport &vwp(surface->viewport());
+
+  if (orientation == Painter::y_increases_downwards)
+    {
+      y1 = vwp.m_dimensions.y();
+      y2 = 0;
+    }
+  else
+    {
+      y1 = 0;
+      y2 = vwp.m_dimensions.y();
+    }
+  float_orthogonal_projection_params ortho(0, vwp.m_dimensions.x(), y1, y2);
+  begin(surface, float3x3(ortho), clear_color_buffer);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterSurface> &surface,
+      const float3x3 &initial_transformation,
+      c_array<const Rect> damage_rects,
+      bool clear_color_buffer)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  image_atlas().lock_resources();
+  colorstop_atlas().lock_resources();
+  glyph_atlas().lock_resources();
+
+  /* the color buffer is not cleared by the packer;
+   * instead only the damage rects are cleared.
    */
-  d->m_one_pixel_width = 2.0f / d->m_viewport_dimensions;
-  d->m_restore_guard.resize(1);
-  d->m_restore_guard[0] = 0;
-
-  d->m_current_z = 1;
-  d->m_draw_data_added_count = 0;
-  d->m_clip_rect_state.reset(d->m_viewport, surface->dimensions());
-  d->m_clip_store.reset(d->m_clip_rect_state.clip_equations().m_clip_equations);
-  blend_shader(blend_porter_duff_src_over);
+  vec4 clear_color(surface->clear_color());
+  d->m_backend->on_painter_begin();
+  d->m_viewport = surface->viewport();
+  d->m_effects_layer_factory.begin(*surface);
+  d->m_deferred_coverage_stack_entry_factory.begin(*surface);
+  d->m_root_packer->begin(surface, false);
+  d->begin_implement(this, surface->viewport(), surface->dimensions(), initial_transformation,
+                     &damage_rects, (clear_color_buffer) ? &clear_color : nullptr);
+}
 
-  Rect ncR;
-  d->m_viewport.compute_normalized_clip_rect(surface->dimensions(), &ncR);
-  clip_in_rect(ncR);
-  concat(initial_transformation);
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterSurface> &surface,
+      enum screen_orientation orientation,
+      c_array<const Rect> damage_rects,
+      bool clear_color_buffer)
+{
+  float y1, y2;
+  const PainterSurface::Viewport &vwp(surface->viewport());
+
+  if (orientation == Painter::y_increases_downwards)
+    {
+      y1 = vwp.m_dimensions.y();
+      y2 = 0;
+    }
+  else
+    {
+      y1 = 0;
+      y2 = vwp.m_dimensions.y();
+    }
+  float_orthogonal_projection_params ortho(0, vwp.m_dimensions.x(), y1, y2);
+  begin(surface, float3x3(ortho), damage_rects, clear_color_buffer);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterCommandList> &list,
+      const PainterSurface &surface,
+      const float3x3 &initial_transformation)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  FASTUIDRAWassert(list);
+  FASTUIDRAWmessaged_assert(!d->m_recording,
+                            "Painter::begin() called while already recording");
+  FASTUIDRAWmessaged_assert(!static_cast<detail::PainterCommandListPrivate*>(list->m_d)->drawing(),
+                            "Painter::begin() called on a PainterCommandList "
+                            "that is being drawn");
+
+  /* Recording does not touch the backend, the atlases
+   * or any of the PainterPacker objects; all draws are
+   * sent to the PainterCommandList instead.
+   */
+  d->m_recording_list = list;
+  d->m_recording = static_cast<detail::PainterCommandListPrivate*>(list->m_d);
+  d->m_recording->begin_recording(d->m_max_attribs_per_block,
+                                  d->m_max_indices_per_block,
+                                  1);
+  d->begin_implement(this, surface.viewport(), surface.dimensions(), initial_transformation);
+}
+
+void
+fastuidraw::Painter::
+begin(const reference_counted_ptr<PainterCommandList> &list,
+      const PainterSurface &surface,
+      enum screen_orientation orientation)
+{
+  float y1, y2;
+  const PainterSurface::Viewport &vwp(surface.viewport());
+
+  if (orientation == Painter::y_increases_downwards)
+    {
+      y1 = vwp.m_dimensions.y();
+      y2 = 0;
+    }
+  else
+    {
+      y1 = 0;
+      y2 = vwp.m_dimensions.y();
+    }
+  float_orthogonal_projection_params ortho(0, vwp.m_dimensions.x(), y1, y2);
+  begin(list, surface, float3x3(ortho));
 }
 
 void
 fastuidraw::Painter::
-begin(const reference_counted_ptr<PainterSurface> &surface,
-      enum screen_orientation orientation, bool clear_color_buffer)
+begin(const reference_counted_ptr<PainterPicture> &picture,
+      ivec2 dimensions,
+      enum screen_orientation orientation)
 {
+  PainterPrivate *d;
+  detail::PainterPicturePrivate *picture_d;
   float y1, y2;
-  const PainterSurface::Viewport &vwp(surface->viewport());
+
+  d = static_cast<PainterPrivate*>(m_d);
+  FASTUIDRAWassert(picture);
+  FASTUIDRAWmessaged_assert(!d->m_recording,
+                            "Painter::begin() called while already recording");
+
+  picture_d = static_cast<detail::PainterPicturePrivate*>(picture->m_d);
+  FASTUIDRAWmessaged_assert(!picture_d->m_list.m_recording,
+                            "Painter::begin() called on a PainterPicture "
+                            "already being recorded");
+  picture_d->clear();
 
   if (orientation == Painter::y_increases_downwards)
     {
-      y1 = vwp.m_dimensions.y();
+      y1 = dimensions.y();
       y2 = 0;
     }
   else
     {
       y1 = 0;
-      y2 = vwp.m_dimensions.y();
+      y2 = dimensions.y();
     }
-  float_orthogonal_projection_params ortho(0, vwp.m_dimensions.x(), y1, y2);
-  begin(surface, float3x3(ortho), clear_color_buffer);
+  float_orthogonal_projection_params ortho(0, dimensions.x(), y1, y2);
+  float3x3 projection(ortho);
+
+  d->m_recording_picture_ref = picture;
+  d->m_recording_picture = picture_d;
+  d->m_recording = &picture_d->m_list;
+  d->m_recording->begin_recording(d->m_max_attribs_per_block,
+                                  d->m_max_indices_per_block,
+                                  1);
+  d->begin_implement(this, PainterSurface::Viewport(0, 0, dimensions.x(), dimensions.y()),
+                     dimensions, projection);
+
+  picture_d->m_dimensions = dimensions;
+  projection.inverse(picture_d->m_inverse_projection);
+  picture_d->m_base_clip = d->m_clip_rect_state.clip_equations_state(d->m_pool);
+  picture_d->m_glyph_cache = &glyph_cache();
+  picture_d->m_number_times_atlas_cleared = glyph_cache().number_times_atlas_cleared();
 }
 
 fastuidraw::c_array<const fastuidraw::PainterSurface* const>
@@ -5011,6 +8109,23 @@ end(void)
   d->m_clip_store.clear();
   d->m_state_stack.clear();
 
+  if (d->m_recording)
+    {
+      if (d->m_recording_picture)
+        {
+          d->m_recording_picture->end_recording(d->m_current_z);
+          d->m_recording_picture = nullptr;
+          d->m_recording_picture_ref.clear();
+        }
+      else
+        {
+          d->m_recording->end_recording(d->m_current_z);
+        }
+      d->m_recording = nullptr;
+      d->m_recording_list.clear();
+      return c_array<const PainterSurface* const>();
+    }
+
   /* issue the PainterPacker::end() to send the commands to the GPU;
    * we issue the end()'s in the order:
    *   1. m_deferred_coverage_stack_entry_factory because a effects
@@ -5045,7 +8160,7 @@ flush(const reference_counted_ptr<PainterSurface> &new_surface)
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
 
-  if (!surface() || !new_surface)
+  if (!surface() || !new_surface || d->m_recording)
     {
       /* not actively drawing */
       return routine_fail;
@@ -5288,7 +8403,60 @@ queue_action(const reference_counted_ptr<const PainterDrawBreakAction> &action)
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  d->packer()->draw_break(action);
+  if (d->m_recording)
+    {
+      d->m_recording->record_action(action);
+    }
+  else
+    {
+      d->packer()->draw_break(action);
+    }
+}
+
+void
+fastuidraw::Painter::
+draw_command_list(const PainterCommandList &list)
+{
+  PainterPrivate *d;
+  detail::PainterCommandListPrivate *list_d;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  list_d = static_cast<detail::PainterCommandListPrivate*>(list.m_d);
+
+  FASTUIDRAWmessaged_assert(!list_d->m_recording,
+                            "Painter::draw_command_list() called on a "
+                            "PainterCommandList that is recording");
+  FASTUIDRAWmessaged_assert(!d->m_recording,
+                            "Painter::draw_command_list() not supported "
+                            "while recording to a PainterCommandList");
+  if (list_d->m_recording || d->m_recording)
+    {
+      return;
+    }
+  d->draw_command_list(*list_d);
+}
+
+bool
+fastuidraw::Painter::
+draw_picture(const PainterPicture &picture, const float3x3 &matrix)
+{
+  PainterPrivate *d;
+  detail::PainterPicturePrivate *picture_d;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  picture_d = static_cast<detail::PainterPicturePrivate*>(picture.m_d);
+
+  FASTUIDRAWmessaged_assert(!picture_d->m_list.m_recording,
+                            "Painter::draw_picture() called on a "
+                            "PainterPicture that is recording");
+  FASTUIDRAWmessaged_assert(!d->m_recording,
+                            "Painter::draw_picture() not supported "
+                            "while recording");
+  if (d->m_recording || !picture_d->valid())
+    {
+      return false;
+    }
+  return d->draw_picture(this, *picture_d, matrix);
 }
 
 void
@@ -5363,6 +8531,96 @@ fill_rounded_rect(const PainterData &draw, const RoundedRect &R,
   fill_rounded_rect(default_shaders().fill_shader(), draw, R, apply_shader_anti_aliasing);
 }
 
+void
+fastuidraw::Painter::
+fill_rects(const PainterFillShader &shader, const PainterData &draw,
+           c_array<const Rect> rects,
+           bool apply_shader_anti_aliasing)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  d->m_current_z += d->fill_rects(shader, draw, rects, apply_shader_anti_aliasing, d->m_current_z);
+}
+
+void
+fastuidraw::Painter::
+fill_rects(const PainterData &draw, c_array<const Rect> rects,
+           bool apply_shader_anti_aliasing)
+{
+  fill_rects(default_shaders().fill_shader(), draw, rects, apply_shader_anti_aliasing);
+}
+
+void
+fastuidraw::Painter::
+fill_rects(const PainterFillShader &shader, const PainterData &draw,
+           c_array<const Rect> rects,
+           c_array<const PainterData::brush_value> brushes,
+           bool apply_shader_anti_aliasing)
+{
+  PainterPrivate *d;
+  PainterData draw_run(draw);
+  unsigned int begin(0);
+
+  d = static_cast<PainterPrivate*>(m_d);
+  FASTUIDRAWassert(rects.size() == brushes.size());
+  if (rects.size() != brushes.size() || d->m_clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  /* draw each run of consecutive rects that share the
+   * same brush with a single batch.
+   */
+  while (begin < rects.size())
+    {
+      const PainterData::brush_value &br(brushes[begin]);
+      unsigned int end(begin + 1);
+
+      while (end < rects.size()
+             && brushes[end].brush_shader() == br.brush_shader()
+             && brushes[end].brush_shader_data().m_value == br.brush_shader_data().m_value
+             && brushes[end].brush_shader_data().m_packed_value == br.brush_shader_data().m_packed_value)
+        {
+          ++end;
+        }
+
+      draw_run.set(br);
+      d->m_current_z += d->fill_rects(shader, draw_run, rects.sub_array(begin, end - begin),
+                                      apply_shader_anti_aliasing, d->m_current_z);
+      begin = end;
+    }
+}
+
+void
+fastuidraw::Painter::
+fill_rects(const PainterData &draw, c_array<const Rect> rects,
+           c_array<const PainterData::brush_value> brushes,
+           bool apply_shader_anti_aliasing)
+{
+  fill_rects(default_shaders().fill_shader(), draw, rects, brushes, apply_shader_anti_aliasing);
+}
+
+void
+fastuidraw::Painter::
+fill_rounded_rects(const PainterFillShader &shader, const PainterData &draw,
+                   c_array<const RoundedRect> rects,
+                   bool apply_shader_anti_aliasing)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  d->m_current_z += d->fill_rounded_rects(shader, draw, rects, apply_shader_anti_aliasing, d->m_current_z);
+}
+
+void
+fastuidraw::Painter::
+fill_rounded_rects(const PainterData &draw, c_array<const RoundedRect> rects,
+                   bool apply_shader_anti_aliasing)
+{
+  fill_rounded_rects(default_shaders().fill_shader(), draw, rects, apply_shader_anti_aliasing);
+}
+
 float
 fastuidraw::Painter::
 compute_path_thresh(const fastuidraw::Path &path)
@@ -5627,20 +8885,35 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
     }
 
   unsigned int num;
-  d->m_work_room.m_glyph.m_subsets.resize(glyph_sequence.number_subsets());
-  num = glyph_sequence.select_subsets(d->m_work_room.m_glyph.m_scratch,
-                                      d->m_clip_store.current(),
-                                      d->m_clip_rect_state.item_matrix(),
-                                      make_c_array(d->m_work_room.m_glyph.m_subsets));
+  {
+    detail::PainterPhaseTimer timer(d->m_timings, time_subset_selection);
+    d->m_work_room.m_glyph.m_subsets.resize(glyph_sequence.number_subsets());
+    num = glyph_sequence.select_subsets(d->m_work_room.m_glyph.m_scratch,
+                                        d->m_clip_store.current(),
+                                        d->m_clip_rect_state.item_matrix(),
+                                        make_c_array(d->m_work_room.m_glyph.m_subsets));
+  }
   d->m_work_room.m_glyph.m_attribs.resize(num);
   d->m_work_room.m_glyph.m_indices.resize(num);
-  for (unsigned int k = 0; k < num; ++k)
+  for (unsigned int k = 0, dst = 0; k < num; ++k)
     {
       unsigned int I(d->m_work_room.m_glyph.m_subsets[k]);
       GlyphSequence::Subset S(glyph_sequence.subset(I));
+      Rect bb;
+
+      if (!d->m_damage_rects.empty()
+          && S.bounding_box(&bb)
+          && d->damage_culled(d->compute_clip_intersect_rect(bb, 0.0f, 0.0f)))
+        {
+          d->m_work_room.m_glyph.m_attribs.pop_back();
+          d->m_work_room.m_glyph.m_indices.pop_back();
+          continue;
+        }
+
       S.attributes_and_indices(renderer,
-                   &d->m_work_room.m_glyph.m_attribs[k],
-                   &d->m_work_room.m_glyph.m_indices[k]);
+                   &d->m_work_room.m_glyph.m_attribs[dst],
+                   &d->m_work_room.m_glyph.m_indices[dst]);
+      ++dst;
     }
   d->draw_generic(shader.shader(renderer.m_type).get(),
                   draw,
@@ -5867,7 +9140,7 @@ transformation(const float3x3 &m)
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-  d->m_clip_rect_state.item_matrix(m, true, unclassified_matrix);
+  d->writeable_clip_rect_state().item_matrix(m, true, unclassified_matrix);
 }
 
 void
@@ -5933,6 +9206,25 @@ curve_flatness(void)
   return d->m_curve_flatness;
 }
 
+void
+fastuidraw::Painter::
+reorder_shader_groups(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_reorder_shader_groups = v;
+  d->m_root_packer->reorder_shader_groups(v);
+}
+
+bool
+fastuidraw::Painter::
+reorder_shader_groups(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_reorder_shader_groups;
+}
+
 void
 fastuidraw::Painter::
 save(void)
@@ -5940,15 +9232,20 @@ save(void)
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
 
-  state_stack_entry st;
+  /* the clipping state is not copied here; it is copied
+   * only when it is first changed, see
+   * PainterPrivate::writeable_clip_rect_state() and
+   * ClipEquationStore::push().
+   */
+  d->m_state_stack.push_back(state_stack_entry());
+
+  state_stack_entry &st(d->m_state_stack.back());
   st.m_occluder_stack_position = d->m_occluder_stack.size();
   st.m_blend = d->packer()->blend_shader();
   st.m_blend_mode = d->packer()->blend_mode();
-  st.m_clip_rect_state = d->m_clip_rect_state;
   st.m_curve_flatness = d->m_curve_flatness;
   st.m_deferred_coverage_buffer_depth = d->m_deferred_coverage_stack.size();
 
-  d->m_state_stack.push_back(st);
   d->m_clip_store.push();
 }
 
@@ -5980,9 +9277,12 @@ restore(void)
   FASTUIDRAWmessaged_assert(!d->m_state_stack.empty(),
                             "Painter::restore() attempting to restoure without "
                             "matching save");
-  const state_stack_entry &st(d->m_state_stack.back());
+  state_stack_entry &st(d->m_state_stack.back());
 
-  d->m_clip_rect_state = st.m_clip_rect_state;
+  if (st.m_clip_rect_state_saved)
+    {
+      std::swap(d->m_clip_rect_state, st.m_clip_rect_state);
+    }
   d->packer()->blend_shader(st.m_blend, st.m_blend_mode);
   d->m_curve_flatness = st.m_curve_flatness;
   while(d->m_occluder_stack.size() > st.m_occluder_stack_position)
@@ -6020,6 +9320,25 @@ begin_layer(const reference_counted_ptr<const PainterEffect> &effect,
 
   d = static_cast<PainterPrivate*>(m_d);
 
+  if (d->m_recording)
+    {
+      /* layers require a PainterPacker to draw to; when recording
+       * we only track the state so that end_layer() is correct.
+       */
+      FASTUIDRAWwarning(!"Warning: begin_layer() is not supported when "
+                        "recording to a PainterCommandList\n");
+
+      EffectsStackEntry fx_entry;
+
+      save();
+      fx_entry.m_effects_layer_stack_size = d->m_effects_layer_stack.size();
+      fx_entry.m_state_stack_size = d->m_state_stack.size();
+      d->m_effects_stack.push_back(fx_entry);
+      blend_shader(blend_porter_duff_src_over);
+      d->m_restore_guard.push_back(d->m_state_stack.size());
+      return;
+    }
+
   clip_region_bounds(&clip_region_rect.m_min_point,
                      &clip_region_rect.m_max_point);
 
@@ -6075,34 +9394,103 @@ begin_layer(const reference_counted_ptr<const PainterEffect> &effect,
                   d->m_viewport_dimensions, this);
 
       /* after issuing the blit command, then add R to m_effects_layer_stack */
-      d->m_effects_layer_stack.push_back(R);
-      ++d->m_stats[num_layers];
+      d->push_effects_layer(R, clip_region_rect);
+    }
+
+  /* Set the packer's blend shader, mode and blend shader to
+   * Painter default values
+   */
+  blend_shader(blend_porter_duff_src_over);
+  d->m_restore_guard.push_back(d->m_state_stack.size());
+}
+
+bool
+fastuidraw::Painter::
+begin_cached_layer(unsigned int ID, const vec4 &color_modulate)
+{
+  PainterPrivate *d;
+  Rect clip_region_rect;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  if (d->m_recording)
+    {
+      begin_layer(color_modulate);
+      return true;
+    }
+
+  /* the surface of a cached layer holds the content of
+   * only one layer; a second use of the same ID in the
+   * same frame would overwrite the content of the first
+   * while it is still to be blitted, so it is drawn as
+   * an ordinary transparency layer instead.
+   */
+  FASTUIDRAWmessaged_assert(!d->m_effects_layer_factory.cached_fetched_this_frame(ID),
+                            "Painter::begin_cached_layer() called with the "
+                            "same ID twice within a frame");
+  if (d->m_effects_layer_factory.cached_fetched_this_frame(ID))
+    {
+      begin_layer(color_modulate);
+      return true;
+    }
 
-      /* Set the clipping equations to the equations coming from clip_region_rect */
-      d->m_clip_rect_state.m_clip_rect = clip_rect(clip_region_rect);
-      d->m_clip_rect_state.set_clip_equations_to_clip_rect(ClipRectState::rect_in_normalized_device_coordinates);
+  clip_region_bounds(&clip_region_rect.m_min_point,
+                     &clip_region_rect.m_max_point);
+  save();
 
-      /* update d->m_clip_rect_state.m_clip_rect to local coordinates */
-      d->m_clip_rect_state.update_rect_to_transformation();
+  EffectsStackEntry fx_entry;
+  EffectsLayer R;
+  bool use_cached;
 
-      /* change m_clip_store so that the current value is just from clip_region_rect */
-      d->m_clip_store.reset_current_to_rect(clip_region_rect);
+  fx_entry.m_effects_layer_stack_size = d->m_effects_layer_stack.size();
+  fx_entry.m_state_stack_size = d->m_state_stack.size();
+  d->m_effects_stack.push_back(fx_entry);
 
-      /* set the normalized translation of d->m_clip_rect_state */
-      d->m_clip_rect_state.set_normalized_device_translate(d->m_effects_layer_stack.back().m_normalized_translate);
+  R = d->m_effects_layer_factory.fetch_cached(ID, d->m_effects_layer_stack.size(),
+                                              clip_region_rect, d, &use_cached);
 
-      if (!d->m_deferred_coverage_stack.empty()
-          && d->m_deferred_coverage_stack.back().packer())
-        {
-          d->m_deferred_coverage_stack.back().update_coverage_buffer_offset(d);
-        }
+  d->m_work_room.m_fx_brush_params
+    .color(color_modulate)
+    .no_gradient()
+    .no_transformation()
+    .no_repeat_window();
+  R.blit_rect(0, d->m_brush_fx, d->m_work_room.m_fx_brush_params,
+              d->m_viewport_dimensions, this);
+
+  if (use_cached)
+    {
+      /* the content is already in the cached layer; cull
+       * everything drawn until the matching end_layer().
+       */
+      ++d->m_stats[num_layers];
+      d->writeable_clip_rect_state().m_all_content_culled = true;
+    }
+  else
+    {
+      d->push_effects_layer(R, clip_region_rect);
     }
 
-  /* Set the packer's blend shader, mode and blend shader to
-   * Painter default values
-   */
   blend_shader(blend_porter_duff_src_over);
   d->m_restore_guard.push_back(d->m_state_stack.size());
+
+  return !use_cached;
+}
+
+void
+fastuidraw::Painter::
+invalidate_cached_layer(unsigned int ID)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_effects_layer_factory.invalidate_cached(ID);
+}
+
+void
+fastuidraw::Painter::
+invalidate_cached_layers(void)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_effects_layer_factory.invalidate_all_cached();
 }
 
 void
@@ -6300,14 +9688,14 @@ clip_out_path(const FilledPath &path, enum fill_rule_t fill_rule)
   old_blend_mode = d->packer()->blend_mode();
 
   blend_shader(blend_porter_duff_dst);
-  d->packer()->add_callback(zdatacallback);
+  d->add_occluder_callback(zdatacallback);
   d->fill_path(default_shaders().fill_shader(),
                PainterData(d->m_black_brush),
                path, fill_rule, false);
-  d->packer()->remove_callback(zdatacallback);
+  d->remove_occluder_callback(zdatacallback);
   d->packer()->blend_shader(old_blend, old_blend_mode);
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
 }
 
 void
@@ -6338,14 +9726,14 @@ clip_out_path(const FilledPath &path, const CustomFillRuleBase &fill_rule)
   old_blend_mode = d->packer()->blend_mode();
 
   blend_shader(blend_porter_duff_dst);
-  d->packer()->add_callback(zdatacallback);
+  d->add_occluder_callback(zdatacallback);
   d->fill_path(default_shaders().fill_shader(),
                PainterData(d->m_black_brush),
                path, fill_rule, false);
-  d->packer()->remove_callback(zdatacallback);
+  d->remove_occluder_callback(zdatacallback);
   d->packer()->blend_shader(old_blend, old_blend_mode);
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
 }
 
 void
@@ -6381,15 +9769,15 @@ clip_out_custom(PainterItemShader *shader,
   old_blend_mode = d->packer()->blend_mode();
 
   blend_shader(blend_porter_duff_dst);
-  d->packer()->add_callback(zdatacallback);
+  d->add_occluder_callback(zdatacallback);
   draw_generic(shader,
                PainterData(shader_data, d->m_black_brush),
                attrib_chunks, index_chunks,
                index_adjusts, attrib_chunk_selector);
-  d->packer()->remove_callback(zdatacallback);
+  d->remove_occluder_callback(zdatacallback);
   d->packer()->blend_shader(old_blend, old_blend_mode);
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
 }
 
 void
@@ -6433,14 +9821,14 @@ clip_out_rounded_rect(const RoundedRect &R)
   old_blend_mode = d->packer()->blend_mode();
 
   blend_shader(blend_porter_duff_dst);
-  d->packer()->add_callback(zdatacallback);
+  d->add_occluder_callback(zdatacallback);
   d->fill_rounded_rect(default_shaders().fill_shader(),
                        PainterData(d->m_black_brush),
                        R, false);
-  d->packer()->remove_callback(zdatacallback);
+  d->remove_occluder_callback(zdatacallback);
   d->packer()->blend_shader(old_blend, old_blend_mode);
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
 }
 
 void
@@ -6536,7 +9924,7 @@ clip_in_rounded_rect(const RoundedRect &R)
   old_blend_mode = d->packer()->blend_mode();
 
   blend_shader(blend_porter_duff_dst);
-  d->packer()->add_callback(zdatacallback);
+  d->add_occluder_callback(zdatacallback);
   for (int i = 0; i < 4; ++i)
     {
       translate(rect_transforms.m_adjusts[i].m_translate);
@@ -6546,12 +9934,12 @@ clip_in_rounded_rect(const RoundedRect &R)
                    d->select_filled_path(d->m_rounded_corner_path_complement),
                    nonzero_fill_rule,
                    false);
-      d->m_clip_rect_state = m;
+      d->writeable_clip_rect_state() = m;
     }
-  d->packer()->remove_callback(zdatacallback);
+  d->remove_occluder_callback(zdatacallback);
   d->packer()->blend_shader(old_blend, old_blend_mode);
 
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+  d->m_occluder_stack.push_back(occluder_stack_entry(*zdatacallback));
 }
 
 void
@@ -6561,7 +9949,7 @@ clip_in_rect(const Rect &rect)
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
 
-  d->m_clip_rect_state.m_all_content_culled = d->m_clip_rect_state.m_all_content_culled
+  d->writeable_clip_rect_state().m_all_content_culled = d->m_clip_rect_state.m_all_content_culled
     || rect.m_min_point.x() >= rect.m_max_point.x()
     || rect.m_min_point.y() >= rect.m_max_point.y();
 
@@ -6572,11 +9960,25 @@ clip_in_rect(const Rect &rect)
     }
 
   vecN<vec3, 4> rect_clip_pts;
+  const ClipCache::Entry *cached;
 
   d->m_clip_rect_state.apply_item_matrix(rect, rect_clip_pts);
-  d->m_clip_rect_state.m_all_content_culled = d->m_clip_rect_state.m_all_content_culled
-    || d->m_clip_rect_state.poly_is_culled(rect_clip_pts)
-    || d->m_clip_store.intersect_current_against_polygon(rect_clip_pts);
+  if (d->m_clip_rect_state.poly_is_culled(rect_clip_pts))
+    {
+      d->writeable_clip_rect_state().m_all_content_culled = true;
+      return;
+    }
+
+  /* if the same clipping was done before, take the result from the cache */
+  cached = d->m_clip_cache.fetch(rect, d->m_clip_rect_state, d->m_clip_store);
+  if (cached)
+    {
+      d->apply_clip_cache_entry(this, *cached);
+      return;
+    }
+
+  d->writeable_clip_rect_state().m_all_content_culled =
+    d->m_clip_store.intersect_current_against_polygon(rect_clip_pts);
 
   if (d->m_clip_rect_state.m_all_content_culled)
     {
@@ -6589,8 +9991,9 @@ clip_in_rect(const Rect &rect)
       /* no clipped rect defined yet, just take the arguments
        * as the clipping window
        */
-      d->m_clip_rect_state.m_clip_rect = clip_rect(rect);
-      d->m_clip_rect_state.set_clip_equations_to_clip_rect(ClipRectState::rect_in_local_coordinates);
+      d->writeable_clip_rect_state().m_clip_rect = clip_rect(rect);
+      d->writeable_clip_rect_state().set_clip_equations_to_clip_rect(ClipRectState::rect_in_local_coordinates);
+      d->m_clip_cache.add(d->m_clip_rect_state, d->m_clip_store, d->m_pool, std::bitset<4>().set());
       return;
     }
   else if (!d->m_clip_rect_state.item_matrix_transition_tricky())
@@ -6602,8 +10005,9 @@ clip_in_rect(const Rect &rect)
        * in local coordinates, so we can intersect it with
        * the passed rectangle.
        */
-      d->m_clip_rect_state.m_clip_rect.intersect(clip_rect(rect));
-      d->m_clip_rect_state.set_clip_equations_to_clip_rect(ClipRectState::rect_in_local_coordinates);
+      d->writeable_clip_rect_state().m_clip_rect.intersect(clip_rect(rect));
+      d->writeable_clip_rect_state().set_clip_equations_to_clip_rect(ClipRectState::rect_in_local_coordinates);
+      d->m_clip_cache.add(d->m_clip_rect_state, d->m_clip_store, d->m_pool, std::bitset<4>().set());
       return;
     }
 
@@ -6622,10 +10026,10 @@ clip_in_rect(const Rect &rect)
   prev_clip = d->m_clip_rect_state.clip_equations_state(d->m_pool);
   FASTUIDRAWassert(prev_clip);
 
-  d->m_clip_rect_state.m_clip_rect = clip_rect(rect);
+  d->writeable_clip_rect_state().m_clip_rect = clip_rect(rect);
 
   std::bitset<4> skip_occluder;
-  skip_occluder = d->m_clip_rect_state.set_clip_equations_to_clip_rect(prev_clip,
+  skip_occluder = d->writeable_clip_rect_state().set_clip_equations_to_clip_rect(prev_clip,
                                                                        ClipRectState::rect_in_local_coordinates);
   current_clip = d->m_clip_rect_state.clip_equations_state(d->m_pool);
 
@@ -6638,6 +10042,8 @@ clip_in_rect(const Rect &rect)
       return;
     }
 
+  d->m_clip_cache.add(d->m_clip_rect_state, d->m_clip_store, d->m_pool, skip_occluder);
+
   /* if the new clipping rectangle is completely contained
    * in the older clipping region, then we can skip drawing
    * the complement of the old clipping rectangle as occluders
@@ -6647,61 +10053,9 @@ clip_in_rect(const Rect &rect)
       return;
     }
 
-  /* draw the complement of the half planes. The half planes
-   * are in 3D api coordinates, so set the matrix temporarily
-   * to identity. Note that we pass false to item_matrix_state()
-   * to prevent marking the derived values from the matrix
-   * state from being marked as dirty.
-   */
-  d->m_clip_rect_state.override_item_matrix_state(d->identity_matrix());
-
-  reference_counted_ptr<ZDataCallBack> zdatacallback;
-  zdatacallback = FASTUIDRAWnew ZDataCallBack();
-
-  fastuidraw::PainterBlendShader* old_blend;
-  BlendMode old_blend_mode;
-
-  old_blend = d->packer()->blend_shader();
-  old_blend_mode = d->packer()->blend_mode();
-
-  blend_shader(blend_porter_duff_dst);
-
-  /* we temporarily set the clipping to a slightly
-   * larger rectangle when drawing the occluders.
-   * We do this because round off error can have us
-   * miss a few pixels when drawing the occluder
-   */
-  PainterClipEquations slightly_bigger(current_clip.unpacked_value());
-  for(unsigned int i = 0; i < 4; ++i)
-    {
-      float f;
-      vec3 &eq(slightly_bigger.m_clip_equations[i]);
-
-      f = t_abs(eq.x()) * d->m_one_pixel_width.x() + t_abs(eq.y()) * d->m_one_pixel_width.y();
-      eq.z() += 0.5 * f;
-    }
-  d->m_clip_rect_state.clip_equations(slightly_bigger);
-
-  /* draw the half plane occluders */
-  d->packer()->add_callback(zdatacallback);
-  for(unsigned int i = 0; i < 4; ++i)
-    {
-      if (!skip_occluder[i])
-        {
-          d->draw_half_plane_complement(default_shaders().fill_shader(),
-                                        PainterData(d->m_black_brush),
-                                        prev_clip.unpacked_value().m_clip_equations[i]);
-        }
-    }
-  d->packer()->remove_callback(zdatacallback);
-
-  d->m_clip_rect_state.clip_equations_state(current_clip);
-
-  /* add to occluder stack */
-  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
-
-  d->m_clip_rect_state.stop_override_item_matrix_state();
-  d->packer()->blend_shader(old_blend, old_blend_mode);
+  d->draw_half_plane_complement_occluders(this, current_clip.unpacked_value(),
+                                          prev_clip.unpacked_value(),
+                                          skip_occluder);
 }
 
 fastuidraw::GlyphAtlas&
@@ -6792,6 +10146,7 @@ query_stat(enum query_stats_t st) const
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
+  d->m_timings.write_stats(d->m_stats);
   return d->m_stats[st];
 }
 
@@ -6808,7 +10163,7 @@ query_stats(c_array<unsigned int> dst) const
 {
   PainterPrivate *d;
   d = static_cast<PainterPrivate*>(m_d);
-
+  d->m_timings.write_stats(d->m_stats);
   for (unsigned int i = 0; i < dst.size() && i < PainterPacker::num_stats; ++i)
     {
       dst[i] = d->m_stats[i];
@@ -6834,6 +10189,19 @@ label(enum query_stats_t st)
       EASY(num_ends);
       EASY(num_layers);
       EASY(num_deferred_coverages);
+      EASY(num_state_dedup_hits);
+      EASY(num_state_dedup_misses);
+      EASY(num_draw_breaks_avoided);
+      EASY(num_occlusion_culled);
+      EASY(num_damage_culled);
+      EASY(num_brush_intern_hits);
+      EASY(num_brush_intern_misses);
+      EASY(time_subset_selection);
+      EASY(time_tessellation_fetch);
+      EASY(time_path_effect);
+      EASY(time_attribute_write);
+      EASY(time_state_packing);
+      EASY(time_submission);
     default:
       return "unknown";
     }
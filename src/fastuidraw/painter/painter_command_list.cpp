@@ -0,0 +1,523 @@
+/*!
+ * \file painter_command_list.cpp
+ * \brief file painter_command_list.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <algorithm>
+#include <fastuidraw/painter/painter_command_list.hpp>
+#include <private/painter_backend/painter_command_list_private.hpp>
+#include <private/util_private.hpp>
+
+namespace
+{
+  inline
+  fastuidraw::PainterItemShader*
+  select_shader(fastuidraw::PainterItemShader *shader,
+                const fastuidraw::PainterAttributeWriter::WriteState &state)
+  {
+    return (state.m_item_shader_override) ? state.m_item_shader_override : shader;
+  }
+
+  inline
+  fastuidraw::PainterItemCoverageShader*
+  select_shader(fastuidraw::PainterItemCoverageShader *shader,
+                const fastuidraw::PainterAttributeWriter::WriteState &state)
+  {
+    return (state.m_item_coverage_shader_override) ? state.m_item_coverage_shader_override : shader;
+  }
+}
+
+///////////////////////////////////////////////////////
+// fastuidraw::detail::PainterCommandListPrivate::Writer methods
+bool
+fastuidraw::detail::PainterCommandListPrivate::Writer::
+initialize_state(WriteState *state) const
+{
+  state->m_state[0] = m_pieces.m_begin;
+  state->m_state[1] = NOT_LOADED;
+  state->m_state[2] = 0;
+  if (m_pieces.m_begin < m_pieces.m_end)
+    {
+      set_state_for_current_piece(state);
+      return true;
+    }
+  return false;
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::Writer::
+on_new_store(WriteState *state) const
+{
+  /* the attributes of the group of the current piece
+   * will need to be written to the new store.
+   */
+  state->m_state[1] = NOT_LOADED;
+  state->m_state[2] = 0;
+  set_state_for_current_piece(state);
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::Writer::
+set_state_for_current_piece(WriteState *state) const
+{
+  const Piece &piece(m_list.m_pieces[state->m_state[0]]);
+  unsigned int attrib_begin;
+
+  attrib_begin = piece.m_group_begin;
+  if (state->m_state[1] != NOT_LOADED)
+    {
+      attrib_begin += state->m_state[2];
+    }
+
+  FASTUIDRAWassert(attrib_begin <= piece.m_attribute_end);
+  state->m_min_attributes_for_next = piece.m_attribute_end - attrib_begin;
+  state->m_min_indices_for_next = piece.m_indices.difference();
+  state->m_z_range = piece.m_z_range;
+  state->m_item_shader_override = piece.m_item_shader_override;
+  state->m_item_coverage_shader_override = piece.m_item_coverage_shader_override;
+}
+
+bool
+fastuidraw::detail::PainterCommandListPrivate::Writer::
+write_data(c_array<PainterAttribute> dst_attribs,
+           c_array<PainterIndex> dst_indices,
+           unsigned int attrib_location,
+           WriteState *state,
+           unsigned int *num_attribs_written,
+           unsigned int *num_indices_written) const
+{
+  const Piece &piece(m_list.m_pieces[state->m_state[0]]);
+  unsigned int attrib_begin;
+  c_array<const PainterAttribute> src_attribs;
+  c_array<const PainterIndex> src_indices;
+
+  if (state->m_state[1] == NOT_LOADED)
+    {
+      state->m_state[1] = attrib_location;
+      state->m_state[2] = 0;
+    }
+
+  /* the attributes of a group are always written contiguously */
+  FASTUIDRAWassert(attrib_location == state->m_state[1] + state->m_state[2]);
+
+  attrib_begin = piece.m_group_begin + state->m_state[2];
+  src_attribs = make_c_array(m_list.m_attributes).sub_array(attrib_begin, piece.m_attribute_end - attrib_begin);
+  src_indices = make_c_array(m_list.m_indices).sub_array(piece.m_indices);
+
+  FASTUIDRAWassert(dst_attribs.size() >= src_attribs.size());
+  FASTUIDRAWassert(dst_indices.size() >= src_indices.size());
+  std::copy(src_attribs.begin(), src_attribs.end(), dst_attribs.begin());
+  for (unsigned int i = 0; i < src_indices.size(); ++i)
+    {
+      dst_indices[i] = src_indices[i] + state->m_state[1];
+    }
+
+  *num_attribs_written = src_attribs.size();
+  *num_indices_written = src_indices.size();
+  state->m_state[2] += src_attribs.size();
+
+  ++state->m_state[0];
+  if (state->m_state[0] < m_pieces.m_end)
+    {
+      const Piece &next(m_list.m_pieces[state->m_state[0]]);
+      if (next.m_group_begin != piece.m_group_begin)
+        {
+          state->m_state[1] = NOT_LOADED;
+          state->m_state[2] = 0;
+        }
+      set_state_for_current_piece(state);
+      return true;
+    }
+  else
+    {
+      state->m_min_attributes_for_next = 0;
+      state->m_min_indices_for_next = 0;
+      return false;
+    }
+}
+
+///////////////////////////////////////////////////////
+// fastuidraw::detail::PainterCommandListPrivate methods
+void
+fastuidraw::detail::PainterCommandListPrivate::
+clear(void)
+{
+  FASTUIDRAWmessaged_assert(!drawing(),
+                            "PainterCommandList cleared while being drawn");
+  m_recording = false;
+  m_z_begin = m_z_end = 0;
+  m_number_occluders = 0;
+  m_commands.clear();
+  m_data.clear();
+  m_pieces.clear();
+  m_attributes.clear();
+  m_indices.clear();
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+begin_recording(unsigned int attribs_per_mapping,
+                unsigned int indices_per_mapping,
+                int z)
+{
+  clear();
+  m_recording = true;
+  m_attribs_per_mapping = attribs_per_mapping;
+  m_indices_per_mapping = indices_per_mapping;
+  m_z_begin = m_z_end = z;
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+end_recording(int z)
+{
+  FASTUIDRAWassert(m_recording);
+  FASTUIDRAWassert(z >= m_z_begin);
+  m_recording = false;
+  m_z_end = z;
+}
+
+unsigned int
+fastuidraw::detail::PainterCommandListPrivate::
+add_data(const PainterPackerData &data)
+{
+  /* consecutive draws very often share the same data,
+   * only compare to the last added value though.
+   */
+  if (!m_data.empty())
+    {
+      const PainterPackerData &last(m_data.back());
+      if (static_cast<const PackedValuePoolBase::ElementBase*>(last.m_clip) == data.m_clip
+          && static_cast<const PackedValuePoolBase::ElementBase*>(last.m_matrix) == data.m_matrix
+          && static_cast<const PackedValuePoolBase::ElementBase*>(last.m_brush_adjust) == data.m_brush_adjust
+          && last.m_brush.brush_shader() == data.m_brush.brush_shader()
+          && last.m_brush.brush_shader_data().m_packed_value == data.m_brush.brush_shader_data().m_packed_value
+          && last.m_item_shader_data.m_packed_value == data.m_item_shader_data.m_packed_value
+          && last.m_blend_shader_data.m_packed_value == data.m_blend_shader_data.m_packed_value)
+        {
+          return m_data.size() - 1;
+        }
+    }
+
+  m_data.push_back(data);
+  return m_data.size() - 1;
+}
+
+template<typename ShaderType>
+fastuidraw::range_type<unsigned int>
+fastuidraw::detail::PainterCommandListPrivate::
+record_pieces(ShaderType *pshader,
+              const PainterAttributeWriter &src,
+              int *max_z_end)
+{
+  /* Emulate the logic of PainterPacker::draw_generic_implement()
+   * against a store of size m_attribs_per_mapping attributes
+   * and m_indices_per_mapping indices. We do not give the writer
+   * all the room of the virtual store; instead we cap it so that
+   * the scratch buffers do not need to be as large as a store.
+   */
+  const unsigned int scratch_size(4096);
+  range_type<unsigned int> return_value(m_pieces.size(), m_pieces.size());
+  PainterAttributeWriter::WriteState state;
+  unsigned int group_begin, group_indices;
+  ShaderType *shader;
+  bool data_to_write(true);
+
+  *max_z_end = 0;
+  m_state_values.resize(src.state_length());
+  state.m_state = make_c_array(m_state_values);
+  state.m_min_attributes_for_next = 0;
+  state.m_min_indices_for_next = 0;
+  state.m_z_range.m_begin = state.m_z_range.m_end = 0;
+  state.m_item_shader_override = nullptr;
+  state.m_item_coverage_shader_override = nullptr;
+  if (!src.initialize_state(&state))
+    {
+      return return_value;
+    }
+
+  shader = select_shader(pshader, state);
+  group_begin = m_attributes.size();
+  group_indices = 0;
+  while (shader && data_to_write)
+    {
+      unsigned int attrib_room, index_room;
+
+      attrib_room = m_attribs_per_mapping - (m_attributes.size() - group_begin);
+      index_room = m_indices_per_mapping - group_indices;
+      if (attrib_room < state.m_min_attributes_for_next
+          || index_room < state.m_min_indices_for_next)
+        {
+          src.on_new_store(&state);
+          group_begin = m_attributes.size();
+          group_indices = 0;
+          attrib_room = m_attribs_per_mapping;
+          index_room = m_indices_per_mapping;
+
+          if (attrib_room < state.m_min_attributes_for_next
+              || index_room < state.m_min_indices_for_next)
+            {
+              FASTUIDRAWmessaged_assert(false,
+                                        "Unable to fit chunk into freshly allocated draw command, bailing out");
+              break;
+            }
+        }
+
+      attrib_room = t_min(attrib_room, t_max(scratch_size, state.m_min_attributes_for_next));
+      index_room = t_min(index_room, t_max(scratch_size, state.m_min_indices_for_next));
+      if (m_scratch_attributes.size() < attrib_room)
+        {
+          m_scratch_attributes.resize(attrib_room);
+        }
+      if (m_scratch_indices.size() < index_room)
+        {
+          m_scratch_indices.resize(index_room);
+        }
+
+      Piece piece;
+      unsigned int num_attribs(0), num_indices(0);
+
+      piece.m_group_begin = group_begin;
+      piece.m_z_range = state.m_z_range;
+      piece.m_item_shader_override = state.m_item_shader_override;
+      piece.m_item_coverage_shader_override = state.m_item_coverage_shader_override;
+      *max_z_end = t_max(*max_z_end, state.m_z_range.m_end);
+
+      data_to_write = src.write_data(make_c_array(m_scratch_attributes).sub_array(0, attrib_room),
+                                     make_c_array(m_scratch_indices).sub_array(0, index_room),
+                                     m_attributes.size() - group_begin,
+                                     &state, &num_attribs, &num_indices);
+
+      m_attributes.insert(m_attributes.end(), m_scratch_attributes.begin(),
+                          m_scratch_attributes.begin() + num_attribs);
+
+      piece.m_indices.m_begin = m_indices.size();
+      m_indices.insert(m_indices.end(), m_scratch_indices.begin(),
+                       m_scratch_indices.begin() + num_indices);
+      piece.m_indices.m_end = m_indices.size();
+      piece.m_attribute_end = m_attributes.size();
+      group_indices += num_indices;
+
+      m_pieces.push_back(piece);
+      shader = select_shader(pshader, state);
+    }
+
+  return_value.m_end = m_pieces.size();
+  return return_value;
+}
+
+int
+fastuidraw::detail::PainterCommandListPrivate::
+record_draw(PainterItemShader *shader,
+            PainterBlendShader *blend_shader, BlendMode blend_mode,
+            bool requires_coverage_buffer,
+            const PainterPackerData &data,
+            const Occlusion &occlusion,
+            const PainterAttributeWriter &src, int z)
+{
+  Command cmd(draw_command);
+  int return_value;
+
+  FASTUIDRAWassert(m_recording);
+  cmd.m_shader = shader;
+  cmd.m_blend_shader = blend_shader;
+  cmd.m_blend_mode = blend_mode;
+  cmd.m_requires_coverage_buffer = requires_coverage_buffer;
+  cmd.m_z = z;
+  cmd.m_occlusion = occlusion;
+  cmd.m_pieces = record_pieces(shader, src, &return_value);
+  cmd.m_z_max = z;
+  for (unsigned int i = cmd.m_pieces.m_begin; i < cmd.m_pieces.m_end; ++i)
+    {
+      const range_type<int> &R(m_pieces[i].m_z_range);
+      cmd.m_z_max = t_max(cmd.m_z_max, z + t_max(R.m_begin, R.m_end - 1));
+    }
+  if (cmd.m_pieces.m_begin != cmd.m_pieces.m_end)
+    {
+      cmd.m_data = add_data(data);
+      m_commands.push_back(cmd);
+    }
+  return return_value;
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_coverage_draw(PainterItemCoverageShader *shader,
+                     const PainterPackerData &data,
+                     const PainterAttributeWriter &src)
+{
+  Command cmd(coverage_draw_command);
+  int max_z;
+
+  FASTUIDRAWassert(m_recording);
+  cmd.m_coverage_shader = shader;
+  cmd.m_pieces = record_pieces(shader, src, &max_z);
+  if (cmd.m_pieces.m_begin != cmd.m_pieces.m_end)
+    {
+      cmd.m_data = add_data(data);
+      m_commands.push_back(cmd);
+    }
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_action(const reference_counted_ptr<const PainterDrawBreakAction> &action)
+{
+  Command cmd(action_command);
+
+  FASTUIDRAWassert(m_recording);
+  cmd.m_action = action;
+  m_commands.push_back(cmd);
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_begin_coverage_buffer(const Rect &normalized_rect, bool non_empty)
+{
+  Command cmd(begin_coverage_buffer_command);
+
+  FASTUIDRAWassert(m_recording);
+  cmd.m_rect = normalized_rect;
+  cmd.m_non_empty = non_empty;
+  m_commands.push_back(cmd);
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_end_coverage_buffer(void)
+{
+  FASTUIDRAWassert(m_recording);
+  m_commands.push_back(Command(end_coverage_buffer_command));
+}
+
+unsigned int
+fastuidraw::detail::PainterCommandListPrivate::
+record_add_occluder(void)
+{
+  Command cmd(add_occluder_command);
+
+  FASTUIDRAWassert(m_recording);
+  cmd.m_id = m_number_occluders++;
+  m_commands.push_back(cmd);
+  return cmd.m_id;
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_remove_occluder(unsigned int id)
+{
+  Command cmd(remove_occluder_command);
+
+  FASTUIDRAWassert(m_recording);
+  FASTUIDRAWassert(id < m_number_occluders);
+  cmd.m_id = id;
+  m_commands.push_back(cmd);
+}
+
+void
+fastuidraw::detail::PainterCommandListPrivate::
+record_finalize_occluder(unsigned int id, int z)
+{
+  Command cmd(finalize_occluder_command);
+
+  FASTUIDRAWassert(m_recording);
+  FASTUIDRAWassert(id < m_number_occluders);
+  cmd.m_id = id;
+  cmd.m_z = z;
+  m_commands.push_back(cmd);
+}
+
+///////////////////////////////////////////////////////
+// fastuidraw::PainterCommandList methods
+fastuidraw::PainterCommandList::
+PainterCommandList(void)
+{
+  m_d = FASTUIDRAWnew detail::PainterCommandListPrivate();
+}
+
+fastuidraw::PainterCommandList::
+~PainterCommandList()
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::PainterCommandList::
+clear(void)
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  FASTUIDRAWmessaged_assert(!d->m_recording,
+                            "PainterCommandList::clear() called while recording");
+  d->clear();
+}
+
+bool
+fastuidraw::PainterCommandList::
+empty(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_commands.empty() && d->m_z_begin == d->m_z_end;
+}
+
+bool
+fastuidraw::PainterCommandList::
+recording(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_recording;
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_commands(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_commands.size();
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_attributes(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_attributes.size();
+}
+
+unsigned int
+fastuidraw::PainterCommandList::
+number_indices(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_indices.size();
+}
+
+int
+fastuidraw::PainterCommandList::
+z_increment(void) const
+{
+  detail::PainterCommandListPrivate *d;
+  d = static_cast<detail::PainterCommandListPrivate*>(m_d);
+  return d->m_z_end - d->m_z_begin;
+}
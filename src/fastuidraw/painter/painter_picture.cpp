@@ -0,0 +1,85 @@
+/*!
+ * \file painter_picture.cpp
+ * \brief file painter_picture.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@gmail.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@gmail.com>
+ *
+ */
+
+#include <fastuidraw/painter/painter_picture.hpp>
+#include <private/painter_backend/painter_picture_private.hpp>
+#include <private/util_private.hpp>
+
+///////////////////////////////////////////////////////
+// fastuidraw::PainterPicture methods
+fastuidraw::PainterPicture::
+PainterPicture(void)
+{
+  m_d = FASTUIDRAWnew detail::PainterPicturePrivate();
+}
+
+fastuidraw::PainterPicture::
+~PainterPicture()
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::PainterPicture::
+clear(void)
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  FASTUIDRAWmessaged_assert(!d->m_list.m_recording,
+                            "PainterPicture::clear() called while recording");
+  d->clear();
+}
+
+bool
+fastuidraw::PainterPicture::
+empty(void) const
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  return d->m_list.m_commands.empty();
+}
+
+bool
+fastuidraw::PainterPicture::
+recording(void) const
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  return d->m_list.m_recording;
+}
+
+bool
+fastuidraw::PainterPicture::
+valid(void) const
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  return d->valid();
+}
+
+fastuidraw::ivec2
+fastuidraw::PainterPicture::
+dimensions(void) const
+{
+  detail::PainterPicturePrivate *d;
+  d = static_cast<detail::PainterPicturePrivate*>(m_d);
+  return d->m_dimensions;
+}
@@ -147,6 +147,7 @@ namespace
   {
   public:
     std::vector<fastuidraw::vec3> m_adjusted_clip_eqs;
+    fastuidraw::detail::PackedClipPlanes m_packed_clip_eqs;
     fastuidraw::c_array<const fastuidraw::vec2> m_clipped_rect;
     fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
   };
@@ -598,6 +599,7 @@ select_subsets(bool miter_hunting,
        */
       scratch.m_adjusted_clip_eqs[i] = c * clip_matrix_local;
     }
+  scratch.m_packed_clip_eqs.set(make_c_array(scratch.m_adjusted_clip_eqs));
 
   dst.clear();
   select_subsets_implement(miter_hunting, scratch,
@@ -631,7 +633,7 @@ select_subsets_implement(bool miter_hunting,
 
   /* clip the bounding box of this StrokedPathSubset */
   vecN<vec2, 4> bb;
-  bool unclipped;
+  enum detail::PackedClipPlanes::box_classification_t box_class;
 
   if (miter_hunting)
     {
@@ -641,18 +643,38 @@ select_subsets_implement(bool miter_hunting,
     {
       m_bounding_box.inflated_polygon(bb, item_space_additional_room);
     }
-  unclipped = detail::clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
-                                          bb, &scratch.m_clipped_rect,
-                                          scratch.m_clip_scratch_vec2s);
+  box_class = scratch.m_packed_clip_eqs.classify_box(bb);
 
   //completely clipped
-  if (scratch.m_clipped_rect.empty())
+  if (box_class == detail::PackedClipPlanes::box_culled)
     {
       return false;
     }
 
+  /* not culled by any single plane, clip the box to check
+   * if any of it survives all the planes.
+   */
+  if (box_class == detail::PackedClipPlanes::box_partially_clipped)
+    {
+      bool unclipped;
+
+      unclipped = detail::clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
+                                              bb, &scratch.m_clipped_rect,
+                                              scratch.m_clip_scratch_vec2s);
+      if (scratch.m_clipped_rect.empty())
+        {
+          return false;
+        }
+
+      /* only when classify_box() is not using the packed tests */
+      if (unclipped)
+        {
+          box_class = detail::PackedClipPlanes::box_unclipped;
+        }
+    }
+
   //completely unclipped.
-  if (unclipped || !has_children())
+  if (box_class == detail::PackedClipPlanes::box_unclipped || !has_children())
     {
       dst.push_back(m_ID);
       return true;
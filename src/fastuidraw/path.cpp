@@ -20,13 +20,23 @@
 #include <algorithm>
 #include <cmath>
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/painter/attribute_data/stroked_path.hpp>
+#include <fastuidraw/painter/attribute_data/filled_path.hpp>
 #include <private/util_private.hpp>
 #include <private/util_private_ostream.hpp>
 #include <private/path_util_private.hpp>
 #include <private/bounding_box.hpp>
 #include <private/bezier_util.hpp>
+#include <private/contour_tessellation_cache.hpp>
+#include <private/tessellated_path_levels.hpp>
+#include <private/lazy_reference.hpp>
+#include <private/background_jobs.hpp>
 
 namespace
 {
@@ -170,6 +180,63 @@ namespace
     unsigned int m_minimum_tessellation_recursion;
   };
 
+  /* A BezierFlatteningState tessellates a quadratic or cubic
+   * Bezier curve directly into line segments. By Wang's formula,
+   * if L is the maximum length of the second differences of the
+   * control points of a Bezier curve of degree n, then the line
+   * segments connecting the points of the curve at times i / N
+   * for 0 <= i <= N are within n * (n - 1) * L / (8 * N * N) of
+   * the curve.
+   */
+  class BezierFlatteningState:public fastuidraw::PathContour::tessellation_state
+  {
+  public:
+    explicit
+    BezierFlatteningState(const fastuidraw::PathContour::bezier *h);
+
+    static
+    bool
+    supported(const fastuidraw::PathContour::bezier *h)
+    {
+      return h->pts().size() == 3 || h->pts().size() == 4;
+    }
+
+    virtual
+    unsigned int
+    recursion_depth(void) const
+    {
+      return m_recursion_depth;
+    }
+
+    virtual
+    void
+    resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                        fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                        float *out_max_distance);
+
+  private:
+    enum
+      {
+        points_per_batch = 8
+      };
+
+    void
+    add_segments(unsigned int N, fastuidraw::TessellatedPath::SegmentStorage *out_data) const;
+
+    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::bezier> m_h;
+
+    /* coefficients of the curve in the power basis,
+     * i.e. p(t) = sum_k m_coeffs[k] * t^k
+     */
+    fastuidraw::vecN<fastuidraw::vec2, 4> m_coeffs;
+
+    /* the value n * (n - 1) * L / 8 of Wang's formula */
+    float m_error_numerator;
+
+    unsigned int m_minimum_tessellation_recursion;
+    unsigned int m_recursion_depth;
+  };
+
   class InterpolatorBasePrivate
   {
   public:
@@ -240,9 +307,21 @@ namespace
     float
     distance_to_arc_raw(unsigned int depth, const ArcSegment &A) const;
 
+    /* the children are made on first use; the region belongs to
+     * an interpolator of a PathContour which may be shared by Path
+     * objects that are tessellated on different threads, so they
+     * are made exactly once with m_children_once.
+     */
+    void
+    create_children(void) const
+    {
+      std::call_once(m_children_once, &BezierTessRegion::create_children_implement, this);
+    }
+
     void
-    create_children(void) const;
+    create_children_implement(void) const;
 
+    mutable std::once_flag m_children_once;
     mutable fastuidraw::reference_counted_ptr<BezierTessRegion> m_L, m_R;
     std::vector<fastuidraw::vec2> m_pts;
     float m_start, m_end;
@@ -295,28 +374,49 @@ namespace
     bool m_ended;
 
   private:
+    /* A PathContour can be shared by several Path objects
+     * whose values are computed on different threads; the
+     * values are only updated with m_mutex locked and
+     * m_checked_up_to is published after them so that
+     * once they are up to date reading them does not lock.
+     */
     void
     update(void)
     {
-      while (m_checked_up_to < m_interpolators.size())
+      if (m_checked_up_to.load(std::memory_order_acquire) == m_interpolators.size())
+        {
+          return;
+        }
+
+      std::lock_guard<std::mutex> m(m_mutex);
+      unsigned int checked_up_to(m_checked_up_to.load(std::memory_order_relaxed));
+
+      while (checked_up_to < m_interpolators.size())
         {
           fastuidraw::Rect tmp;
 
-          m_is_flat = m_is_flat && m_interpolators[m_checked_up_to]->is_flat();
-          m_interpolators[m_checked_up_to]->approximate_bounding_box(&tmp);
+          m_is_flat = m_is_flat && m_interpolators[checked_up_to]->is_flat();
+          m_interpolators[checked_up_to]->approximate_bounding_box(&tmp);
           m_bb.union_point(tmp.m_min_point);
           m_bb.union_point(tmp.m_max_point);
-          ++m_checked_up_to;
+          ++checked_up_to;
         }
+      m_checked_up_to.store(checked_up_to, std::memory_order_release);
     }
 
+    std::mutex m_mutex;
     fastuidraw::BoundingBox<float> m_bb;
     bool m_is_flat;
-    unsigned int m_checked_up_to;
+    std::atomic<unsigned int> m_checked_up_to;
   };
 
   class PathPrivate;
 
+  /* A TessellatedPathList holds the tessellations of a Path
+   * made so far. Finding a tessellation that was already made
+   * does not lock; making new tessellations is done with
+   * mutex() locked.
+   */
   class TessellatedPathList
   {
   public:
@@ -326,24 +426,134 @@ namespace
 
     explicit
     TessellatedPathList(void):
-      m_done(false)
+      m_done(false),
+      m_is_flat(false)
     {}
 
-    const TessellatedPathRef&
-    tessellation(const fastuidraw::Path &path, float max_distance);
+    std::mutex&
+    mutex(void)
+    {
+      return m_mutex;
+    }
+
+    /* Returns the tessellation for max_distance if it
+     * was already made and nullptr otherwise; does not
+     * lock.
+     */
+    const TessellatedPath*
+    find(float max_distance) const
+    {
+      const TessellatedPath *p;
+
+      p = m_data.front();
+      if (!p || max_distance <= 0.0f || m_is_flat)
+        {
+          return p;
+        }
+      return m_data.find(max_distance);
+    }
+
+    /* The methods below must be called with mutex() locked */
+    bool
+    empty(void) const
+    {
+      return m_data.elements().empty();
+    }
+
+    /* sets the starting (coarsest) tessellation and the
+     * Refiner used to create the finer tessellations.
+     */
+    void
+    set_base(const TessellatedPathRef &base,
+             const fastuidraw::reference_counted_ptr<TessellatedPath::Refiner> &refiner,
+             bool path_is_flat)
+    {
+      FASTUIDRAWassert(m_data.elements().empty());
+      /* m_is_flat is read by find() only after it sees
+       * the base published by m_data.push_back().
+       */
+      m_is_flat = path_is_flat;
+      m_data.push_back(base);
+      m_refiner = refiner;
+    }
+
+    /* set_base() must have been called before */
+    const TessellatedPath&
+    tessellation(float max_distance);
 
+    /* must not be called while another thread is in find() */
     void
     clear(void)
     {
       m_data.clear();
       m_refiner = nullptr;
       m_done = false;
+      m_is_flat = false;
     }
 
   private:
-    bool m_done;
+    std::mutex m_mutex;
+    bool m_done, m_is_flat;
     fastuidraw::reference_counted_ptr<TessellatedPath::Refiner> m_refiner;
-    std::vector<TessellatedPathRef> m_data;
+    fastuidraw::detail::TessellatedPathLevels m_data;
+  };
+
+  /* A PathPreparations tracks the preparations of a Path
+   * started with Path::prepare_async().
+   */
+  class PathPreparations:fastuidraw::noncopyable
+  {
+  public:
+    PathPreparations(void):
+      m_active(false),
+      m_number_pending(0u)
+    {}
+
+    void
+    start(const fastuidraw::Path &path,
+          fastuidraw::c_array<const float> thresholds,
+          uint32_t what);
+
+    /* see Path::prepared_threshold() */
+    float
+    prepared_threshold(float thresh, uint32_t what);
+
+    /* waits until all preparations are finished */
+    void
+    wait(void);
+
+    /* waits until all preparations are finished and
+     * then forgets what was prepared; called when the
+     * Path is modified.
+     */
+    void
+    clear(void);
+
+  private:
+    class Prepared
+    {
+    public:
+      /* a non-positive value indicates the coarsest tessellation */
+      float m_thresh;
+      uint32_t m_what;
+    };
+
+    void
+    prepare(const fastuidraw::Path &path,
+            const std::vector<float> &thresholds,
+            uint32_t what);
+
+    void
+    prepare_tessellation(const fastuidraw::Path &path,
+                         float thresh, uint32_t what);
+
+    /* true if start() was called since the last clear() */
+    std::atomic<bool> m_active;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    unsigned int m_number_pending;
+    std::vector<Prepared> m_prepared;
   };
 
   class PathPrivate:fastuidraw::noncopyable
@@ -369,13 +579,24 @@ namespace
 
     TessellatedPathList m_tess_list;
 
+    /* per-contour tessellations used to create the
+     * coarsest tessellation of m_tess_list, kept across
+     * edits so that only changed contours are tessellated.
+     */
+    fastuidraw::detail::ContourTessellationCache m_contour_tessellations;
+
     /* m_start_check_bb gives the index into m_contours that
-     * have not had their bounding box absorbed m_bb
+     * have not had their bounding box absorbed m_bb; m_bb is
+     * only modified with m_bb_mutex locked.
      */
-    unsigned int m_start_check_bb;
+    std::mutex m_bb_mutex;
+    std::atomic<unsigned int> m_start_check_bb;
     fastuidraw::BoundingBox<float> m_bb;
     bool m_is_flat;
-    fastuidraw::reference_counted_ptr<const fastuidraw::ShaderFilledPath> m_shader_filled_path;
+    unsigned int m_max_tessellation_threads;
+    bool m_flatten_curves;
+    fastuidraw::detail::LazyReference<fastuidraw::ShaderFilledPath> m_shader_filled_path;
+    PathPreparations m_preparations;
   };
 }
 
@@ -608,6 +829,123 @@ resume_tessellation_worker(const ArcTessellatorStateNode &node,
     }
 }
 
+/////////////////////////////////////////
+// BezierFlatteningState methods
+BezierFlatteningState::
+BezierFlatteningState(const fastuidraw::PathContour::bezier *h):
+  m_h(h),
+  m_minimum_tessellation_recursion(h->minimum_tessellation_recursion()),
+  m_recursion_depth(0)
+{
+  using namespace fastuidraw;
+
+  c_array<const vec2> p(h->pts());
+  float n, L(0.0f);
+
+  FASTUIDRAWassert(supported(h));
+  for (unsigned int i = 0; i + 2 < p.size(); ++i)
+    {
+      L = t_max(L, (p[i] - 2.0f * p[i + 1] + p[i + 2]).magnitude());
+    }
+  n = static_cast<float>(p.size() - 1);
+  m_error_numerator = n * (n - 1.0f) * L / 8.0f;
+
+  if (p.size() == 3)
+    {
+      m_coeffs[0] = p[0];
+      m_coeffs[1] = 2.0f * (p[1] - p[0]);
+      m_coeffs[2] = p[0] - 2.0f * p[1] + p[2];
+      m_coeffs[3] = vec2(0.0f, 0.0f);
+    }
+  else
+    {
+      m_coeffs[0] = p[0];
+      m_coeffs[1] = 3.0f * (p[1] - p[0]);
+      m_coeffs[2] = 3.0f * (p[0] - 2.0f * p[1] + p[2]);
+      m_coeffs[3] = p[3] - p[0] + 3.0f * (p[1] - p[2]);
+    }
+}
+
+void
+BezierFlatteningState::
+resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                    fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                    float *out_max_distance)
+{
+  using namespace fastuidraw;
+  using namespace detail;
+
+  unsigned int N, max_N;
+
+  /* a Refiner increments the recursion allowed on each
+   * refinement, so the limit stays below the point where
+   * the values are just floating point garbage.
+   */
+  max_N = 1u << t_min(tess_params.m_max_recursion,
+                      static_cast<unsigned int>(MAX_REFINE_RECURSION_LIMIT + 1));
+  if (tess_params.m_max_distance > 0.0f)
+    {
+      float f;
+
+      f = std::ceil(t_sqrt(m_error_numerator / tess_params.m_max_distance));
+      N = (f < static_cast<float>(max_N)) ?
+        t_max(1u, static_cast<unsigned int>(f)) :
+        max_N;
+    }
+  else
+    {
+      N = 1u << m_minimum_tessellation_recursion;
+    }
+
+  m_recursion_depth = uint32_log2(N);
+  if ((1u << m_recursion_depth) < N)
+    {
+      ++m_recursion_depth;
+    }
+
+  add_segments(N, out_data);
+  *out_max_distance = m_error_numerator / (static_cast<float>(N) * static_cast<float>(N));
+}
+
+void
+BezierFlatteningState::
+add_segments(unsigned int N, fastuidraw::TessellatedPath::SegmentStorage *out_data) const
+{
+  using namespace fastuidraw;
+
+  vec2 prev(m_h->start_pt());
+  float dt(1.0f / static_cast<float>(N));
+
+  /* The points are computed a batch at a time with the
+   * x and y coordinates in seperate arrays so that the
+   * compiler can evaluate a batch with SIMD instructions.
+   */
+  for (unsigned int i = 1; i < N; i += points_per_batch)
+    {
+      vecN<float, points_per_batch> x, y;
+      unsigned int cnt;
+
+      for (unsigned int j = 0; j < points_per_batch; ++j)
+        {
+          float t;
+
+          t = static_cast<float>(i + j) * dt;
+          x[j] = ((m_coeffs[3].x() * t + m_coeffs[2].x()) * t + m_coeffs[1].x()) * t + m_coeffs[0].x();
+          y[j] = ((m_coeffs[3].y() * t + m_coeffs[2].y()) * t + m_coeffs[1].y()) * t + m_coeffs[0].y();
+        }
+
+      cnt = t_min(static_cast<unsigned int>(points_per_batch), N - i);
+      for (unsigned int j = 0; j < cnt; ++j)
+        {
+          vec2 pt(x[j], y[j]);
+
+          out_data->add_line_segment(prev, pt);
+          prev = pt;
+        }
+    }
+  out_data->add_line_segment(prev, m_h->end_pt());
+}
+
 ////////////////////////////////////////////
 // fastuidraw::PathContour::interpolator_base methods
 fastuidraw::PathContour::interpolator_base::
@@ -742,17 +1080,11 @@ BezierTessRegion(fastuidraw::BoundingBox<float> &bb,
 
 void
 BezierTessRegion::
-create_children(void) const
+create_children_implement(void) const
 {
   using namespace fastuidraw;
 
-  if (m_L)
-    {
-      FASTUIDRAWassert(m_R);
-      return;
-    }
-
-  FASTUIDRAWassert(!m_R);
+  FASTUIDRAWassert(!m_L && !m_R);
   m_L = FASTUIDRAWnew BezierTessRegion(this, true);
   m_R = FASTUIDRAWnew BezierTessRegion(this, false);
 
@@ -943,6 +1275,24 @@ approximate_bounding_box(Rect *out_bb) const
   out_bb->m_max_point = d->m_bb.max_point();
 }
 
+fastuidraw::reference_counted_ptr<fastuidraw::PathContour::tessellation_state>
+fastuidraw::PathContour::bezier::
+produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                     TessellatedPath::SegmentStorage *out_data,
+                     float *out_max_distance) const
+{
+  if (tess_params.m_flatten_curves && BezierFlatteningState::supported(this))
+    {
+      reference_counted_ptr<tessellation_state> return_value;
+
+      return_value = FASTUIDRAWnew BezierFlatteningState(this);
+      return_value->resume_tessellation(tess_params, out_data, out_max_distance);
+      return return_value;
+    }
+
+  return interpolator_generic::produce_tessellation(tess_params, out_data, out_max_distance);
+}
+
 void
 fastuidraw::PathContour::bezier::
 tessellate(reference_counted_ptr<tessellated_region> in_region,
@@ -1509,51 +1859,48 @@ approximate_bounding_box(Rect *out_bb) const
 
 /////////////////////////////////
 // TessellatedPathList methods
-const typename TessellatedPathList::TessellatedPathRef&
+const fastuidraw::TessellatedPath&
 TessellatedPathList::
-tessellation(const fastuidraw::Path &path, float max_distance)
+tessellation(float max_distance)
 {
   using namespace fastuidraw;
   using namespace detail;
 
-  if (m_data.empty())
-    {
-      TessellationParams params;
-      m_data.push_back(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
-    }
+  const std::vector<TessellatedPathRef> &data(m_data.elements());
 
-  if (max_distance <= 0.0 || path.is_flat())
+  FASTUIDRAWassert(!data.empty());
+  if (max_distance <= 0.0 || m_is_flat)
     {
-      return m_data.front();
+      return *data.front();
     }
 
-  if (m_data.back()->max_distance() <= max_distance)
+  if (data.back()->max_distance() <= max_distance)
     {
       typename std::vector<TessellatedPathRef>::const_iterator iter;
-      iter = std::lower_bound(m_data.begin(),
-                              m_data.end(),
+      iter = std::lower_bound(data.begin(),
+                              data.end(),
                               max_distance,
                               reverse_compare_max_distance);
 
-      FASTUIDRAWassert(iter != m_data.end());
+      FASTUIDRAWassert(iter != data.end());
       FASTUIDRAWassert(*iter);
       FASTUIDRAWassert((*iter)->max_distance() <= max_distance);
-      return *iter;
+      return **iter;
     }
 
   if (m_done)
     {
-      return m_data.back();
+      return *data.back();
     }
 
   float current_max_distance;
 
-  current_max_distance = m_data.back()->max_distance();
+  current_max_distance = data.back()->max_distance();
 
-  while(!m_done && m_data.back()->max_distance() > max_distance)
+  while(!m_done && data.back()->max_distance() > max_distance)
     {
       current_max_distance *= 0.5f;
-      while(!m_done && m_data.back()->max_distance() > current_max_distance)
+      while(!m_done && data.back()->max_distance() > current_max_distance)
         {
           TessellatedPathRef ref;
 
@@ -1565,7 +1912,7 @@ tessellation(const fastuidraw::Path &path, float max_distance)
            * (especially with arc-tessellation) more refinement can make
            * the tessellation improve.
            */
-          if (m_data.back()->max_distance() > ref->max_distance())
+          if (data.back()->max_distance() > ref->max_distance())
             {
               m_data.push_back(ref);
             }
@@ -1578,11 +1925,174 @@ tessellation(const fastuidraw::Path &path, float max_distance)
             {
               m_done = true;
               m_refiner = nullptr;
+              m_data.set_complete();
             }
         }
     }
 
-  return m_data.back();
+  return *data.back();
+}
+
+/////////////////////////////////
+// PathPreparations methods
+void
+PathPreparations::
+start(const fastuidraw::Path &path,
+      fastuidraw::c_array<const float> thresholds,
+      uint32_t what)
+{
+  std::vector<float> T(thresholds.begin(), thresholds.end());
+
+  /* prepare the coarser tessellations first so that
+   * they are available sooner.
+   */
+  std::sort(T.begin(), T.end(), std::greater<float>());
+  T.erase(std::unique(T.begin(), T.end()), T.end());
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    ++m_number_pending;
+    m_active.store(true, std::memory_order_release);
+  }
+
+  const fastuidraw::Path *p(&path);
+  fastuidraw::detail::submit_background_job([this, p, T, what]() {
+      prepare(*p, T, what);
+    });
+}
+
+void
+PathPreparations::
+prepare(const fastuidraw::Path &path,
+        const std::vector<float> &thresholds,
+        uint32_t what)
+{
+  prepare_tessellation(path, -1.0f, what);
+  for (float t : thresholds)
+    {
+      if (t > 0.0f)
+        {
+          prepare_tessellation(path, t, what);
+        }
+    }
+
+  /* notify while holding the lock; once the lock is released,
+   * a thread waiting in wait() may destroy this object.
+   */
+  std::lock_guard<std::mutex> m(m_mutex);
+  FASTUIDRAWassert(m_number_pending > 0u);
+  --m_number_pending;
+  m_condition.notify_all();
+}
+
+void
+PathPreparations::
+prepare_tessellation(const fastuidraw::Path &path,
+                     float thresh, uint32_t what)
+{
+  using namespace fastuidraw;
+
+  const TessellatedPath &tess(path.tessellation(thresh));
+  if (what & PathEnums::prepare_filled)
+    {
+      tess.filled(thresh);
+    }
+
+  if (what & PathEnums::prepare_stroked)
+    {
+      tess.stroked();
+      tess.linearization(thresh).stroked();
+    }
+
+  /* merge with the entry of the same threshold so that
+   * the number of entries prepared_threshold() walks is
+   * bounded by the number of distinct thresholds.
+   */
+  std::lock_guard<std::mutex> m(m_mutex);
+  for (Prepared &P : m_prepared)
+    {
+      if (P.m_thresh == thresh)
+        {
+          P.m_what |= what;
+          return;
+        }
+    }
+
+  m_prepared.push_back(Prepared());
+  m_prepared.back().m_thresh = thresh;
+  m_prepared.back().m_what = what;
+}
+
+float
+PathPreparations::
+prepared_threshold(float thresh, uint32_t what)
+{
+  if (thresh <= 0.0f || !m_active.load(std::memory_order_acquire))
+    {
+      return thresh;
+    }
+
+  std::lock_guard<std::mutex> m(m_mutex);
+  bool have_fine(false), have_coarse(false);
+  float fine(0.0f), coarse(0.0f);
+
+  for (const Prepared &P : m_prepared)
+    {
+      if ((P.m_what & what) != what)
+        {
+          continue;
+        }
+
+      if (P.m_thresh > 0.0f && P.m_thresh <= thresh)
+        {
+          fine = (have_fine) ? fastuidraw::t_max(fine, P.m_thresh) : P.m_thresh;
+          have_fine = true;
+        }
+      else if (!have_coarse
+               || (P.m_thresh > 0.0f && (coarse <= 0.0f || P.m_thresh < coarse)))
+        {
+          coarse = P.m_thresh;
+          have_coarse = true;
+        }
+    }
+
+  if (have_fine)
+    {
+      return fine;
+    }
+
+  if (have_coarse && m_number_pending > 0u)
+    {
+      return coarse;
+    }
+
+  return thresh;
+}
+
+void
+PathPreparations::
+wait(void)
+{
+  if (!m_active.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
+  std::unique_lock<std::mutex> m(m_mutex);
+  m_condition.wait(m, [this]() { return m_number_pending == 0u; });
+}
+
+void
+PathPreparations::
+clear(void)
+{
+  if (!m_active.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
+  wait();
+  m_prepared.clear();
+  m_active.store(false, std::memory_order_relaxed);
 }
 
 /////////////////////////////////
@@ -1592,7 +2102,9 @@ PathPrivate(void):
   m_next_edge_type(fastuidraw::PathEnums::starts_new_edge),
   m_tess_list(),
   m_start_check_bb(0),
-  m_is_flat(true)
+  m_is_flat(true),
+  m_max_tessellation_threads(1),
+  m_flatten_curves(false)
 {
 }
 
@@ -1627,6 +2139,10 @@ void
 PathPrivate::
 clear_tesses(void)
 {
+  /* the preparations read the Path, so they must
+   * finish before the Path is changed.
+   */
+  m_preparations.clear();
   m_shader_filled_path.clear();
   m_tess_list.clear();
 }
@@ -1665,6 +2181,7 @@ fastuidraw::Path::
 {
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
+  d->m_preparations.wait();
   FASTUIDRAWdelete(d);
   m_d = nullptr;
 }
@@ -1673,6 +2190,11 @@ void
 fastuidraw::Path::
 swap(Path &obj)
 {
+  /* a preparation fetches the PathPrivate through
+   * the Path it was started from.
+   */
+  static_cast<PathPrivate*>(m_d)->m_preparations.wait();
+  static_cast<PathPrivate*>(obj.m_d)->m_preparations.wait();
   std::swap(obj.m_d, m_d);
 }
 
@@ -1695,8 +2217,9 @@ clear(void)
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
   d->clear_tesses();
+  d->m_contour_tessellations.clear();
   d->m_contours.clear();
-  d->m_start_check_bb = 0u;
+  d->m_start_check_bb.store(0u, std::memory_order_relaxed);
 }
 
 fastuidraw::Path&
@@ -1714,8 +2237,8 @@ add_contour(const reference_counted_ptr<const PathContour> &pcontour)
       contour = contour->deep_copy();
     }
 
-  d->m_is_flat = d->m_is_flat && contour->is_flat();
   d->clear_tesses();
+  d->m_is_flat = d->m_is_flat && contour->is_flat();
 
   if (!d->m_contours.empty())
     {
@@ -1745,6 +2268,8 @@ add_contours(const Path &path)
       return *this;
     }
 
+  d->clear_tesses();
+
   if (!d->m_contours.empty())
     {
       r = d->m_contours.back();
@@ -1767,7 +2292,6 @@ add_contours(const Path &path)
       d->m_contours.push_back(r);
     }
 
-  d->clear_tesses();
   return *this;
 }
 
@@ -1845,7 +2369,97 @@ tessellation(float max_distance) const
 {
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
-  return *d->m_tess_list.tessellation(*this, max_distance);
+
+  const TessellatedPath *p;
+
+  p = d->m_tess_list.find(max_distance);
+  if (p)
+    {
+      return *p;
+    }
+
+  std::lock_guard<std::mutex> m(d->m_tess_list.mutex());
+  if (d->m_tess_list.empty())
+    {
+      reference_counted_ptr<TessellatedPath::Refiner> refiner;
+      reference_counted_ptr<const TessellatedPath> base;
+
+      TessellatedPath::TessellationParams params;
+
+      params
+        .max_number_threads(d->m_max_tessellation_threads)
+        .flatten_curves(d->m_flatten_curves);
+      base = FASTUIDRAWnew TessellatedPath(*this, params, &refiner, &d->m_contour_tessellations);
+      d->m_tess_list.set_base(base, refiner, is_flat());
+    }
+  return d->m_tess_list.tessellation(max_distance);
+}
+
+fastuidraw::Path&
+fastuidraw::Path::
+max_tessellation_threads(unsigned int v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+
+  /* the number of threads does not affect the tessellation,
+   * so there is no need to clear the tessellations.
+   */
+  d->m_preparations.wait();
+  d->m_max_tessellation_threads = v;
+  return *this;
+}
+
+unsigned int
+fastuidraw::Path::
+max_tessellation_threads(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_max_tessellation_threads;
+}
+
+fastuidraw::Path&
+fastuidraw::Path::
+flatten_curves(bool v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+
+  if (v != d->m_flatten_curves)
+    {
+      d->clear_tesses();
+      d->m_contour_tessellations.clear();
+      d->m_flatten_curves = v;
+    }
+  return *this;
+}
+
+bool
+fastuidraw::Path::
+flatten_curves(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_flatten_curves;
+}
+
+void
+fastuidraw::Path::
+prepare_async(c_array<const float> thresholds, uint32_t what) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  d->m_preparations.start(*this, thresholds, what);
+}
+
+float
+fastuidraw::Path::
+prepared_threshold(float thresh, uint32_t what) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_preparations.prepared_threshold(thresh, what);
 }
 
 bool
@@ -1855,16 +2469,21 @@ approximate_bounding_box(Rect *out_bb) const
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
-  for(unsigned endi = d->m_contours.size();
-      d->m_start_check_bb < endi; ++d->m_start_check_bb)
+  unsigned int endi(d->m_contours.size());
+  if (d->m_start_check_bb.load(std::memory_order_acquire) < endi)
     {
-      Rect R;
-
-      if(d->m_contours[d->m_start_check_bb]->approximate_bounding_box(&R))
+      std::lock_guard<std::mutex> m(d->m_bb_mutex);
+      for(unsigned int i = d->m_start_check_bb.load(std::memory_order_relaxed); i < endi; ++i)
         {
-          d->m_bb.union_point(R.m_min_point);
-          d->m_bb.union_point(R.m_max_point);
+          Rect R;
+
+          if(d->m_contours[i]->approximate_bounding_box(&R))
+            {
+              d->m_bb.union_point(R.m_min_point);
+              d->m_bb.union_point(R.m_max_point);
+            }
         }
+      d->m_start_check_bb.store(endi, std::memory_order_release);
     }
 
   out_bb->m_min_point = d->m_bb.min_point();
@@ -2053,16 +2672,17 @@ shader_filled_path(void) const
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
-  if (!d->m_shader_filled_path)
-    {
+  return d->m_shader_filled_path.get([this]() {
       ShaderFilledPath::Builder B;
-      vec2 bb_sz(d->m_bb.size());
+      Rect R;
+      vec2 bb_sz;
       const float rel_tol(1e-4);
       float tol;
 
+      approximate_bounding_box(&R);
+      bb_sz = R.size();
       tol = rel_tol * fastuidraw::t_min(bb_sz.x(), bb_sz.y());
       B.add_path(tol, *this);
-      d->m_shader_filled_path = FASTUIDRAWnew ShaderFilledPath(B);
-    }
-  return *d->m_shader_filled_path;
+      return reference_counted_ptr<const ShaderFilledPath>(FASTUIDRAWnew ShaderFilledPath(B));
+    });
 }
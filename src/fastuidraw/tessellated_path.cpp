@@ -18,9 +18,13 @@
 
 
 #include <list>
+#include <map>
 #include <vector>
 #include <algorithm>
 #include <complex>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/partitioned_tessellated_path.hpp>
 #include <fastuidraw/path.hpp>
@@ -29,6 +33,10 @@
 #include <private/util_private.hpp>
 #include <private/bounding_box.hpp>
 #include <private/path_util_private.hpp>
+#include <private/contour_tessellation_cache.hpp>
+#include <private/tessellated_path_levels.hpp>
+#include <private/lazy_reference.hpp>
+#include <private/background_jobs.hpp>
 
 namespace
 {
@@ -220,11 +228,59 @@ namespace
     fastuidraw::vec2 m_start_pt;
   };
 
+  /* A ContourGroups places the contours of a path into groups so
+   * that contours that are the same PathContour object are in the
+   * same group. The interpolators of a PathContour lazily create
+   * data when tessellated, so the same PathContour must not be
+   * tessellated by two threads at the same time; the contours of a
+   * group are tessellated one after the other by a single thread.
+   * If only one thread is to be used, all contours are placed in
+   * a single group.
+   */
+  class ContourGroups
+  {
+  public:
+    ContourGroups(const fastuidraw::Path &path,
+                  unsigned int max_number_threads);
+
+    ContourGroups(void)
+    {}
+
+    /* m_groups[G] lists the contours of group G */
+    std::vector<std::vector<unsigned int> > m_groups;
+  };
+
   class RefinerPrivate
   {
   public:
     fastuidraw::reference_counted_ptr<fastuidraw::TessellatedPath> m_path;
     std::vector<RefinerContour> m_contours;
+    ContourGroups m_groups;
+  };
+
+  /* Holds the tessellation of an edge before it is added to
+   * a TessellatedPath; the edges of a path are tessellated
+   * first, possibly in parallel, and then added in order so
+   * that the result does not depend on the number of threads.
+   */
+  class EdgeTessellation
+  {
+  public:
+    typedef fastuidraw::PathContour::tessellation_state tessellation_state;
+
+    EdgeTessellation(void):
+      m_max_distance(0.0f),
+      m_tessellate(true)
+    {}
+
+    std::vector<fastuidraw::TessellatedPath::segment> m_segments;
+    float m_max_distance;
+    fastuidraw::reference_counted_ptr<tessellation_state> m_tess_state;
+
+    /* if false, the tessellation of the edge is not computed
+     * (because it is already stored elsewhere).
+     */
+    bool m_tessellate;
   };
 
   class TessellatedPathBuildingState
@@ -293,10 +349,15 @@ namespace
     float m_max_distance;
     bool m_has_arcs;
     unsigned int m_max_recursion;
-    fastuidraw::reference_counted_ptr<const fastuidraw::StrokedPath> m_stroked;
-    fastuidraw::reference_counted_ptr<const fastuidraw::FilledPath> m_filled;
-    fastuidraw::reference_counted_ptr<const fastuidraw::PartitionedTessellatedPath> m_partitioned;
-    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> > m_linearization;
+    fastuidraw::detail::LazyReference<fastuidraw::StrokedPath> m_stroked;
+    fastuidraw::detail::LazyReference<fastuidraw::FilledPath> m_filled;
+    fastuidraw::detail::LazyReference<fastuidraw::PartitionedTessellatedPath> m_partitioned;
+
+    /* elements of m_linearization are only added
+     * with m_linearization_mutex locked
+     */
+    std::mutex m_linearization_mutex;
+    fastuidraw::detail::TessellatedPathLevels m_linearization;
   };
 
   float
@@ -714,6 +775,162 @@ namespace
     return return_value;
   }
 
+  /* The ranges of groups of a for_each_group() call that runs on
+   * several threads. Each thread, including the calling thread, claims
+   * ranges until none are left, so the calling thread never waits on a
+   * range that no thread has started; thus for_each_group() cannot
+   * deadlock even if called from a background job itself. The object
+   * is reference counted because a background job might only start
+   * after for_each_group() has returned, in which case it finds no
+   * range left and never touches m_f.
+   */
+  template<typename F>
+  class GroupRanges:
+    public fastuidraw::reference_counted<GroupRanges<F> >::concurrent
+  {
+  public:
+    GroupRanges(const F &f, std::vector<unsigned int> &ranges):
+      m_f(f),
+      m_next_range(0),
+      m_number_done(0)
+    {
+      m_ranges.swap(ranges);
+    }
+
+    void
+    run_ranges(void)
+    {
+      unsigned int number_ranges(m_ranges.size() - 1);
+
+      for (unsigned int R = m_next_range.fetch_add(1); R < number_ranges; R = m_next_range.fetch_add(1))
+        {
+          for (unsigned int G = m_ranges[R]; G < m_ranges[R + 1]; ++G)
+            {
+              m_f(G);
+            }
+
+          std::lock_guard<std::mutex> m(m_mutex);
+          if (++m_number_done == number_ranges)
+            {
+              m_condition.notify_all();
+            }
+        }
+    }
+
+    void
+    wait(void)
+    {
+      std::unique_lock<std::mutex> m(m_mutex);
+      m_condition.wait(m, [this]() { return m_number_done + 1 == m_ranges.size(); });
+    }
+
+  private:
+    const F &m_f;
+
+    /* m_ranges[R] is the first group of range R */
+    std::vector<unsigned int> m_ranges;
+    std::atomic<unsigned int> m_next_range;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    unsigned int m_number_done;
+  };
+
+  /* Call f(G) for each group G of groups, using up to max_number_threads
+   * threads. The groups are split into contiguous ranges of about equal
+   * weight, one range for each thread; the ranges are processed by the
+   * calling thread and by the threads of the background job pool (see
+   * detail::submit_background_job()). A thread is only used if there
+   * is enough work for it; otherwise the groups are processed serially
+   * by the calling thread.
+   */
+  template<typename F>
+  void
+  for_each_group(const ContourGroups &groups,
+                 const std::vector<unsigned int> &group_weights,
+                 unsigned int max_number_threads,
+                 const F &f)
+  {
+    enum
+      {
+        minimum_weight_per_thread = 64
+      };
+
+    unsigned int total_weight(0), number_threads;
+
+    FASTUIDRAWassert(group_weights.size() == groups.m_groups.size());
+    for (unsigned int w : group_weights)
+      {
+        total_weight += w;
+      }
+
+    number_threads = fastuidraw::t_min(max_number_threads, total_weight / minimum_weight_per_thread);
+    number_threads = fastuidraw::t_min(number_threads, static_cast<unsigned int>(groups.m_groups.size()));
+    if (number_threads <= 1)
+      {
+        for (unsigned int G = 0, endG = groups.m_groups.size(); G < endG; ++G)
+          {
+            f(G);
+          }
+        return;
+      }
+
+    std::vector<unsigned int> ranges(number_threads + 1, groups.m_groups.size());
+    unsigned int current_weight(0);
+
+    ranges[0] = 0;
+    for (unsigned int G = 0, T = 1, endG = groups.m_groups.size(); G < endG && T < number_threads; ++G)
+      {
+        current_weight += group_weights[G];
+        if (current_weight * number_threads >= T * total_weight)
+          {
+            ranges[T++] = G + 1;
+          }
+      }
+
+    fastuidraw::reference_counted_ptr<GroupRanges<F> > jobs;
+
+    jobs = FASTUIDRAWnew GroupRanges<F>(f, ranges);
+    for (unsigned int T = 1; T < number_threads; ++T)
+      {
+        fastuidraw::detail::submit_background_job([jobs]() { jobs->run_ranges(); });
+      }
+    jobs->run_ranges();
+    jobs->wait();
+  }
+}
+
+//////////////////////////////////////////////
+// ContourGroups methods
+ContourGroups::
+ContourGroups(const fastuidraw::Path &path,
+              unsigned int max_number_threads)
+{
+  if (max_number_threads <= 1)
+    {
+      m_groups.push_back(std::vector<unsigned int>(path.number_contours()));
+      for (unsigned int o = 0, endo = path.number_contours(); o < endo; ++o)
+        {
+          m_groups.back()[o] = o;
+        }
+      return;
+    }
+
+  std::map<const fastuidraw::PathContour*, unsigned int> group_of_contour;
+
+  for (unsigned int o = 0, endo = path.number_contours(); o < endo; ++o)
+    {
+      const fastuidraw::PathContour *contour(path.contour(o).get());
+      std::map<const fastuidraw::PathContour*, unsigned int>::iterator iter;
+
+      iter = group_of_contour.find(contour);
+      if (iter == group_of_contour.end())
+        {
+          iter = group_of_contour.insert(std::make_pair(contour, m_groups.size())).first;
+          m_groups.push_back(std::vector<unsigned int>());
+        }
+      m_groups[iter->second].push_back(o);
+    }
 }
 
 //////////////////////////////////////////////
@@ -1219,6 +1436,7 @@ Refiner(fastuidraw::TessellatedPath *p, const Path &input)
   RefinerPrivate *d;
   m_d = d = FASTUIDRAWnew RefinerPrivate();
   d->m_path = p;
+  d->m_groups = ContourGroups(input, p->tessellation_parameters().m_max_number_threads);
   d->m_contours.resize(input.number_contours());
   for (unsigned int i = 0, endi = input.number_contours(); i < endi; ++i)
     {
@@ -1271,6 +1489,8 @@ TessellatedPath(Refiner *p, float max_distance,
   TessellationParams params;
   params.m_max_distance = max_distance;
   params.m_max_recursion = ref_d->m_path->max_recursion() + additional_recursion_count;
+  params.m_max_number_threads = ref_d->m_path->tessellation_parameters().m_max_number_threads;
+  params.m_flatten_curves = ref_d->m_path->tessellation_parameters().m_flatten_curves;
 
   m_d = d = FASTUIDRAWnew TessellatedPathPrivate(ref_d->m_contours.size(), params);
   if (ref_d->m_contours.empty())
@@ -1278,7 +1498,50 @@ TessellatedPath(Refiner *p, float max_distance,
       return;
     }
 
-  std::vector<segment> work_room;
+  std::vector<std::vector<EdgeTessellation> > edges(ref_d->m_contours.size());
+  std::vector<unsigned int> group_weights(ref_d->m_groups.m_groups.size(), 0u);
+
+  for (unsigned int G = 0, endG = ref_d->m_groups.m_groups.size(); G < endG; ++G)
+    {
+      for (unsigned int o : ref_d->m_groups.m_groups[G])
+        {
+          edges[o].resize(ref_d->m_contours[o].m_edges.size());
+          group_weights[G] += ref_d->m_contours[o].m_edges.size();
+        }
+    }
+
+  for_each_group(ref_d->m_groups, group_weights, d->m_params.m_max_number_threads,
+                 [&](unsigned int G)
+                 {
+                   for (unsigned int o : ref_d->m_groups.m_groups[G])
+                     {
+                       RefinerContour &contour(ref_d->m_contours[o]);
+                       for (unsigned int e = 0, ende = contour.m_edges.size(); e < ende; ++e)
+                         {
+                           RefinerEdge &edge(contour.m_edges[e]);
+                           EdgeTessellation &E(edges[o][e]);
+                           SegmentStorage segment_storage;
+
+                           segment_storage.m_d = &E.m_segments;
+                           if (edge.m_tess_state)
+                             {
+                               edge.m_tess_state->resume_tessellation(d->m_params, &segment_storage, &E.m_max_distance);
+                             }
+                           else
+                             {
+                               /* edges whose tessellation came from a ContourTessellationCache
+                                * do not have a tessellation_state; resuming a tessellation
+                                * gives the same segments as starting a new one with the
+                                * finer parameters, so start one and keep it for the next
+                                * refinement.
+                                */
+                               edge.m_tess_state = edge.m_interpolator->produce_tessellation(d->m_params, &segment_storage,
+                                                                                             &E.m_max_distance);
+                             }
+                         }
+                     }
+                 });
+
   TessellatedPathBuildingState builder;
   for(unsigned int o = 0, endo = ref_d->m_contours.size(); o < endo; ++o)
     {
@@ -1287,24 +1550,15 @@ TessellatedPath(Refiner *p, float max_distance,
 
       for(unsigned int e = 0, ende = contour.m_edges.size(); e < ende; ++e)
         {
-          const RefinerEdge edge(contour.m_edges[e]);
-          SegmentStorage segment_storage;
-          float tmp;
-
-          FASTUIDRAWassert(work_room.empty());
-          segment_storage.m_d = &work_room;
+          const RefinerEdge &edge(contour.m_edges[e]);
+          EdgeTessellation &E(edges[o][e]);
 
           if (edge.m_tess_state)
             {
-              edge.m_tess_state->resume_tessellation(d->m_params, &segment_storage, &tmp);
               d->m_max_recursion = t_max(d->m_max_recursion, edge.m_tess_state->recursion_depth());
             }
-          else
-            {
-              edge.m_interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
-            }
 
-          d->add_edge(builder, o, e, work_room, tmp);
+          d->add_edge(builder, o, e, E.m_segments, E.m_max_distance);
           d->m_contours[o].m_edges[e].m_edge_type = edge.m_interpolator->edge_type();
         }
 
@@ -1317,18 +1571,39 @@ TessellatedPath(Refiner *p, float max_distance,
 fastuidraw::TessellatedPath::
 TessellatedPath(const Path &input,
                 fastuidraw::TessellatedPath::TessellationParams TP,
-                reference_counted_ptr<Refiner> *ref)
+                reference_counted_ptr<Refiner> *ref):
+  TessellatedPath(input, TP, ref, nullptr)
+{
+}
+
+fastuidraw::TessellatedPath::
+TessellatedPath(const Path &input,
+                fastuidraw::TessellatedPath::TessellationParams TP,
+                reference_counted_ptr<Refiner> *ref,
+                void *contour_cache)
 {
+  typedef detail::ContourTessellationCache ContourTessellationCache;
+
   TessellatedPathPrivate *d;
+  ContourTessellationCache *cache;
+  std::vector<ContourTessellationCache::Contour> prev_cache;
+
   m_d = d = FASTUIDRAWnew TessellatedPathPrivate(input.number_contours(), TP);
+  cache = static_cast<ContourTessellationCache*>(contour_cache);
+  if (cache)
+    {
+      std::swap(prev_cache, cache->m_contours);
+      cache->m_contours.resize(input.number_contours());
+    }
 
   if (input.number_contours() == 0)
     {
       return;
     }
 
-  std::vector<segment> work_room;
   RefinerPrivate *refiner_d(nullptr);
+  ContourGroups local_groups;
+  const ContourGroups *groups;
 
   if (ref)
     {
@@ -1336,13 +1611,118 @@ TessellatedPath(const Path &input,
       r = FASTUIDRAWnew Refiner(this, input);
       *ref = r;
       refiner_d = static_cast<RefinerPrivate*>(r->m_d);
+      groups = &refiner_d->m_groups;
+    }
+  else
+    {
+      local_groups = ContourGroups(input, d->m_params.m_max_number_threads);
+      groups = &local_groups;
+    }
+
+  /* Contours are usually added at (or just before) the end of a
+   * Path, so the entry of the previous cache after the last match
+   * is checked first; only if that fails is the entry looked up
+   * by the contour.
+   */
+  unsigned int prev_cache_location(0);
+  std::map<const PathContour*, unsigned int> prev_cache_map;
+  std::vector<std::vector<EdgeTessellation> > edges(input.number_contours());
+
+  for(unsigned int o = 0, endo = input.number_contours(); o < endo; ++o)
+    {
+      const reference_counted_ptr<const PathContour> &contour(input.contour(o));
+      ContourTessellationCache::Contour *cached(nullptr);
+      unsigned int num_cached_edges(0);
+
+      edges[o].resize(contour->number_interpolators());
+      if (cache)
+        {
+          unsigned int I(prev_cache_location);
+
+          if (I >= prev_cache.size() || prev_cache[I].m_contour != contour)
+            {
+              std::map<const PathContour*, unsigned int>::const_iterator iter;
+
+              if (prev_cache_map.empty())
+                {
+                  for (unsigned int i = 0, endi = prev_cache.size(); i < endi; ++i)
+                    {
+                      prev_cache_map[prev_cache[i].m_contour.get()] = i;
+                    }
+                }
+              iter = prev_cache_map.find(contour.get());
+              I = (iter != prev_cache_map.end()) ? iter->second : prev_cache.size();
+            }
+
+          cached = &cache->m_contours[o];
+          if (I < prev_cache.size() && prev_cache[I].m_contour == contour)
+            {
+              /* take the entry, so that a contour appearing more
+               * than once in the Path only matches it once.
+               */
+              std::swap(*cached, prev_cache[I]);
+              prev_cache[I].m_contour = nullptr;
+              prev_cache_location = I + 1;
+            }
+          cached->m_contour = contour;
+
+          while (num_cached_edges < cached->m_edges.size()
+                 && num_cached_edges < contour->number_interpolators()
+                 && cached->m_edges[num_cached_edges].m_interpolator == contour->interpolator(num_cached_edges))
+            {
+              edges[o][num_cached_edges].m_tessellate = false;
+              ++num_cached_edges;
+            }
+
+          /* an interpolator that does not match invalidates
+           * the cached edges that come after it
+           */
+          cached->m_edges.resize(num_cached_edges);
+        }
     }
 
+  std::vector<unsigned int> group_weights(groups->m_groups.size(), 0u);
+  for (unsigned int G = 0, endG = groups->m_groups.size(); G < endG; ++G)
+    {
+      for (unsigned int o : groups->m_groups[G])
+        {
+          for (const EdgeTessellation &E : edges[o])
+            {
+              group_weights[G] += E.m_tessellate ? 1u : 0u;
+            }
+        }
+    }
+
+  for_each_group(*groups, group_weights, d->m_params.m_max_number_threads,
+                 [&](unsigned int G)
+                 {
+                   for (unsigned int o : groups->m_groups[G])
+                     {
+                       const reference_counted_ptr<const PathContour> &contour(input.contour(o));
+                       for (unsigned int e = 0, ende = contour->number_interpolators(); e < ende; ++e)
+                         {
+                           EdgeTessellation &E(edges[o][e]);
+                           if (E.m_tessellate)
+                             {
+                               SegmentStorage segment_storage;
+
+                               FASTUIDRAWassert(contour->interpolator(e));
+                               segment_storage.m_d = &E.m_segments;
+                               E.m_tess_state = contour->interpolator(e)->produce_tessellation(d->m_params, &segment_storage,
+                                                                                              &E.m_max_distance);
+                             }
+                         }
+                     }
+                 });
+
+  std::vector<segment> work_room;
   TessellatedPathBuildingState builder;
   for(unsigned int o = 0, endo = input.number_contours(); o < endo; ++o)
     {
       const reference_counted_ptr<const PathContour> &contour(input.contour(o));
+      ContourTessellationCache::Contour *cached;
 
+      cached = (cache) ? &cache->m_contours[o] : nullptr;
       if (refiner_d)
         {
           refiner_d->m_contours[o].m_edges.resize(contour->number_interpolators());
@@ -1352,28 +1732,42 @@ TessellatedPath(const Path &input,
       d->start_contour(builder, o, contour->point(0), contour->number_interpolators());
       for(unsigned int e = 0, ende = contour->number_interpolators(); e < ende; ++e)
         {
-          SegmentStorage segment_storage;
           const reference_counted_ptr<const PathContour::interpolator_base> &interpolator(contour->interpolator(e));
-          reference_counted_ptr<PathContour::tessellation_state> tess_state;
-          float tmp;
+          EdgeTessellation &E(edges[o][e]);
+          unsigned int recursion_depth;
 
-          FASTUIDRAWassert(interpolator);
           FASTUIDRAWassert(work_room.empty());
-          segment_storage.m_d = &work_room;
+          if (!E.m_tessellate)
+            {
+              const ContourTessellationCache::Edge &cached_edge(cached->m_edges[e]);
 
-          tess_state = interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
-          if (tess_state)
+              work_room = cached_edge.m_segments;
+              E.m_max_distance = cached_edge.m_max_distance;
+              recursion_depth = cached_edge.m_recursion_depth;
+            }
+          else
             {
-              d->m_max_recursion = t_max(d->m_max_recursion, tess_state->recursion_depth());
+              recursion_depth = (E.m_tess_state) ? E.m_tess_state->recursion_depth() : 0u;
+              if (cached)
+                {
+                  FASTUIDRAWassert(cached->m_edges.size() == e);
+                  cached->m_edges.push_back(ContourTessellationCache::Edge());
+                  cached->m_edges.back().m_interpolator = interpolator;
+                  cached->m_edges.back().m_segments = E.m_segments;
+                  cached->m_edges.back().m_max_distance = E.m_max_distance;
+                  cached->m_edges.back().m_recursion_depth = recursion_depth;
+                }
+              work_room.swap(E.m_segments);
             }
 
+          d->m_max_recursion = t_max(d->m_max_recursion, recursion_depth);
           if (refiner_d)
             {
-              refiner_d->m_contours[o].m_edges[e].m_tess_state = tess_state;
+              refiner_d->m_contours[o].m_edges[e].m_tess_state = E.m_tess_state;
               refiner_d->m_contours[o].m_edges[e].m_interpolator = interpolator;
             }
 
-          d->add_edge(builder, o, e, work_room, tmp);
+          d->add_edge(builder, o, e, work_room, E.m_max_distance);
           d->m_contours[o].m_edges[e].m_edge_type = interpolator->edge_type();
         }
 
@@ -1615,11 +2009,9 @@ stroked(void) const
 {
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
-  if (!d->m_stroked)
-    {
-      d->m_stroked = FASTUIDRAWnew StrokedPath(*this);
-    }
-  return *(d->m_stroked);
+  return d->m_stroked.get([this]() {
+      return reference_counted_ptr<const StrokedPath>(FASTUIDRAWnew StrokedPath(*this));
+    });
 }
 
 const fastuidraw::TessellatedPath&
@@ -1634,7 +2026,29 @@ linearization(float thresh) const
       return *this;
     }
 
-  if (d->m_linearization.empty())
+  /* asking for a finer tessellation than the
+   * max-distance of this TessellatedPath is
+   * pointless.
+   */
+  if (thresh >= 0.0f)
+    {
+      thresh = t_max(thresh, d->m_max_distance);
+    }
+
+  const TessellatedPath *p;
+
+  p = (thresh < 0.0f) ?
+    d->m_linearization.front() :
+    d->m_linearization.find(thresh);
+  if (p)
+    {
+      return *p;
+    }
+
+  std::lock_guard<std::mutex> m(d->m_linearization_mutex);
+  const std::vector<reference_counted_ptr<const TessellatedPath> > &data(d->m_linearization.elements());
+
+  if (data.empty())
     {
       /* default tessellation where arcs are barely tessellated */
       d->m_linearization.push_back(FASTUIDRAWnew TessellatedPath(*this, -1.0f));
@@ -1642,33 +2056,28 @@ linearization(float thresh) const
 
   if (thresh < 0.0f)
     {
-      return *(d->m_linearization.front());
+      return *(data.front());
     }
 
-  /* asking for a finer tessellation than the
-   * max-distance of this TessellatedPath is
-   * pointless.
-   */
-  thresh = t_max(thresh, d->m_max_distance);
-  if (d->m_linearization.back()->max_distance() <= thresh)
+  if (data.back()->max_distance() <= thresh)
     {
       typename std::vector<reference_counted_ptr<const TessellatedPath> >::const_iterator iter;
-      iter = std::lower_bound(d->m_linearization.begin(),
-                              d->m_linearization.end(),
+      iter = std::lower_bound(data.begin(),
+                              data.end(),
                               thresh, detail::reverse_compare_max_distance);
-      FASTUIDRAWassert(iter != d->m_linearization.end());
+      FASTUIDRAWassert(iter != data.end());
       FASTUIDRAWassert(*iter);
       FASTUIDRAWassert((*iter)->max_distance() <= thresh);
       return **iter;
     }
 
-  float current(d->m_linearization.back()->max_distance());
+  float current(data.back()->max_distance());
   while (current > thresh)
     {
       current *= 0.5f;
       d->m_linearization.push_back(FASTUIDRAWnew TessellatedPath(*this, current));
     }
-  return *(d->m_linearization.back());
+  return *(data.back());
 }
 
 const fastuidraw::TessellatedPath&
@@ -1687,11 +2096,9 @@ filled(float thresh) const
 
   tess = &linearization(thresh);
   tess_d = static_cast<TessellatedPathPrivate*>(tess->m_d);
-  if (!tess_d->m_filled)
-    {
-      tess_d->m_filled = FASTUIDRAWnew FilledPath(*tess);
-    }
-  return *(tess_d->m_filled);
+  return tess_d->m_filled.get([tess]() {
+      return reference_counted_ptr<const FilledPath>(FASTUIDRAWnew FilledPath(*tess));
+    });
 }
 
 const fastuidraw::FilledPath&
@@ -1707,9 +2114,7 @@ partitioned(void) const
 {
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
-  if (!d->m_partitioned)
-    {
-      d->m_partitioned = FASTUIDRAWnew PartitionedTessellatedPath(*this);
-    }
-  return *(d->m_partitioned);
+  return d->m_partitioned.get([this]() {
+      return reference_counted_ptr<const PartitionedTessellatedPath>(FASTUIDRAWnew PartitionedTessellatedPath(*this));
+    });
 }
@@ -20,6 +20,7 @@
 #include <map>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
 #include <private/util_private.hpp>
@@ -112,6 +113,14 @@ namespace
     void
     remove_from_atlas(void);
 
+    /* Generates the rendering data of the glyph if it has
+     * not yet been generated; locks m_mutex only if the
+     * data needs to be generated.
+     */
+    void
+    generate_rendering_data(fastuidraw::GlyphMetrics metrics);
+
+    /* must be called with m_mutex locked */
     enum fastuidraw::return_code
     upload_to_atlas(fastuidraw::GlyphMetrics metrics,
                     fastuidraw::GlyphAtlasProxy &S,
@@ -120,11 +129,22 @@ namespace
     /* location into m_cache->m_glyphs  */
     unsigned int m_cache_location;
 
+    /* m_render and m_metrics are only written under the
+     * lock of the GlyphCache; the remaining fields are
+     * written under m_mutex so that glyphs of the same
+     * cache can be generated and uploaded by different
+     * threads in parallel.
+     */
     fastuidraw::GlyphRenderer m_render;
     GlyphMetricsPrivate *m_metrics;
 
+    std::mutex m_mutex;
+
+    /* true once m_path and m_render_size are assigned */
+    std::atomic<bool> m_ready;
+
     std::vector<fastuidraw::GlyphAttribute> m_attributes;
-    bool m_uploaded_to_atlas;
+    std::atomic<bool> m_uploaded_to_atlas;
 
     /* Path of the glyph */
     fastuidraw::Path m_path;
@@ -321,6 +341,7 @@ GlyphDataPrivate(GlyphCachePrivate *c, unsigned int I):
   GlyphAtlasProxyPrivate(c),
   m_cache_location(I),
   m_metrics(nullptr),
+  m_ready(false),
   m_uploaded_to_atlas(false),
   m_glyph_data(nullptr)
 {}
@@ -330,6 +351,7 @@ GlyphDataPrivate(void):
   GlyphAtlasProxyPrivate(nullptr),
   m_cache_location(~0u),
   m_metrics(nullptr),
+  m_ready(false),
   m_uploaded_to_atlas(false),
   m_glyph_data(nullptr)
 {}
@@ -362,9 +384,12 @@ void
 GlyphDataPrivate::
 clear(void)
 {
+  std::lock_guard<std::mutex> m(m_mutex);
+
   m_render = fastuidraw::GlyphRenderer();
   FASTUIDRAWassert(!m_render.valid());
 
+  m_ready = false;
   remove_from_atlas();
   if (m_glyph_data)
     {
@@ -380,6 +405,25 @@ clear(void)
   m_path.clear();
 }
 
+void
+GlyphDataPrivate::
+generate_rendering_data(fastuidraw::GlyphMetrics metrics)
+{
+  if (m_ready.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
+  std::lock_guard<std::mutex> m(m_mutex);
+  if (!m_ready)
+    {
+      FASTUIDRAWassert(!m_glyph_data);
+      m_glyph_data = m_metrics->m_font->compute_rendering_data(m_render, metrics,
+                                                               m_path, m_render_size);
+      m_ready.store(true, std::memory_order_release);
+    }
+}
+
 enum fastuidraw::return_code
 GlyphDataPrivate::
 upload_to_atlas(fastuidraw::GlyphMetrics metrics,
@@ -398,12 +442,18 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
       return fastuidraw::routine_fail;
     }
 
-  FASTUIDRAWassert(m_glyph_data);
-  FASTUIDRAWassert(m_attributes.empty());
-
   if (!m_glyph_data)
     {
-      m_glyph_data = m_metrics->m_font->compute_rendering_data(m_render, metrics, m_path, m_render_size);
+      /* the rendering data was released after an earlier
+       * upload, regenerate it; m_path and m_render_size
+       * are already set and might be read by other threads,
+       * so do not write to them.
+       */
+      fastuidraw::Path tmp_path;
+      fastuidraw::vec2 tmp_render_size;
+
+      m_glyph_data = m_metrics->m_font->compute_rendering_data(m_render, metrics,
+                                                               tmp_path, tmp_render_size);
     }
 
   fastuidraw::c_array<const fastuidraw::c_string> render_cost_labels(m_glyph_data->render_info_labels());
@@ -420,7 +470,7 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
         }
       m_render_cost_info.back().m_label = "SizeOnCacheInKB";
       m_render_cost_info.back().m_value = static_cast<float>(S.total_allocated() * 4) / 1024.0f;
-      m_uploaded_to_atlas = true;
+      m_uploaded_to_atlas.store(true, std::memory_order_release);
     }
   else
     {
@@ -620,7 +670,12 @@ upload_to_atlas(void) const
       return routine_fail;
     }
 
-  std::lock_guard<std::mutex> m(p->m_cache->m_glyphs_mutex);
+  if (p->m_uploaded_to_atlas.load(std::memory_order_acquire))
+    {
+      return routine_success;
+    }
+
+  std::lock_guard<std::mutex> m(p->m_mutex);
   GlyphAtlasProxy S(p);
   GlyphAttribute::Array T(&p->m_attributes);
   return p->upload_to_atlas(metrics(), S, T);
@@ -634,7 +689,7 @@ uploaded_to_atlas(void) const
 
   p = static_cast<GlyphDataPrivate*>(m_opaque);
   FASTUIDRAWassert(p != nullptr && p->m_render.valid());
-  return p->m_uploaded_to_atlas;
+  return p->m_uploaded_to_atlas.load(std::memory_order_acquire);
 }
 
 const fastuidraw::Path&
@@ -687,6 +742,7 @@ create_glyph(GlyphRenderer render,
   font->compute_metrics(glyph_code, v);
   d->m_glyph_data = font->compute_rendering_data(d->m_render, cv, d->m_path,
                                                  d->m_render_size);
+  d->m_ready = true;
   return Glyph(d);
 }
 
@@ -864,29 +920,31 @@ fetch_glyph(GlyphRenderer render, const FontBase *font,
   GlyphDataPrivate *q;
   glyph_key src(font, glyph_code, render);
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  q = d->m_glyphs.fetch_or_allocate(d, src);
+  {
+    std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
 
-  if (!q->m_render.valid())
-    {
-      GlyphMetrics m;
-
-      q->m_render = render;
-      FASTUIDRAWassert(!q->m_glyph_data);
-      m = fetch_glyph_metrics(font, glyph_code);
-      q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-      q->m_glyph_data = font->compute_rendering_data(q->m_render, m,
-                                                     q->m_path, q->m_render_size);
-    }
+    q = d->m_glyphs.fetch_or_allocate(d, src);
+    if (!q->m_render.valid())
+      {
+        GlyphMetrics m;
 
+        q->m_render = render;
+        m = fetch_glyph_metrics(font, glyph_code);
+        q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
+      }
+  }
+
+  /* generating and uploading the glyph data only locks the
+   * glyph so that other threads can fetch other glyphs
+   */
+  Glyph G(q);
+  q->generate_rendering_data(GlyphMetrics(q->m_metrics));
   if (upload_to_atlas)
     {
-      GlyphAtlasProxy S(q);
-      GlyphAttribute::Array T(&q->m_attributes);
-      q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+      G.upload_to_atlas();
     }
 
-  return Glyph(q);
+  return G;
 }
 
 void
@@ -929,40 +987,44 @@ fetch_glyphs(GlyphRenderer render,
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  for(unsigned int i = 0; i < glyph_metrics.size(); ++i)
+  {
+    std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+    for(unsigned int i = 0; i < glyph_metrics.size(); ++i)
+      {
+        if (glyph_metrics[i].valid())
+          {
+            glyph_key src(glyph_metrics[i].font().get(),
+                          glyph_metrics[i].glyph_code(),
+                          render);
+            GlyphDataPrivate *q;
+
+            q = d->m_glyphs.fetch_or_allocate(d, src);
+            if (!q->m_render.valid())
+              {
+                q->m_render = render;
+                q->m_metrics = static_cast<GlyphMetricsPrivate*>(glyph_metrics[i].m_d);
+              }
+            out_glyphs[i] = Glyph(q);
+          }
+        else
+          {
+            out_glyphs[i] = Glyph();
+          }
+      }
+  }
+
+  for (Glyph G : out_glyphs)
     {
-      if (glyph_metrics[i].valid())
-        {
-          glyph_key src(glyph_metrics[i].font().get(),
-                        glyph_metrics[i].glyph_code(),
-                        render);
-          GlyphDataPrivate *q;
-
-          q = d->m_glyphs.fetch_or_allocate(d, src);
-          if (!q->m_render.valid())
-            {
-              GlyphMetrics m(glyph_metrics[i]);
-
-              q->m_render = render;
-              FASTUIDRAWassert(!q->m_glyph_data);
-              q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-              q->m_glyph_data = src.m_font->compute_rendering_data(q->m_render, m,
-                                                                   q->m_path, q->m_render_size);
-            }
+      GlyphDataPrivate *q;
 
+      q = static_cast<GlyphDataPrivate*>(G.m_opaque);
+      if (q)
+        {
+          q->generate_rendering_data(GlyphMetrics(q->m_metrics));
           if (upload_to_atlas)
             {
-              GlyphAtlasProxy S(q);
-              GlyphAttribute::Array T(&q->m_attributes);
-              q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+              G.upload_to_atlas();
             }
-
-          out_glyphs[i] = Glyph(q);
-        }
-      else
-        {
-          out_glyphs[i] = Glyph();
         }
     }
 }
@@ -982,46 +1044,41 @@ add_glyph(Glyph glyph, bool upload_to_atlas)
       return routine_fail;
     }
 
-  if (g->m_cache && g->m_cache != d)
-    {
-      return routine_fail;
-    }
-
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  if (g->m_cache)
-    {
-      /* already part of this cache, upload if necessary */
-      if (upload_to_atlas)
-        {
-          GlyphAtlasProxy S(g);
-          GlyphAttribute::Array T(&g->m_attributes);
-          g->upload_to_atlas(GlyphMetrics(g->m_metrics), S, T);
-        }
-      return routine_success;
-    }
-
-  glyph_key src(g->m_metrics->m_font.get(),
-                g->m_metrics->m_glyph_code,
-                g->m_render);
-
-  std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
-
-  /* Take the metrics if we can */
-  glyph_metrics_key metrics_src(g->m_metrics->m_font.get(),
-                                g->m_metrics->m_glyph_code);
-  d->m_glyph_metrics.take(g->m_metrics, d, metrics_src);
-
-  /* take the glyph */
-  if (d->m_glyphs.take(g, d, src) == routine_fail)
-    {
-      return routine_fail;
-    }
+  {
+    /* m_cache is only set with m_glyphs_mutex locked, so it
+     * must be checked with the lock held; otherwise two threads
+     * adding the same glyph could both see it as not yet added.
+     */
+    std::lock_guard<std::mutex> m1(d->m_glyphs_mutex);
+    if (g->m_cache && g->m_cache != d)
+      {
+        return routine_fail;
+      }
+
+    if (!g->m_cache)
+      {
+        glyph_key src(g->m_metrics->m_font.get(),
+                      g->m_metrics->m_glyph_code,
+                      g->m_render);
+
+        std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
+
+        /* Take the metrics if we can */
+        glyph_metrics_key metrics_src(g->m_metrics->m_font.get(),
+                                      g->m_metrics->m_glyph_code);
+        d->m_glyph_metrics.take(g->m_metrics, d, metrics_src);
+
+        /* take the glyph */
+        if (d->m_glyphs.take(g, d, src) == routine_fail)
+          {
+            return routine_fail;
+          }
+      }
+  }
 
   if (upload_to_atlas)
     {
-      GlyphAtlasProxy S(g);
-      GlyphAttribute::Array T(&g->m_attributes);
-      g->upload_to_atlas(GlyphMetrics(g->m_metrics), S, T);
+      glyph.upload_to_atlas();
     }
 
   return routine_success;
@@ -1058,6 +1115,8 @@ clear_atlas(void)
   std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
   for(GlyphDataPrivate *g : d->m_glyphs.data())
     {
+      std::lock_guard<std::mutex> mg(g->m_mutex);
+
       /* setting m_uploaded_to_atlas marks the Glyph
        * as not uploaded. Clearing m_data_locations
        * prevents calling GlyphAtlas::deallocate_data().